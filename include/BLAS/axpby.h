@@ -0,0 +1,311 @@
+/** \file
+ *
+ *  \brief            xAXPBY (BLAS-1 extension)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_BLAS_AXPBY_H_
+#define LINALG_BLAS_AXPBY_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::BLAS
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *    LinAlg::BLAS::<NAME>
+ *        bindings to the <NAME> BLAS backend
+ */
+
+#include <utility>      // std::move
+
+#include "../preprocessor.h"
+
+#ifdef HAVE_CUDA
+# include <cuda_runtime.h>
+# include <cublas_v2.h>
+# include "../CUDA/cuda_checks.h"
+# include "../CUDA/cuda_cublas.h"
+#endif
+
+#include "../types.h"
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../utilities/checks.h"
+#include "../streams.h"
+#include "../dense.h"
+#include "vector_layout.h"
+#include "axpy.h"
+#include "scal.h"
+
+#ifdef HAVE_MKL
+# include <mkl.h>
+#endif
+
+namespace LinAlg {
+
+namespace BLAS {
+
+#ifdef HAVE_MKL
+namespace MKL {
+
+// ?axpby
+/** \brief            Scaled vector addition
+ *
+ *  y = alpha * x + beta * y
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        x
+ *
+ *  \param[in]        incx
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    y
+ *
+ *  \param[in]        incy
+ *
+ *  See MKL Documentation for BLAS-like functions
+ */
+inline void xAXPBY(I_t n, S_t alpha, S_t* x, I_t incx, S_t beta, S_t* y,
+                   I_t incy) {
+
+  PROFILING_FUNCTION_HEADER
+
+  saxpby(&n, &alpha, x, &incx, &beta, y, &incy);
+
+}
+/** \overload
+ */
+inline void xAXPBY(I_t n, D_t alpha, D_t* x, I_t incx, D_t beta, D_t* y,
+                   I_t incy) {
+
+  PROFILING_FUNCTION_HEADER
+
+  daxpby(&n, &alpha, x, &incx, &beta, y, &incy);
+
+}
+/** \overload
+ */
+inline void xAXPBY(I_t n, C_t alpha, C_t* x, I_t incx, C_t beta, C_t* y,
+                   I_t incy) {
+
+  PROFILING_FUNCTION_HEADER
+
+  caxpby(&n, (const MKL_Complex8*)&alpha, (const MKL_Complex8*)x, &incx,
+         (const MKL_Complex8*)&beta, (MKL_Complex8*)y, &incy);
+
+}
+/** \overload
+ */
+inline void xAXPBY(I_t n, Z_t alpha, Z_t* x, I_t incx, Z_t beta, Z_t* y,
+                   I_t incy) {
+
+  PROFILING_FUNCTION_HEADER
+
+  zaxpby(&n, (const MKL_Complex16*)&alpha, (const MKL_Complex16*)x, &incx,
+         (const MKL_Complex16*)&beta, (MKL_Complex16*)y, &incy);
+
+}
+
+} /* namespace LinAlg::BLAS::MKL */
+#endif /* HAVE_MKL */
+
+using LinAlg::Utilities::check_device;
+using LinAlg::Utilities::check_format;
+using LinAlg::Utilities::check_vector;
+using LinAlg::Utilities::check_stream_alive;
+#ifdef HAVE_CUDA
+using LinAlg::Utilities::check_gpu_structures;
+using LinAlg::Utilities::check_stream_prefer_native;
+using LinAlg::Utilities::check_stream_device_id;
+using LinAlg::CUDA::cuBLAS::prepare_cublas;
+using LinAlg::CUDA::cuBLAS::finish_cublas;
+#endif
+
+#ifndef DOXYGEN_SKIP
+// Shared implementation of xAXPBY() and xAXPBY_async(). Without MKL the
+// operation is carried out as xSCAL() followed by xAXPY(). On the GPU the
+// operation is added to stream if given, otherwise it runs synchronously on
+// the compute stream.
+template <typename T>
+inline void axpby(const T alpha, const Dense<T>& x, const T beta, Dense<T>& y,
+                  Stream* stream, const char* caller_name) {
+
+#ifndef LINALG_NO_CHECKS
+  check_device(x, y, caller_name);
+  check_format(Format::ColMajor, x, caller_name);
+  check_format(Format::ColMajor, y, caller_name);
+  check_vector(-1, y, caller_name);
+  check_vector(vector_length(y), x, caller_name);
+#endif
+
+  auto location = y._location;
+  auto device_id = y._device_id;
+  auto n = vector_length(y);
+  auto x_ptr = x._begin();
+  auto incx = vector_increment(x);
+  auto y_ptr = y._begin();
+  auto incy = vector_increment(y);
+
+  if (location == Location::host) {
+
+#ifdef HAVE_MKL
+    MKL::xAXPBY(n, alpha, x_ptr, incx, beta, y_ptr, incy);
+#else
+    if (beta != cast<T>(1.0)) FORTRAN::xSCAL(n, beta, y_ptr, incy);
+    FORTRAN::xAXPY(n, alpha, x_ptr, incx, y_ptr, incy);
+#endif
+
+  }
+#ifdef HAVE_CUDA
+  else if (location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_gpu_structures(caller_name);
+# endif
+
+    int               prev_device = 0;
+    cudaStream_t      prev_cuda_stream;
+    Stream*           stream_ = stream;
+
+# ifndef USE_LOCAL_STREAMS
+    if (stream_ == nullptr) {
+      stream_ = &(LinAlg::CUDA::compute_stream[device_id]);
+    }
+# else
+    Stream my_stream(device_id);
+    if (stream_ == nullptr) stream_ = &my_stream;
+# endif
+
+    auto handle = prepare_cublas(*stream_, &prev_device, &prev_cuda_stream);
+    if (beta != cast<T>(1.0)) {
+      BLAS::cuBLAS::xSCAL(*handle, n, &beta, y_ptr, incy);
+    }
+    BLAS::cuBLAS::xAXPY(*handle, n, alpha, x_ptr, incx, y_ptr, incy);
+    finish_cublas(*stream_, &prev_device, &prev_cuda_stream, handle);
+
+    if (stream == nullptr) stream_->sync_cuda();
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    std::string message = caller_name;
+    message = message + ": BLAS-1 AXPBY not supported on selected location";
+    throw excUnimplemented(message);
+
+  }
+#endif
+
+}
+#endif /* DOXYGEN_SKIP */
+
+// Convenience bindings (bindings for Dense<T>)
+/** \brief            Scaled vector addition
+ *
+ *  y = alpha * x + beta * y
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        x
+ *                    Vector (one row or one column) of the same length as y.
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    y
+ *                    Vector (one row or one column).
+ */
+template <typename T>
+inline void xAXPBY(const T alpha, const Dense<T>& x, const T beta,
+                   Dense<T>& y) {
+
+  PROFILING_FUNCTION_HEADER
+
+  axpby(alpha, x, beta, y, nullptr, "xAXPBY()");
+
+}
+
+/** \brief            Asynchronous scaled vector addition
+ *
+ *  y = alpha * x + beta * y
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        x
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    y
+ *
+ *  \param[in]        stream
+ *
+ *  \returns          The ticket number for the operation on the stream
+ */
+template <typename T>
+inline I_t xAXPBY_async(const T alpha, const Dense<T>& x, const T beta,
+                        Dense<T>& y, Stream& stream) {
+
+  PROFILING_FUNCTION_HEADER
+
+  I_t ticket = 0;
+
+  if (y._location == Location::host && !stream.synchronous) {
+
+#ifndef LINALG_NO_CHECKS
+    check_stream_alive(stream, "xAXPBY_async()");
+#endif
+
+    // Arguments passed by copy, ensures memory lifetime but callee can't
+    // modify the arguments anymore
+    auto task = [=]() mutable {
+      axpby(alpha, x, beta, y, nullptr, "xAXPBY_async()");
+    };
+
+    ticket = stream.add(std::move(task));
+
+  } else if (y._location == Location::host) {
+
+    axpby(alpha, x, beta, y, nullptr, "xAXPBY_async()");
+
+  }
+#ifdef HAVE_CUDA
+  else if (y._location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_stream_prefer_native(stream, "xAXPBY_async()");
+    check_stream_device_id(stream, y._device_id, "xAXPBY_async()");
+# endif
+
+    axpby(alpha, x, beta, y, &stream, "xAXPBY_async()");
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    throw excUnimplemented("xAXPBY_async(): BLAS-1 AXPBY not supported on "
+                           "selected location");
+
+  }
+#endif
+
+  return ticket;
+
+}
+
+} /* namespace LinAlg::BLAS */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_BLAS_AXPBY_H_ */
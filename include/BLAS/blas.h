@@ -22,13 +22,32 @@
 #define LINALG_BLAS_H_
 
 // Keep this in alphabetical order
+#include "axpby.h"
 #include "axpy.h"
 #include "cusparse/csc2dense.h"
 #include "cusparse/csr2dense.h"
 #include "copy.h"
+#include "dot.h"
 #include "geam.h"
 #include "gemm.h"
+#include "gemm_batched.h"
+#include "gemv.h"
+#include "ger.h"
+#include "hemm.h"
+#include "herk.h"
+#include "native/csrgemm.h"
+#include "native/csrmm.h"
+#include "native/gemm.h"
+#include "native/gemm3m.h"
+#include "native/gemm_batched.h"
+#include "native/gemm_fixed.h"
+#include "native/gemm_mixed.h"
+#include "nrm2.h"
 #include "omatcopy.h"
+#include "scal.h"
+#include "symm.h"
+#include "syrk.h"
+#include "trmm.h"
 #include "trsm.h"
 
 #endif /* LINALG_BLAS_H_ */
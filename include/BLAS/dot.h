@@ -0,0 +1,603 @@
+/** \file
+ *
+ *  \brief            xDOT, xDOTC (BLAS-1)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_BLAS_DOT_H_
+#define LINALG_BLAS_DOT_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::BLAS
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *    LinAlg::BLAS::<NAME>
+ *        bindings to the <NAME> BLAS backend
+ */
+
+#include <utility>      // std::move
+
+#include "../preprocessor.h"
+
+#ifdef HAVE_CUDA
+# include <cuda_runtime.h>
+# include <cublas_v2.h>
+# include "../CUDA/cuda_checks.h"
+# include "../CUDA/cuda_cublas.h"
+#endif
+
+#include "../types.h"
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../utilities/checks.h"
+#include "../streams.h"
+#include "../dense.h"
+#include "vector_layout.h"
+
+#ifndef DOXYGEN_SKIP
+extern "C" {
+
+  using LinAlg::I_t;
+  using LinAlg::S_t;
+  using LinAlg::D_t;
+  using LinAlg::C_t;
+  using LinAlg::Z_t;
+
+  S_t fortran_name(sdot, SDOT)(const I_t* n, const S_t* x, const I_t* incx,
+                               const S_t* y, const I_t* incy);
+  D_t fortran_name(ddot, DDOT)(const I_t* n, const D_t* x, const I_t* incx,
+                               const D_t* y, const I_t* incy);
+
+  // Complex valued functions: MKL returns the result through an additional
+  // first argument, gfortran compiled libraries return it by value
+#ifdef HAVE_MKL
+  void fortran_name(cdotu, CDOTU)(C_t* result, const I_t* n, const C_t* x,
+                                  const I_t* incx, const C_t* y,
+                                  const I_t* incy);
+  void fortran_name(zdotu, ZDOTU)(Z_t* result, const I_t* n, const Z_t* x,
+                                  const I_t* incx, const Z_t* y,
+                                  const I_t* incy);
+  void fortran_name(cdotc, CDOTC)(C_t* result, const I_t* n, const C_t* x,
+                                  const I_t* incx, const C_t* y,
+                                  const I_t* incy);
+  void fortran_name(zdotc, ZDOTC)(Z_t* result, const I_t* n, const Z_t* x,
+                                  const I_t* incx, const Z_t* y,
+                                  const I_t* incy);
+#else
+  C_t fortran_name(cdotu, CDOTU)(const I_t* n, const C_t* x, const I_t* incx,
+                                 const C_t* y, const I_t* incy);
+  Z_t fortran_name(zdotu, ZDOTU)(const I_t* n, const Z_t* x, const I_t* incx,
+                                 const Z_t* y, const I_t* incy);
+  C_t fortran_name(cdotc, CDOTC)(const I_t* n, const C_t* x, const I_t* incx,
+                                 const C_t* y, const I_t* incy);
+  Z_t fortran_name(zdotc, ZDOTC)(const I_t* n, const Z_t* x, const I_t* incx,
+                                 const Z_t* y, const I_t* incy);
+#endif
+}
+#endif /* DOXYGEN_SKIP */
+
+namespace LinAlg {
+
+namespace BLAS {
+
+namespace FORTRAN {
+
+/** \brief            Dot product
+ *
+ *  x**T * y
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        x
+ *
+ *  \param[in]        incx
+ *
+ *  \param[in]        y
+ *
+ *  \param[in]        incy
+ *
+ *  \returns          The dot product
+ *
+ *  See [DDOT](http://www.mathkeisan.com/usersguide/man/ddot.html)
+ */
+inline S_t xDOT(I_t n, S_t* x, I_t incx, S_t* y, I_t incy) {
+
+  PROFILING_FUNCTION_HEADER
+
+  return fortran_name(sdot, SDOT)(&n, x, &incx, y, &incy);
+
+}
+/** \overload
+ */
+inline D_t xDOT(I_t n, D_t* x, I_t incx, D_t* y, I_t incy) {
+
+  PROFILING_FUNCTION_HEADER
+
+  return fortran_name(ddot, DDOT)(&n, x, &incx, y, &incy);
+
+}
+/** \overload
+ */
+inline C_t xDOT(I_t n, C_t* x, I_t incx, C_t* y, I_t incy) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifdef HAVE_MKL
+  C_t result;
+  fortran_name(cdotu, CDOTU)(&result, &n, x, &incx, y, &incy);
+  return result;
+#else
+  return fortran_name(cdotu, CDOTU)(&n, x, &incx, y, &incy);
+#endif
+
+}
+/** \overload
+ */
+inline Z_t xDOT(I_t n, Z_t* x, I_t incx, Z_t* y, I_t incy) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifdef HAVE_MKL
+  Z_t result;
+  fortran_name(zdotu, ZDOTU)(&result, &n, x, &incx, y, &incy);
+  return result;
+#else
+  return fortran_name(zdotu, ZDOTU)(&n, x, &incx, y, &incy);
+#endif
+
+}
+
+/** \brief            Dot product with the conjugate of the first vector
+ *
+ *  x**H * y
+ *
+ *  For real types this is xDOT().
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        x
+ *
+ *  \param[in]        incx
+ *
+ *  \param[in]        y
+ *
+ *  \param[in]        incy
+ *
+ *  \returns          The dot product
+ *
+ *  See [ZDOTC](http://www.mathkeisan.com/usersguide/man/zdotc.html)
+ */
+inline S_t xDOTC(I_t n, S_t* x, I_t incx, S_t* y, I_t incy) {
+
+  PROFILING_FUNCTION_HEADER
+
+  return fortran_name(sdot, SDOT)(&n, x, &incx, y, &incy);
+
+}
+/** \overload
+ */
+inline D_t xDOTC(I_t n, D_t* x, I_t incx, D_t* y, I_t incy) {
+
+  PROFILING_FUNCTION_HEADER
+
+  return fortran_name(ddot, DDOT)(&n, x, &incx, y, &incy);
+
+}
+/** \overload
+ */
+inline C_t xDOTC(I_t n, C_t* x, I_t incx, C_t* y, I_t incy) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifdef HAVE_MKL
+  C_t result;
+  fortran_name(cdotc, CDOTC)(&result, &n, x, &incx, y, &incy);
+  return result;
+#else
+  return fortran_name(cdotc, CDOTC)(&n, x, &incx, y, &incy);
+#endif
+
+}
+/** \overload
+ */
+inline Z_t xDOTC(I_t n, Z_t* x, I_t incx, Z_t* y, I_t incy) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifdef HAVE_MKL
+  Z_t result;
+  fortran_name(zdotc, ZDOTC)(&result, &n, x, &incx, y, &incy);
+  return result;
+#else
+  return fortran_name(zdotc, ZDOTC)(&n, x, &incx, y, &incy);
+#endif
+
+}
+
+} /* namespace LinAlg::BLAS::FORTRAN */
+
+#ifdef HAVE_CUDA
+namespace cuBLAS {
+
+/** \brief            Dot product
+ *
+ *  result = x**T * y
+ *
+ *  \param[in]        handle
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        x
+ *
+ *  \param[in]        incx
+ *
+ *  \param[in]        y
+ *
+ *  \param[in]        incy
+ *
+ *  \param[out]       result
+ *
+ *  See [cuBLAS Documentation](http://docs.nvidia.com/cuda/cublas/)
+ */
+inline void xDOT(cublasHandle_t handle, I_t n, const S_t* x, I_t incx,
+                 const S_t* y, I_t incy, S_t* result) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasSdot(handle, n, x, incx, y, incy, result));
+
+}
+/** \overload
+ */
+inline void xDOT(cublasHandle_t handle, I_t n, const D_t* x, I_t incx,
+                 const D_t* y, I_t incy, D_t* result) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasDdot(handle, n, x, incx, y, incy, result));
+
+}
+/** \overload
+ */
+inline void xDOT(cublasHandle_t handle, I_t n, const C_t* x, I_t incx,
+                 const C_t* y, I_t incy, C_t* result) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasCdotu(handle, n, (const cuComplex*)x, incx, \
+                          (const cuComplex*)y, incy, (cuComplex*)result));
+
+}
+/** \overload
+ */
+inline void xDOT(cublasHandle_t handle, I_t n, const Z_t* x, I_t incx,
+                 const Z_t* y, I_t incy, Z_t* result) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasZdotu(handle, n, (const cuDoubleComplex*)x, incx, \
+                          (const cuDoubleComplex*)y, incy, \
+                          (cuDoubleComplex*)result));
+
+}
+
+/** \brief            Dot product with the conjugate of the first vector
+ *
+ *  result = x**H * y
+ *
+ *  \param[in]        handle
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        x
+ *
+ *  \param[in]        incx
+ *
+ *  \param[in]        y
+ *
+ *  \param[in]        incy
+ *
+ *  \param[out]       result
+ *
+ *  See [cuBLAS Documentation](http://docs.nvidia.com/cuda/cublas/)
+ */
+inline void xDOTC(cublasHandle_t handle, I_t n, const S_t* x, I_t incx,
+                  const S_t* y, I_t incy, S_t* result) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasSdot(handle, n, x, incx, y, incy, result));
+
+}
+/** \overload
+ */
+inline void xDOTC(cublasHandle_t handle, I_t n, const D_t* x, I_t incx,
+                  const D_t* y, I_t incy, D_t* result) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasDdot(handle, n, x, incx, y, incy, result));
+
+}
+/** \overload
+ */
+inline void xDOTC(cublasHandle_t handle, I_t n, const C_t* x, I_t incx,
+                  const C_t* y, I_t incy, C_t* result) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasCdotc(handle, n, (const cuComplex*)x, incx, \
+                          (const cuComplex*)y, incy, (cuComplex*)result));
+
+}
+/** \overload
+ */
+inline void xDOTC(cublasHandle_t handle, I_t n, const Z_t* x, I_t incx,
+                  const Z_t* y, I_t incy, Z_t* result) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasZdotc(handle, n, (const cuDoubleComplex*)x, incx, \
+                          (const cuDoubleComplex*)y, incy, \
+                          (cuDoubleComplex*)result));
+
+}
+
+} /* namespace LinAlg::BLAS::cuBLAS */
+#endif /* HAVE_CUDA */
+
+using LinAlg::Utilities::check_device;
+using LinAlg::Utilities::check_format;
+using LinAlg::Utilities::check_vector;
+using LinAlg::Utilities::check_stream_alive;
+#ifdef HAVE_CUDA
+using LinAlg::Utilities::check_gpu_structures;
+using LinAlg::Utilities::check_stream_prefer_native;
+using LinAlg::Utilities::check_stream_device_id;
+using LinAlg::CUDA::cuBLAS::prepare_cublas;
+using LinAlg::CUDA::cuBLAS::finish_cublas;
+#endif
+
+#ifndef DOXYGEN_SKIP
+// Shared implementation of xDOT() and xDOTC() (and their _async variants on
+// the GPU). The result is written to host memory, the cuBLAS call returns
+// after the result is available.
+template <typename T>
+inline T dot(bool conjugate, const Dense<T>& x, const Dense<T>& y,
+             Stream* stream, const char* caller_name) {
+
+#ifndef LINALG_NO_CHECKS
+  check_device(x, y, caller_name);
+  check_format(Format::ColMajor, x, caller_name);
+  check_format(Format::ColMajor, y, caller_name);
+  check_vector(-1, x, caller_name);
+  check_vector(vector_length(x), y, caller_name);
+#endif
+
+  auto location = x._location;
+  auto device_id = x._device_id;
+  auto n = vector_length(x);
+  auto x_ptr = x._begin();
+  auto incx = vector_increment(x);
+  auto y_ptr = y._begin();
+  auto incy = vector_increment(y);
+  T    result = cast<T>(0.0);
+
+  if (location == Location::host) {
+
+    result = (conjugate) ? FORTRAN::xDOTC(n, x_ptr, incx, y_ptr, incy)
+                         : FORTRAN::xDOT(n, x_ptr, incx, y_ptr, incy);
+
+  }
+#ifdef HAVE_CUDA
+  else if (location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_gpu_structures(caller_name);
+# endif
+
+    int               prev_device = 0;
+    cudaStream_t      prev_cuda_stream;
+    Stream*           stream_ = stream;
+
+# ifndef USE_LOCAL_STREAMS
+    if (stream_ == nullptr) {
+      stream_ = &(LinAlg::CUDA::compute_stream[device_id]);
+    }
+# else
+    Stream my_stream(device_id);
+    if (stream_ == nullptr) stream_ = &my_stream;
+# endif
+
+    auto handle = prepare_cublas(*stream_, &prev_device, &prev_cuda_stream);
+
+    if (conjugate) {
+      BLAS::cuBLAS::xDOTC(*handle, n, x_ptr, incx, y_ptr, incy, &result);
+    } else {
+      BLAS::cuBLAS::xDOT(*handle, n, x_ptr, incx, y_ptr, incy, &result);
+    }
+    finish_cublas(*stream_, &prev_device, &prev_cuda_stream, handle);
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    std::string message = caller_name;
+    message = message + ": BLAS-1 DOT not supported on selected location";
+    throw excUnimplemented(message);
+
+  }
+#endif
+
+  return result;
+
+}
+
+// Shared implementation of xDOT_async() and xDOTC_async()
+template <typename T>
+inline I_t dot_async(bool conjugate, const Dense<T>& x, const Dense<T>& y,
+                     T& result, Stream& stream, const char* caller_name) {
+
+  I_t ticket = 0;
+
+  if (x._location == Location::host && !stream.synchronous) {
+
+#ifndef LINALG_NO_CHECKS
+    check_stream_alive(stream, caller_name);
+#endif
+
+    // Arguments passed by copy, ensures memory lifetime but callee can't
+    // modify the arguments anymore. The result is written through a pointer
+    auto result_ptr = &result;
+    auto task = [=]() mutable {
+      *result_ptr = dot(conjugate, x, y, nullptr, caller_name);
+    };
+
+    ticket = stream.add(std::move(task));
+
+  } else if (x._location == Location::host) {
+
+    result = dot(conjugate, x, y, nullptr, caller_name);
+
+  }
+#ifdef HAVE_CUDA
+  else if (x._location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_stream_prefer_native(stream, caller_name);
+    check_stream_device_id(stream, x._device_id, caller_name);
+# endif
+
+    result = dot(conjugate, x, y, &stream, caller_name);
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    std::string message = caller_name;
+    message = message + ": BLAS-1 DOT not supported on selected location";
+    throw excUnimplemented(message);
+
+  }
+#endif
+
+  return ticket;
+
+}
+#endif /* DOXYGEN_SKIP */
+
+// Convenience bindings (bindings for Dense<T>)
+/** \brief            Dot product
+ *
+ *  x**T * y
+ *
+ *  \param[in]        x
+ *                    Vector (one row or one column).
+ *
+ *  \param[in]        y
+ *                    Vector of the same length as x.
+ *
+ *  \returns          The dot product
+ */
+template <typename T>
+inline T xDOT(const Dense<T>& x, const Dense<T>& y) {
+
+  PROFILING_FUNCTION_HEADER
+
+  return dot(false, x, y, nullptr, "xDOT()");
+
+}
+
+/** \brief            Dot product with the conjugate of the first vector
+ *
+ *  x**H * y
+ *
+ *  \param[in]        x
+ *                    Vector (one row or one column).
+ *
+ *  \param[in]        y
+ *                    Vector of the same length as x.
+ *
+ *  \returns          The dot product
+ */
+template <typename T>
+inline T xDOTC(const Dense<T>& x, const Dense<T>& y) {
+
+  PROFILING_FUNCTION_HEADER
+
+  return dot(true, x, y, nullptr, "xDOTC()");
+
+}
+
+/** \brief            Asynchronous dot product
+ *
+ *  result = x**T * y
+ *
+ *  On the GPU the result is copied to result before returning (the returned
+ *  ticket is 0).
+ *
+ *  \param[in]        x
+ *
+ *  \param[in]        y
+ *
+ *  \param[out]       result
+ *                    Must stay valid until the operation completed.
+ *
+ *  \param[in]        stream
+ *
+ *  \returns          The ticket number for the operation on the stream
+ */
+template <typename T>
+inline I_t xDOT_async(const Dense<T>& x, const Dense<T>& y, T& result,
+                      Stream& stream) {
+
+  PROFILING_FUNCTION_HEADER
+
+  return dot_async(false, x, y, result, stream, "xDOT_async()");
+
+}
+
+/** \brief            Asynchronous dot product with the conjugate of the first
+ *                    vector
+ *
+ *  result = x**H * y
+ *
+ *  On the GPU the result is copied to result before returning (the returned
+ *  ticket is 0).
+ *
+ *  \param[in]        x
+ *
+ *  \param[in]        y
+ *
+ *  \param[out]       result
+ *                    Must stay valid until the operation completed.
+ *
+ *  \param[in]        stream
+ *
+ *  \returns          The ticket number for the operation on the stream
+ */
+template <typename T>
+inline I_t xDOTC_async(const Dense<T>& x, const Dense<T>& y, T& result,
+                       Stream& stream) {
+
+  PROFILING_FUNCTION_HEADER
+
+  return dot_async(true, x, y, result, stream, "xDOTC_async()");
+
+}
+
+} /* namespace LinAlg::BLAS */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_BLAS_DOT_H_ */
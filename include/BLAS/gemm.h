@@ -19,8 +19,24 @@
  *
  *    LinAlg::BLAS::<NAME>
  *        bindings to the <NAME> BLAS backend
+ *
+ *  On the host, xGEMM() calls the BLAS library's ?gemm unless USE_NATIVE_GEMM 
+ *  is defined, in which case LinAlg's own implementation in native/gemm.h is 
+ *  used. Tiny products (m, n and k up to LINALG_FIXED_GEMM_MAX) use the 
+ *  fixed size kernels in native/gemm_fixed.h in either case. Real x complex 
+ *  products use MKL's ?zgemm if available, native/gemm_mixed.h if 
+ *  USE_NATIVE_GEMM is defined and otherwise two real products of the BLAS 
+ *  library with the complex operand split into real and imaginary parts.
+ *
+ *  xGEMM3M() computes complex products with the 3M method (MKL's ?gemm3m if 
+ *  available, native/gemm3m.h otherwise). xGEMM() uses it for large complex 
+ *  products if LINALG_GEMM3M_THRESHOLD is defined.
  */
 
+#include <algorithm>    // std::min, std::max
+#include <utility>      // std::move
+#include <vector>       // std::vector
+
 #include "../preprocessor.h"
 
 #ifdef HAVE_CUDA
@@ -41,6 +57,10 @@
 #include "../utilities/checks.h"
 #include "../streams.h"
 #include "../dense.h"
+#include "native/gemm.h"
+#include "native/gemm_fixed.h"
+#include "native/gemm_mixed.h"
+#include "native/gemm3m.h"
 
 #ifndef DOXYGEN_SKIP
 extern "C" {
@@ -84,6 +104,18 @@ extern "C" {
                                     const I_t* lda, const Z_t* B, 
                                     const I_t* ldb, const Z_t* beta, Z_t* C, 
                                     const I_t* ldc);
+  void fortran_name(cgemm3m, CGEMM3M)(const char* transa, const char* transb, 
+                                      const I_t* m, const I_t* n, const I_t* k,
+                                      const C_t* alpha, const C_t* A, 
+                                      const I_t* lda, const C_t* B, 
+                                      const I_t* ldb, const C_t* beta, C_t* C,
+                                      const I_t* ldc);
+  void fortran_name(zgemm3m, ZGEMM3M)(const char* transa, const char* transb, 
+                                      const I_t* m, const I_t* n, const I_t* k,
+                                      const Z_t* alpha, const Z_t* A, 
+                                      const I_t* lda, const Z_t* B, 
+                                      const I_t* ldb, const Z_t* beta, Z_t* C,
+                                      const I_t* ldc);
 #endif
 }
 #endif /* DOXYGEN_SKIP */
@@ -222,6 +254,58 @@ inline void xGEMM(char transa, char transb, int m, int n, int k, Z_t alpha,
 
 }
 
+/** \brief            General complex matrix-matrix multiply using the 3M 
+ *                    method
+ *
+ *  C = alpha * op(A) * op(B) + beta * C
+ *
+ *  \param[in]        transa
+ *
+ *  \param[in]        transb
+ *
+ *  \param[in]        m
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        k
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        ldb
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        ldc
+ */
+inline void xGEMM3M(char transa, char transb, int m, int n, int k, C_t alpha,
+                    C_t* A, int lda, C_t* B, int ldb, C_t beta, C_t* C, 
+                    int ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(cgemm3m, CGEMM3M)(&transa, &transb, &m, &n, &k, &alpha, A, &lda,
+                                 B, &ldb, &beta, C, &ldc);
+
+}
+inline void xGEMM3M(char transa, char transb, int m, int n, int k, Z_t alpha,
+                    Z_t* A, int lda, Z_t* B, int ldb, Z_t beta, Z_t* C, 
+                    int ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(zgemm3m, ZGEMM3M)(&transa, &transb, &m, &n, &k, &alpha, A, &lda,
+                                 B, &ldb, &beta, C, &ldc);
+
+}
+
 } /* namespace LinAlg::BLAS::MKL */
 #endif /* HAVE_MKL */
 
@@ -324,15 +408,122 @@ inline void xGEMM(cublasHandle_t handle, cublasOperation_t transa,
 
 using LinAlg::Utilities::check_device;
 using LinAlg::Utilities::check_output_transposed;
+using LinAlg::Utilities::check_stream_alive;
 #ifdef HAVE_CUDA
 using LinAlg::Utilities::check_gpu_structures;
 using LinAlg::Utilities::check_stream_prefer_native;
 using LinAlg::Utilities::check_stream_device_id;
-using LinAlg::Utilities::check_stream_alive;
 using LinAlg::CUDA::cuBLAS::prepare_cublas;
 using LinAlg::CUDA::cuBLAS::finish_cublas;
 #endif
 
+#ifndef DOXYGEN_SKIP
+// 3M product in main memory (T complex): MKL's ?gemm3m if available, the 
+// native implementation otherwise
+template <typename T>
+inline void gemm3m_host(char transa, char transb, I_t m, I_t n, I_t k,
+                        T alpha, T* A, I_t lda, T* B, I_t ldb, T beta, T* C,
+                        I_t ldc) {
+#ifdef HAVE_MKL
+  MKL::xGEMM3M(transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+#else
+  NATIVE::xGEMM3M(transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C,
+                  ldc);
+#endif
+}
+
+// Selection of the 3M method by xGEMM(): computes the product with it and 
+// returns true for complex products with m, n and k all at least 
+// LINALG_GEMM3M_THRESHOLD, returns false otherwise
+template <typename T>
+inline bool gemm3m_select(char transa, char transb, I_t m, I_t n, I_t k,
+                          T alpha, T* A, I_t lda, T* B, I_t ldb, T beta,
+                          T* C, I_t ldc) {
+  return false;
+}
+#ifdef LINALG_GEMM3M_THRESHOLD
+inline bool gemm3m_select(char transa, char transb, I_t m, I_t n, I_t k,
+                          C_t alpha, C_t* A, I_t lda, C_t* B, I_t ldb,
+                          C_t beta, C_t* C, I_t ldc) {
+  if (std::min(std::min(m, n), k) < LINALG_GEMM3M_THRESHOLD) return false;
+  gemm3m_host(transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+  return true;
+}
+inline bool gemm3m_select(char transa, char transb, I_t m, I_t n, I_t k,
+                          Z_t alpha, Z_t* A, I_t lda, Z_t* B, I_t ldb,
+                          Z_t beta, Z_t* C, I_t ldc) {
+  if (std::min(std::min(m, n), k) < LINALG_GEMM3M_THRESHOLD) return false;
+  gemm3m_host(transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+  return true;
+}
+#endif
+
+// Real and imaginary parts of the rows x cols matrix X (negated imaginary
+// parts if conjugate) into real_part and imag_part (leading dimension rows)
+template <typename U, typename R>
+inline void gemm_split(I_t rows, I_t cols, const U* X, I_t ldx, bool conjugate,
+                       R* real_part, R* imag_part) {
+  R sign = conjugate ? R(-1) : R(1);
+  for (I_t col = 0; col < cols; ++col) {
+    for (I_t row = 0; row < rows; ++row) {
+      real_part[row + col * rows] = real(X[row + col * ldx]);
+      imag_part[row + col * rows] = sign * imag(X[row + col * ldx]);
+    }
+  }
+}
+
+// C = alpha * P_real + i * alpha * P_imag + beta * C (C isn't read if beta is
+// 0), P_real and P_imag are m x n with leading dimension m
+template <typename U, typename R>
+inline void gemm_join(I_t m, I_t n, U alpha, const R* P_real,
+                      const R* P_imag, U beta, U* C, I_t ldc) {
+  for (I_t col = 0; col < n; ++col) {
+    for (I_t row = 0; row < m; ++row) {
+      auto product = alpha * cast<U>(P_real[row + col * m],
+                                     P_imag[row + col * m]);
+      auto& c = C[row + col * ldc];
+      c = (beta == cast<U>(0.0)) ? product : product + beta * c;
+    }
+  }
+}
+
+// Real x complex product in main memory with the BLAS library: the complex
+// operand B is split into real and imaginary parts (as done by multiply()),
+// followed by two real ?gemm. Arguments as for NATIVE::xGEMM_mixed()
+template <typename U>
+inline void gemm_mixed_split(char transa, char transb, I_t m, I_t n, I_t k,
+                             U alpha, const typename RealType<U>::type* A,
+                             I_t lda, const U* B, I_t ldb, U beta, U* C,
+                             I_t ldc) {
+
+  typedef typename RealType<U>::type R;
+
+  if (m <= 0 || n <= 0) return;
+
+  auto B_rows = (transb == 'N') ? k : n;
+  auto B_cols = (transb == 'N') ? n : k;
+  auto ld     = std::max(B_rows, I_t(1));
+
+  // |B_real|B_imag|P_real|P_imag|
+  std::vector<R> work(2 * ld * B_cols + 2 * m * n);
+  auto B_real = work.data();
+  auto B_imag = B_real + ld * B_cols;
+  auto P_real = B_imag + ld * B_cols;
+  auto P_imag = P_real + m * n;
+
+  gemm_split(B_rows, B_cols, B, ldb, transb == 'C', B_real, B_imag);
+  if (transb == 'C') transb = 'T';
+
+  FORTRAN::xGEMM(transa, transb, m, n, k, R(1), const_cast<R*>(A), lda, B_real,
+                 ld, R(0), P_real, m);
+  FORTRAN::xGEMM(transa, transb, m, n, k, R(1), const_cast<R*>(A), lda, B_imag,
+                 ld, R(0), P_imag, m);
+
+  gemm_join(m, n, alpha, P_real, P_imag, beta, C, ldc);
+
+}
+#endif /* DOXYGEN_SKIP */
+
 // Convenience bindings (bindings for Dense<T>)
 /** \brief            General matrix-matrix multiply
  *
@@ -383,8 +574,21 @@ inline void xGEMM(const T alpha, const Dense<T>& A, const Dense<T>& B,
     char transa = (A._transposed) ? 'T' : 'N';
     char transb = (B._transposed) ? 'T' : 'N';
 
+    // Tiny products don't pay for the library call
+    if (NATIVE::xGEMM_fixed(transa, transb, m, n, k, alpha, A_ptr, lda, B_ptr,
+                            ldb, beta, C_ptr, ldc)) return;
+
+    // Large complex products with the 3M method if enabled
+    if (gemm3m_select(transa, transb, m, n, k, alpha, A_ptr, lda, B_ptr, ldb,
+                      beta, C_ptr, ldc)) return;
+
+#ifdef USE_NATIVE_GEMM
+    NATIVE::xGEMM(transa, transb, m, n, k, alpha, A_ptr, lda, B_ptr, ldb, beta,
+                  C_ptr, ldc);
+#else
     FORTRAN::xGEMM(transa, transb, m, n, k, alpha, A_ptr, lda, B_ptr, ldb, beta,
                    C_ptr, ldc);
+#endif
 
   }
 #ifdef HAVE_CUDA
@@ -437,8 +641,9 @@ template <typename T, typename U, typename V>
 inline void xGEMM(const T alpha, const Dense<U>& A, const Dense<V>& B,
                   const V beta, Dense<V>& C) {
 
-  // This is the most general case that is only supported on the CPU if we 
-  // have MKL support
+  // This is the most general case that is only supported on the CPU (using 
+  // MKL's ?zgemm if available, the native implementation with 
+  // USE_NATIVE_GEMM, two real products of the BLAS library otherwise)
 
   PROFILING_FUNCTION_HEADER
 
@@ -459,17 +664,6 @@ inline void xGEMM(const T alpha, const Dense<U>& A, const Dense<V>& B,
                            "in main memory (see BLAS/gemm.h)");
   
   }
-#ifndef HAVE_MKL
-  throw excUnimplemented("xGEMM(alpha, A, B, beta, C): the most general case "
-                         "of this operation (alpha complex, beta complex != 1) "
-                         "is only supported when using MKL (see BLAS/gemm.h)");
-#endif
-#else /* LINALG_NO_CHECKS */
-#ifndef HAVE_MKL
-  std::printf("xGEMM(alpha, A, B, beta, C): real-complex requires MKL, "
-              "returning\n");
-  return;
-#endif
 #endif /* not LINALG_NO_CHECKS */
 
 #ifdef HAVE_MKL
@@ -489,6 +683,13 @@ inline void xGEMM(const T alpha, const Dense<U>& A, const Dense<V>& B,
 
   MKL::xGEMM(transa, transb, m, n, k, cast<V>(alpha), A_ptr, lda, B_ptr, ldb, 
              cast<V>(beta), C_ptr, ldc);
+#elif defined(USE_NATIVE_GEMM)
+  NATIVE::xGEMM_mixed(cast<V>(alpha), A, B, beta, C);
+#else
+  gemm_mixed_split(A._transposed ? 'T' : 'N', B._transposed ? 'T' : 'N',
+                   C.rows(), C.cols(), A.cols(), cast<V>(alpha), A._begin(),
+                   A._leading_dimension, B._begin(), B._leading_dimension,
+                   beta, C._begin(), C._leading_dimension);
 #endif
 
 }
@@ -550,8 +751,19 @@ inline I_t xGEMM_async(const T alpha, const Dense<T>& A, const Dense<T>& B,
       char transa = (A._transposed) ? 'T' : 'N';
       char transb = (B._transposed) ? 'T' : 'N';
 
+      if (NATIVE::xGEMM_fixed(transa, transb, m, n, k, alpha, A_ptr, lda, 
+                              B_ptr, ldb, beta, C_ptr, ldc)) return ticket;
+
+      if (gemm3m_select(transa, transb, m, n, k, alpha, A_ptr, lda, B_ptr, 
+                        ldb, beta, C_ptr, ldc)) return ticket;
+
+#ifdef USE_NATIVE_GEMM
+      NATIVE::xGEMM(transa, transb, m, n, k, alpha, A_ptr, lda, B_ptr, ldb, 
+                    beta, C_ptr, ldc);
+#else
       FORTRAN::xGEMM(transa, transb, m, n, k, alpha, A_ptr, lda, B_ptr, ldb, 
                      beta, C_ptr, ldc);
+#endif
 
     } else {
     
@@ -565,7 +777,7 @@ inline I_t xGEMM_async(const T alpha, const Dense<T>& A, const Dense<T>& B,
       // modify the arguments anymore
       auto task = [=]() mutable { xGEMM(alpha, A, B, beta, C); };
 
-      ticket = stream.add(task);
+      ticket = stream.add(std::move(task));
 
     }
 
@@ -614,8 +826,8 @@ template <typename T, typename U, typename V>
 inline I_t xGEMM_async(const T alpha, const Dense<U>& A, const Dense<V>& B,
                        const V beta, Dense<V>& C, Stream& stream) {
 
-  // This is the most general case that is only supported on the CPU if we 
-  // have MKL support
+  // This is the most general case that is only supported on the CPU (see 
+  // xGEMM())
 
   PROFILING_FUNCTION_HEADER
 
@@ -636,72 +848,150 @@ inline I_t xGEMM_async(const T alpha, const Dense<U>& A, const Dense<V>& B,
                            "for matrices in main memory (see BLAS/gemm.h)");
   
   }
-# ifndef HAVE_MKL
-  throw excUnimplemented("xGEMM_async(alpha, A, B, beta, C): the most "
-                         "general case of this operation (alpha complex, beta "
-                         "complex != 1) is only supported when using MKL "
-                         "(see BLAS/gemm.h)");
-# endif
-#else /* LINALG_NO_CHECKS */
-# ifndef HAVE_MKL
-  std::printf("xGEMM_async(alpha, A, B, beta, C): real-complex requires MKL, "
-              "returning\n");
-  return;
-# endif
 #endif /* not LINALG_NO_CHECKS */
 
   I_t ticket = 0;
 
-#ifdef HAVE_MKL
-  auto location = A._location;
-  auto device_id = A._device_id;
-  auto m = A.rows();
-  auto n = B.cols();
-  auto k = B.rows();
-  auto A_ptr = A._begin();
-  auto lda = A._leading_dimension;
-  auto B_ptr = B._begin();
-  auto ldb = B._leading_dimension;
-  auto C_ptr = C._begin();
-  auto ldc = C._leading_dimension;
-
-  if (location == Location::host) {
-
-    char transa = (A._transposed) ? 'T' : 'N';
-    char transb = (B._transposed) ? 'T' : 'N';
+  if (A._location == Location::host) {
 
     if (stream.synchronous) {
-      
-      MKL::xGEMM(transa, transb, m, n, k, cast<V>(alpha), A_ptr, lda, B_ptr, 
-                 ldb, beta, C_ptr, ldc);
+
+      xGEMM(alpha, A, B, beta, C);
 
     } else {
 
       // Create a task using the synchronous variant
 
-# ifndef LINALG_NO_CHECKS
+#ifndef LINALG_NO_CHECKS
       check_stream_alive(stream, "xGEMM_async()");
-# endif
+#endif
 
       // Arguments passed by copy, ensures memory lifetime but callee can't 
       // modify the arguments anymore
       auto task = [=]() mutable { xGEMM(alpha, A, B, beta, C); };
 
-      ticket = stream.add(task);
+      ticket = stream.add(std::move(task));
 
     }
 
   }
-# ifndef LINALG_NO_CHECKS
+#ifndef LINALG_NO_CHECKS
   else {
 
     throw excUnimplemented("xGEMM_async(): BLAS-3 GEMM not supported on "
                            "selected location");
 
   }
-# endif
+#endif
 
-#endif /* HAVE_MKL */
+  return ticket;
+
+}
+
+/** \brief            General complex matrix-matrix multiply using the 3M 
+ *                    method
+ *
+ *  C = alpha * op(A) * op(B) + beta * C
+ *
+ *  Three real products instead of four, which saves 25% of the arithmetic 
+ *  for C_t and Z_t at a somewhat larger error in the imaginary part (see 
+ *  native/gemm3m.h). In main memory MKL's ?gemm3m is used if available, 
+ *  otherwise the native implementation. On other locations this is 
+ *  xGEMM(). To use the method for all large products, define 
+ *  LINALG_GEMM3M_THRESHOLD (see preprocessor.h).
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ */
+template <typename T>
+inline void xGEMM3M(const T alpha, const Dense<T>& A, const Dense<T>& B,
+                    const T beta, Dense<T>& C) {
+
+  PROFILING_FUNCTION_HEADER
+
+  if (A._location != Location::host) {
+    xGEMM(alpha, A, B, beta, C);
+    return;
+  }
+
+#ifndef LINALG_NO_CHECKS
+  check_device(A, B, C, "xGEMM3M(alpha, A, B, beta, C)");
+  check_output_transposed(C, "xGEMM3M(alpha, A, B, beta, C)");
+
+  if (A.rows() != C.rows() || A.cols() != B.rows() || B.cols() != C.cols()) {
+    throw excBadArgument("xGEMM3M(alpha, A, B, beta, C), A, B, C: argument "
+                         "matrix size mismatch (A:%dx%d B:%dx%d C:%dx%d)",
+                         A.rows(), A.cols(), B.rows(), B.cols(), C.rows(),
+                         C.cols());
+  }
+#endif
+
+  gemm3m_host(A._transposed ? 'T' : 'N', B._transposed ? 'T' : 'N', A.rows(),
+              B.cols(), B.rows(), alpha, A._begin(), A._leading_dimension,
+              B._begin(), B._leading_dimension, beta, C._begin(),
+              C._leading_dimension);
+
+}
+
+/** \brief            General asynchronous complex matrix-matrix multiply 
+ *                    using the 3M method
+ *
+ *  C = alpha * op(A) * op(B) + beta * C
+ *
+ *  See xGEMM3M(), on other locations than the host this is xGEMM_async().
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        stream
+ *
+ *  \returns          The ticket number for the operation on the stream
+ */
+template <typename T>
+inline I_t xGEMM3M_async(const T alpha, const Dense<T>& A, const Dense<T>& B,
+                         const T beta, Dense<T>& C, Stream& stream) {
+
+  PROFILING_FUNCTION_HEADER
+
+  if (A._location != Location::host) {
+    return xGEMM_async(alpha, A, B, beta, C, stream);
+  }
+
+  I_t ticket = 0;
+
+  if (stream.synchronous) {
+
+    xGEMM3M(alpha, A, B, beta, C);
+
+  } else {
+
+    // Create a task using the synchronous variant
+
+#ifndef LINALG_NO_CHECKS
+    check_stream_alive(stream, "xGEMM3M_async()");
+#endif
+
+    // Arguments passed by copy, ensures memory lifetime but callee can't 
+    // modify the arguments anymore
+    auto task = [=]() mutable { xGEMM3M(alpha, A, B, beta, C); };
+
+    ticket = stream.add(std::move(task));
+
+  }
 
   return ticket;
 
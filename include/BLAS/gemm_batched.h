@@ -0,0 +1,511 @@
+/** \file
+ *
+ *  \brief            xGEMM_batched, xGEMM_strided_batched (BLAS-3 like)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_BLAS_GEMM_BATCHED_H_
+#define LINALG_BLAS_GEMM_BATCHED_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::BLAS
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *    LinAlg::BLAS::<NAME>
+ *        bindings to the <NAME> BLAS backend
+ *
+ *  On the host, the batched multiplies use the implementation in 
+ *  native/gemm_batched.h if USE_NATIVE_GEMM is defined, MKL's 
+ *  cblas_?gemm_batch and cblas_?gemm_batch_strided if HAVE_MKL is defined 
+ *  and otherwise the BLAS library's ?gemm for each product, with the 
+ *  products distributed over the threads.
+ */
+
+#include <vector>       // std::vector
+
+#include "../preprocessor.h"
+#include "../types.h"
+
+#ifdef HAVE_MKL
+# include <mkl.h>    // need to have types.h before mkl.h
+#endif
+
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../utilities/checks.h"
+#include "../dense.h"
+#include "../executor.h"
+#include "gemm.h"
+#include "native/gemm_batched.h"
+
+namespace LinAlg {
+
+namespace BLAS {
+
+#ifdef HAVE_MKL
+namespace MKL {
+
+/** \brief            Batch of general matrix-matrix multiplies in groups of
+ *                    equal parameters
+ *
+ *  C_i = alpha_g * op(A_i) * op(B_i) + beta_g * C_i
+ *
+ *  where the products are split into group_count groups of group_size[g]
+ *  consecutive products, all with the parameters at index g of the
+ *  parameter arrays.
+ *
+ *  \param[in]        transa
+ *
+ *  \param[in]        transb
+ *
+ *  \param[in]        m
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        k
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        ldb
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        ldc
+ *
+ *  \param[in]        group_count
+ *
+ *  \param[in]        group_size
+ *
+ *  See MKL Documentation for cblas_?gemm_batch
+ */
+inline void xGEMM_batched(const CBLAS_TRANSPOSE* transa,
+                          const CBLAS_TRANSPOSE* transb, const I_t* m,
+                          const I_t* n, const I_t* k, const S_t* alpha,
+                          const S_t** A, const I_t* lda, const S_t** B,
+                          const I_t* ldb, const S_t* beta, S_t** C,
+                          const I_t* ldc, I_t group_count,
+                          const I_t* group_size) {
+
+  PROFILING_FUNCTION_HEADER
+
+  cblas_sgemm_batch(CblasColMajor, transa, transb, m, n, k, alpha, A, lda, B,
+                    ldb, beta, C, ldc, group_count, group_size);
+
+}
+/** \overload
+ */
+inline void xGEMM_batched(const CBLAS_TRANSPOSE* transa,
+                          const CBLAS_TRANSPOSE* transb, const I_t* m,
+                          const I_t* n, const I_t* k, const D_t* alpha,
+                          const D_t** A, const I_t* lda, const D_t** B,
+                          const I_t* ldb, const D_t* beta, D_t** C,
+                          const I_t* ldc, I_t group_count,
+                          const I_t* group_size) {
+
+  PROFILING_FUNCTION_HEADER
+
+  cblas_dgemm_batch(CblasColMajor, transa, transb, m, n, k, alpha, A, lda, B,
+                    ldb, beta, C, ldc, group_count, group_size);
+
+}
+/** \overload
+ */
+inline void xGEMM_batched(const CBLAS_TRANSPOSE* transa,
+                          const CBLAS_TRANSPOSE* transb, const I_t* m,
+                          const I_t* n, const I_t* k, const C_t* alpha,
+                          const C_t** A, const I_t* lda, const C_t** B,
+                          const I_t* ldb, const C_t* beta, C_t** C,
+                          const I_t* ldc, I_t group_count,
+                          const I_t* group_size) {
+
+  PROFILING_FUNCTION_HEADER
+
+  cblas_cgemm_batch(CblasColMajor, transa, transb, m, n, k, alpha,
+                    (const void**)A, lda, (const void**)B, ldb, beta,
+                    (void**)C, ldc, group_count, group_size);
+
+}
+/** \overload
+ */
+inline void xGEMM_batched(const CBLAS_TRANSPOSE* transa,
+                          const CBLAS_TRANSPOSE* transb, const I_t* m,
+                          const I_t* n, const I_t* k, const Z_t* alpha,
+                          const Z_t** A, const I_t* lda, const Z_t** B,
+                          const I_t* ldb, const Z_t* beta, Z_t** C,
+                          const I_t* ldc, I_t group_count,
+                          const I_t* group_size) {
+
+  PROFILING_FUNCTION_HEADER
+
+  cblas_zgemm_batch(CblasColMajor, transa, transb, m, n, k, alpha,
+                    (const void**)A, lda, (const void**)B, ldb, beta,
+                    (void**)C, ldc, group_count, group_size);
+
+}
+
+/** \brief            Batch of general matrix-matrix multiplies with
+ *                    equidistant operands
+ *
+ *  C_i = alpha * op(A_i) * op(B_i) + beta * C_i, i = 0 .. batch - 1
+ *
+ *  with A_i = A + i * stride_a, B_i = B + i * stride_b and
+ *  C_i = C + i * stride_c.
+ *
+ *  \param[in]        transa
+ *
+ *  \param[in]        transb
+ *
+ *  \param[in]        m
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        k
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in]        stride_a
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        ldb
+ *
+ *  \param[in]        stride_b
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        ldc
+ *
+ *  \param[in]        stride_c
+ *
+ *  \param[in]        batch
+ *
+ *  See MKL Documentation for cblas_?gemm_batch_strided
+ */
+inline void xGEMM_strided_batched(CBLAS_TRANSPOSE transa,
+                                  CBLAS_TRANSPOSE transb, I_t m, I_t n,
+                                  I_t k, S_t alpha, const S_t* A, I_t lda,
+                                  I_t stride_a, const S_t* B, I_t ldb,
+                                  I_t stride_b, S_t beta, S_t* C, I_t ldc,
+                                  I_t stride_c, I_t batch) {
+
+  PROFILING_FUNCTION_HEADER
+
+  cblas_sgemm_batch_strided(CblasColMajor, transa, transb, m, n, k, alpha, A,
+                            lda, stride_a, B, ldb, stride_b, beta, C, ldc,
+                            stride_c, batch);
+
+}
+/** \overload
+ */
+inline void xGEMM_strided_batched(CBLAS_TRANSPOSE transa,
+                                  CBLAS_TRANSPOSE transb, I_t m, I_t n,
+                                  I_t k, D_t alpha, const D_t* A, I_t lda,
+                                  I_t stride_a, const D_t* B, I_t ldb,
+                                  I_t stride_b, D_t beta, D_t* C, I_t ldc,
+                                  I_t stride_c, I_t batch) {
+
+  PROFILING_FUNCTION_HEADER
+
+  cblas_dgemm_batch_strided(CblasColMajor, transa, transb, m, n, k, alpha, A,
+                            lda, stride_a, B, ldb, stride_b, beta, C, ldc,
+                            stride_c, batch);
+
+}
+/** \overload
+ */
+inline void xGEMM_strided_batched(CBLAS_TRANSPOSE transa,
+                                  CBLAS_TRANSPOSE transb, I_t m, I_t n,
+                                  I_t k, C_t alpha, const C_t* A, I_t lda,
+                                  I_t stride_a, const C_t* B, I_t ldb,
+                                  I_t stride_b, C_t beta, C_t* C, I_t ldc,
+                                  I_t stride_c, I_t batch) {
+
+  PROFILING_FUNCTION_HEADER
+
+  cblas_cgemm_batch_strided(CblasColMajor, transa, transb, m, n, k, &alpha,
+                            A, lda, stride_a, B, ldb, stride_b, &beta, C,
+                            ldc, stride_c, batch);
+
+}
+/** \overload
+ */
+inline void xGEMM_strided_batched(CBLAS_TRANSPOSE transa,
+                                  CBLAS_TRANSPOSE transb, I_t m, I_t n,
+                                  I_t k, Z_t alpha, const Z_t* A, I_t lda,
+                                  I_t stride_a, const Z_t* B, I_t ldb,
+                                  I_t stride_b, Z_t beta, Z_t* C, I_t ldc,
+                                  I_t stride_c, I_t batch) {
+
+  PROFILING_FUNCTION_HEADER
+
+  cblas_zgemm_batch_strided(CblasColMajor, transa, transb, m, n, k, &alpha,
+                            A, lda, stride_a, B, ldb, stride_b, &beta, C,
+                            ldc, stride_c, batch);
+
+}
+
+#ifndef DOXYGEN_SKIP
+inline CBLAS_TRANSPOSE cblas_transpose(char trans) {
+  switch (trans) {
+    case 'T': case 't': return CblasTrans;
+    case 'C': case 'c': return CblasConjTrans;
+    default:            return CblasNoTrans;
+  }
+}
+#endif
+
+} /* namespace LinAlg::BLAS::MKL */
+#endif /* HAVE_MKL */
+
+using LinAlg::Utilities::check_output_transposed;
+
+// Convenience bindings (bindings for Dense<T>)
+/** \brief            Batch of general matrix-matrix multiplies in main
+ *                    memory
+ *
+ *  C[i] = alpha * A[i] * B[i] + beta * C[i], i = 0 .. C.size() - 1
+ *
+ *  For many small products, where calling xGEMM() for each of them would
+ *  mostly measure the call overhead: the arguments are checked once and 
+ *  the products are passed to MKL in a single call or distributed over the 
+ *  threads, each calling the BLAS library's ?gemm (or, with 
+ *  USE_NATIVE_GEMM, see NATIVE::xGEMM_batched()). The products may have 
+ *  different sizes.
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ *                    The matrices must not overlap.
+ *
+ *  \param[in]        n_threads
+ *                    OPTIONAL: maximal number of threads, <= 0 uses all
+ *                    hardware threads. Ignored when using MKL. Default: 0.
+ */
+template <typename T>
+inline void xGEMM_batched(const T alpha, const std::vector<Dense<T>>& A,
+                          const std::vector<Dense<T>>& B, const T beta,
+                          std::vector<Dense<T>>& C, int n_threads = 0) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifdef USE_NATIVE_GEMM
+
+  NATIVE::xGEMM_batched(alpha, A, B, beta, C, n_threads);
+
+#else
+
+  auto batch = I_t(C.size());
+  double work = 0;
+
+# ifndef LINALG_NO_CHECKS
+  if (A.size() != C.size() || B.size() != C.size()) {
+    throw excBadArgument("xGEMM_batched(alpha, A, B, beta, C), A, B, C: "
+                         "batch size mismatch (A:%d B:%d C:%d)",
+                         int(A.size()), int(B.size()), int(C.size()));
+  }
+# endif
+
+  for (I_t i = 0; i < batch; ++i) {
+# ifndef LINALG_NO_CHECKS
+    check_output_transposed(C[i], "xGEMM_batched(alpha, A, B, beta, C)");
+    if (A[i].rows() != C[i].rows() || A[i].cols() != B[i].rows() ||
+        B[i].cols() != C[i].cols()) {
+      throw excBadArgument("xGEMM_batched(alpha, A, B, beta, C), A, B, C: "
+                           "argument matrix size mismatch in product %d "
+                           "(A:%dx%d B:%dx%d C:%dx%d)", i, A[i].rows(),
+                           A[i].cols(), B[i].rows(), B[i].cols(),
+                           C[i].rows(), C[i].cols());
+    }
+    if (A[i]._location != Location::host ||
+        B[i]._location != Location::host ||
+        C[i]._location != Location::host) {
+      throw excUnimplemented("xGEMM_batched(): batched GEMM only supported "
+                             "in main memory");
+    }
+# endif
+    work += double(C[i].rows()) * C[i].cols() * A[i].cols();
+  }
+
+  if (batch == 0) return;
+
+# ifdef HAVE_MKL
+
+  // One group per product
+  std::vector<CBLAS_TRANSPOSE> transa(batch), transb(batch);
+  std::vector<I_t>             m(batch), n(batch), k(batch), lda(batch),
+                               ldb(batch), ldc(batch), group_size(batch, 1);
+  std::vector<const T*>        A_ptr(batch), B_ptr(batch);
+  std::vector<T*>              C_ptr(batch);
+  std::vector<T>               alphas(batch, alpha), betas(batch, beta);
+
+  for (I_t i = 0; i < batch; ++i) {
+    transa[i] = A[i]._transposed ? CblasTrans : CblasNoTrans;
+    transb[i] = B[i]._transposed ? CblasTrans : CblasNoTrans;
+    m[i]      = C[i].rows();
+    n[i]      = C[i].cols();
+    k[i]      = A[i].cols();
+    A_ptr[i]  = A[i]._begin();
+    lda[i]    = A[i]._leading_dimension;
+    B_ptr[i]  = B[i]._begin();
+    ldb[i]    = B[i]._leading_dimension;
+    C_ptr[i]  = C[i]._begin();
+    ldc[i]    = C[i]._leading_dimension;
+  }
+
+  MKL::xGEMM_batched(transa.data(), transb.data(), m.data(), n.data(),
+                     k.data(), alphas.data(), A_ptr.data(), lda.data(),
+                     B_ptr.data(), ldb.data(), betas.data(), C_ptr.data(),
+                     ldc.data(), batch, group_size.data());
+
+# else
+
+  auto threads = NATIVE::gemm_batch_threads(work, batch, n_threads);
+
+  Threads::parallel_for(batch, [&](I_t first, I_t last) {
+    for (auto i = first; i < last; ++i) {
+      FORTRAN::xGEMM(A[i]._transposed ? 'T' : 'N',
+                     B[i]._transposed ? 'T' : 'N', C[i].rows(), C[i].cols(),
+                     A[i].cols(), alpha, A[i]._begin(),
+                     A[i]._leading_dimension, B[i]._begin(),
+                     B[i]._leading_dimension, beta, C[i]._begin(),
+                     C[i]._leading_dimension);
+    }
+  }, threads);
+
+# endif /* HAVE_MKL */
+
+#endif /* USE_NATIVE_GEMM */
+
+}
+
+/** \brief            Batch of general matrix-matrix multiplies with
+ *                    equidistant operands in main memory
+ *
+ *  C_i = alpha * op(A_i) * op(B_i) + beta * C_i, i = 0 .. batch - 1
+ *
+ *  with A_i = A + i * stride_a, B_i = B + i * stride_b and
+ *  C_i = C + i * stride_c. Uses NATIVE::xGEMM_strided_batched() if 
+ *  USE_NATIVE_GEMM is defined, MKL's cblas_?gemm_batch_strided if 
+ *  available and otherwise the BLAS library's ?gemm for each product (with 
+ *  the products distributed over the threads).
+ *
+ *  \param[in]        transa
+ *                    'N', 'T' or 'C'.
+ *
+ *  \param[in]        transb
+ *                    'N', 'T' or 'C'.
+ *
+ *  \param[in]        m
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        k
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in]        stride_a
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        ldb
+ *
+ *  \param[in]        stride_b
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        ldc
+ *
+ *  \param[in]        stride_c
+ *
+ *  \param[in]        batch
+ *
+ *  \param[in]        n_threads
+ *                    OPTIONAL: maximal number of threads, <= 0 uses all
+ *                    hardware threads. Ignored when using MKL. Default: 0.
+ */
+template <typename T>
+inline void xGEMM_strided_batched(char transa, char transb, I_t m, I_t n,
+                                  I_t k, T alpha, const T* A, I_t lda,
+                                  I_t stride_a, const T* B, I_t ldb,
+                                  I_t stride_b, T beta, T* C, I_t ldc,
+                                  I_t stride_c, I_t batch,
+                                  int n_threads = 0) {
+
+  PROFILING_FUNCTION_HEADER
+
+#if defined(USE_NATIVE_GEMM)
+  NATIVE::xGEMM_strided_batched(transa, transb, m, n, k, alpha, A, lda,
+                                stride_a, B, ldb, stride_b, beta, C, ldc,
+                                stride_c, batch, n_threads);
+#elif defined(HAVE_MKL)
+  if (batch <= 0) return;
+  MKL::xGEMM_strided_batched(MKL::cblas_transpose(transa),
+                             MKL::cblas_transpose(transb), m, n, k, alpha, A,
+                             lda, stride_a, B, ldb, stride_b, beta, C, ldc,
+                             stride_c, batch);
+#else
+# ifndef LINALG_NO_CHECKS
+  auto valid = [](char trans) {
+    return trans == 'N' || trans == 'n' || trans == 'T' || trans == 't' ||
+           trans == 'C' || trans == 'c';
+  };
+  if (!valid(transa) || !valid(transb)) {
+    throw excBadArgument("xGEMM_strided_batched(): invalid transposition "
+                         "('%c', '%c')", transa, transb);
+  }
+# endif
+
+  if (batch <= 0 || m <= 0 || n <= 0) return;
+
+  auto threads = NATIVE::gemm_batch_threads(double(m) * n * k * batch, batch,
+                                            n_threads);
+
+  Threads::parallel_for(batch, [&](I_t first, I_t last) {
+    for (auto i = first; i < last; ++i) {
+      FORTRAN::xGEMM(transa, transb, m, n, k, alpha,
+                     const_cast<T*>(A) + i * stride_a, lda,
+                     const_cast<T*>(B) + i * stride_b, ldb, beta,
+                     C + i * stride_c, ldc);
+    }
+  }, threads);
+#endif
+
+}
+
+} /* namespace LinAlg::BLAS */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_BLAS_GEMM_BATCHED_H_ */
@@ -0,0 +1,453 @@
+/** \file
+ *
+ *  \brief            xGEMV (BLAS-2)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_BLAS_GEMV_H_
+#define LINALG_BLAS_GEMV_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::BLAS
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *    LinAlg::BLAS::<NAME>
+ *        bindings to the <NAME> BLAS backend
+ */
+
+#include <utility>      // std::move
+
+#include "../preprocessor.h"
+
+#ifdef HAVE_CUDA
+# include <cuda_runtime.h>
+# include <cublas_v2.h>
+# include "../CUDA/cuda_checks.h"
+# include "../CUDA/cuda_cublas.h"
+#endif
+
+#include "../types.h"
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../utilities/checks.h"
+#include "../streams.h"
+#include "../dense.h"
+#include "vector_layout.h"
+
+#ifndef DOXYGEN_SKIP
+extern "C" {
+
+  using LinAlg::I_t;
+  using LinAlg::S_t;
+  using LinAlg::D_t;
+  using LinAlg::C_t;
+  using LinAlg::Z_t;
+
+  void fortran_name(sgemv, SGEMV)(const char* trans, const I_t* m,
+                                  const I_t* n, const S_t* alpha, const S_t* A,
+                                  const I_t* lda, const S_t* x,
+                                  const I_t* incx, const S_t* beta, S_t* y,
+                                  const I_t* incy);
+  void fortran_name(dgemv, DGEMV)(const char* trans, const I_t* m,
+                                  const I_t* n, const D_t* alpha, const D_t* A,
+                                  const I_t* lda, const D_t* x,
+                                  const I_t* incx, const D_t* beta, D_t* y,
+                                  const I_t* incy);
+  void fortran_name(cgemv, CGEMV)(const char* trans, const I_t* m,
+                                  const I_t* n, const C_t* alpha, const C_t* A,
+                                  const I_t* lda, const C_t* x,
+                                  const I_t* incx, const C_t* beta, C_t* y,
+                                  const I_t* incy);
+  void fortran_name(zgemv, ZGEMV)(const char* trans, const I_t* m,
+                                  const I_t* n, const Z_t* alpha, const Z_t* A,
+                                  const I_t* lda, const Z_t* x,
+                                  const I_t* incx, const Z_t* beta, Z_t* y,
+                                  const I_t* incy);
+}
+#endif /* DOXYGEN_SKIP */
+
+namespace LinAlg {
+
+namespace BLAS {
+
+namespace FORTRAN {
+
+/** \brief            General matrix-vector multiply
+ *
+ *  y = alpha * op(A) * x + beta * y
+ *
+ *  \param[in]        trans
+ *
+ *  \param[in]        m
+ *                    Rows of A (as stored).
+ *
+ *  \param[in]        n
+ *                    Columns of A (as stored).
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in]        x
+ *
+ *  \param[in]        incx
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    y
+ *
+ *  \param[in]        incy
+ *
+ *  See [DGEMV](http://www.mathkeisan.com/usersguide/man/dgemv.html)
+ */
+inline void xGEMV(char trans, int m, int n, S_t alpha, S_t* A, int lda,
+                  S_t* x, int incx, S_t beta, S_t* y, int incy) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(sgemv, SGEMV)(&trans, &m, &n, &alpha, A, &lda, x, &incx, &beta,
+                             y, &incy);
+
+}
+/** \overload
+ */
+inline void xGEMV(char trans, int m, int n, D_t alpha, D_t* A, int lda,
+                  D_t* x, int incx, D_t beta, D_t* y, int incy) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(dgemv, DGEMV)(&trans, &m, &n, &alpha, A, &lda, x, &incx, &beta,
+                             y, &incy);
+
+}
+/** \overload
+ */
+inline void xGEMV(char trans, int m, int n, C_t alpha, C_t* A, int lda,
+                  C_t* x, int incx, C_t beta, C_t* y, int incy) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(cgemv, CGEMV)(&trans, &m, &n, &alpha, A, &lda, x, &incx, &beta,
+                             y, &incy);
+
+}
+/** \overload
+ */
+inline void xGEMV(char trans, int m, int n, Z_t alpha, Z_t* A, int lda,
+                  Z_t* x, int incx, Z_t beta, Z_t* y, int incy) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(zgemv, ZGEMV)(&trans, &m, &n, &alpha, A, &lda, x, &incx, &beta,
+                             y, &incy);
+
+}
+
+} /* namespace LinAlg::BLAS::FORTRAN */
+
+#ifdef HAVE_CUDA
+namespace cuBLAS {
+
+/** \brief            General matrix-vector multiply
+ *
+ *  y = alpha * op(A) * x + beta * y
+ *
+ *  \param[in]        handle
+ *
+ *  \param[in]        trans
+ *
+ *  \param[in]        m
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in]        x
+ *
+ *  \param[in]        incx
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    y
+ *
+ *  \param[in]        incy
+ *
+ *  See [cuBLAS Documentation](http://docs.nvidia.com/cuda/cublas/)
+ */
+inline void xGEMV(cublasHandle_t handle, cublasOperation_t trans, I_t m,
+                  I_t n, const S_t* alpha, const S_t* A, I_t lda,
+                  const S_t* x, I_t incx, const S_t* beta, S_t* y, I_t incy) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasSgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, \
+                          y, incy));
+
+}
+/** \overload
+ */
+inline void xGEMV(cublasHandle_t handle, cublasOperation_t trans, I_t m,
+                  I_t n, const D_t* alpha, const D_t* A, I_t lda,
+                  const D_t* x, I_t incx, const D_t* beta, D_t* y, I_t incy) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasDgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, \
+                          y, incy));
+
+}
+/** \overload
+ */
+inline void xGEMV(cublasHandle_t handle, cublasOperation_t trans, I_t m,
+                  I_t n, const C_t* alpha, const C_t* A, I_t lda,
+                  const C_t* x, I_t incx, const C_t* beta, C_t* y, I_t incy) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasCgemv(handle, trans, m, n, (const cuComplex*)alpha, \
+                          (const cuComplex*)A, lda, (const cuComplex*)x, \
+                          incx, (const cuComplex*)beta, (cuComplex*)y, incy));
+
+}
+/** \overload
+ */
+inline void xGEMV(cublasHandle_t handle, cublasOperation_t trans, I_t m,
+                  I_t n, const Z_t* alpha, const Z_t* A, I_t lda,
+                  const Z_t* x, I_t incx, const Z_t* beta, Z_t* y, I_t incy) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasZgemv(handle, trans, m, n, \
+                          (const cuDoubleComplex*)alpha, \
+                          (const cuDoubleComplex*)A, lda, \
+                          (const cuDoubleComplex*)x, incx, \
+                          (const cuDoubleComplex*)beta, \
+                          (cuDoubleComplex*)y, incy));
+
+}
+
+} /* namespace LinAlg::BLAS::cuBLAS */
+#endif /* HAVE_CUDA */
+
+using LinAlg::Utilities::check_device;
+using LinAlg::Utilities::check_format;
+using LinAlg::Utilities::check_vector;
+using LinAlg::Utilities::check_stream_alive;
+#ifdef HAVE_CUDA
+using LinAlg::Utilities::check_gpu_structures;
+using LinAlg::Utilities::check_stream_prefer_native;
+using LinAlg::Utilities::check_stream_device_id;
+using LinAlg::CUDA::cuBLAS::prepare_cublas;
+using LinAlg::CUDA::cuBLAS::finish_cublas;
+#endif
+
+#ifndef DOXYGEN_SKIP
+// Argument checks shared by xGEMV() and xGEMV_async()
+template <typename T>
+inline void check_gemv(const Dense<T>& A, const Dense<T>& x,
+                       const Dense<T>& y, const char* caller_name) {
+  check_device(A, x, y, caller_name);
+  check_format(Format::ColMajor, A, caller_name);
+  check_format(Format::ColMajor, x, caller_name);
+  check_format(Format::ColMajor, y, caller_name);
+  check_vector(A.cols(), x, caller_name);
+  check_vector(A.rows(), y, caller_name);
+}
+#endif /* DOXYGEN_SKIP */
+
+// Convenience bindings (bindings for Dense<T>)
+/** \brief            General matrix-vector multiply
+ *
+ *  y = alpha * A * x + beta * y
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        x
+ *                    Vector (one row or one column) of length A.cols().
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    y
+ *                    Vector (one row or one column) of length A.rows().
+ */
+template <typename T>
+inline void xGEMV(const T alpha, const Dense<T>& A, const Dense<T>& x,
+                  const T beta, Dense<T>& y) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_gemv(A, x, y, "xGEMV()");
+#endif
+
+  auto location = A._location;
+  auto device_id = A._device_id;
+  auto m = A._rows;
+  auto n = A._cols;
+  auto A_ptr = A._begin();
+  auto lda = A._leading_dimension;
+  auto x_ptr = x._begin();
+  auto incx = vector_increment(x);
+  auto y_ptr = y._begin();
+  auto incy = vector_increment(y);
+
+  if (location == Location::host) {
+
+    char trans = (A._transposed) ? 'T' : 'N';
+
+    FORTRAN::xGEMV(trans, m, n, alpha, A_ptr, lda, x_ptr, incx, beta, y_ptr,
+                   incy);
+
+  }
+#ifdef HAVE_CUDA
+  else if (location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_gpu_structures("xGEMV()");
+# endif
+
+    auto trans = (A._transposed) ? CUBLAS_OP_T : CUBLAS_OP_N;
+
+    int               prev_device = 0;
+    cudaStream_t      prev_cuda_stream;
+    Stream*           stream_;
+
+# ifndef USE_LOCAL_STREAMS
+    stream_ = &(LinAlg::CUDA::compute_stream[device_id]);
+# else
+    Stream my_stream(device_id);
+    stream_ = &my_stream;
+# endif
+
+    auto handle = prepare_cublas(*stream_, &prev_device, &prev_cuda_stream);
+    BLAS::cuBLAS::xGEMV(*handle, trans, m, n, &alpha, A_ptr, lda, x_ptr, incx,
+                        &beta, y_ptr, incy);
+    finish_cublas(*stream_, &prev_device, &prev_cuda_stream, handle);
+
+    stream_->sync_cuda();
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    throw excUnimplemented("xGEMV(): BLAS-2 GEMV not supported on selected "
+                           "location");
+
+  }
+#endif
+
+}
+
+/** \brief            Asynchronous general matrix-vector multiply
+ *
+ *  y = alpha * A * x + beta * y
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        x
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    y
+ *
+ *  \param[in]        stream
+ *
+ *  \returns          The ticket number for the operation on the stream
+ */
+template <typename T>
+inline I_t xGEMV_async(const T alpha, const Dense<T>& A, const Dense<T>& x,
+                       const T beta, Dense<T>& y, Stream& stream) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_gemv(A, x, y, "xGEMV_async()");
+#endif
+
+  I_t ticket = 0;
+
+  auto location = A._location;
+  auto device_id = A._device_id;
+
+  if (location == Location::host) {
+
+    if (stream.synchronous) {
+
+      xGEMV(alpha, A, x, beta, y);
+
+    } else {
+
+      // Create a task using the synchronous variant
+
+#ifndef LINALG_NO_CHECKS
+      check_stream_alive(stream, "xGEMV_async()");
+#endif
+
+      // Arguments passed by copy, ensures memory lifetime but callee can't
+      // modify the arguments anymore
+      auto task = [=]() mutable { xGEMV(alpha, A, x, beta, y); };
+
+      ticket = stream.add(std::move(task));
+
+    }
+
+  }
+#ifdef HAVE_CUDA
+  else if (location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_gpu_structures("xGEMV_async()");
+    check_stream_prefer_native(stream, "xGEMV_async()");
+    check_stream_device_id(stream, device_id, "xGEMV_async()");
+# endif
+
+    auto trans = (A._transposed) ? CUBLAS_OP_T : CUBLAS_OP_N;
+
+    int               prev_device = 0;
+    cudaStream_t      prev_cuda_stream;
+
+    auto handle = prepare_cublas(stream, &prev_device, &prev_cuda_stream);
+    BLAS::cuBLAS::xGEMV(*handle, trans, A._rows, A._cols, &alpha, A._begin(),
+                        A._leading_dimension, x._begin(), vector_increment(x),
+                        &beta, y._begin(), vector_increment(y));
+    finish_cublas(stream, &prev_device, &prev_cuda_stream, handle);
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    throw excUnimplemented("xGEMV_async(): BLAS-2 GEMV not supported on "
+                           "selected location");
+
+  }
+#endif
+
+  return ticket;
+
+}
+
+} /* namespace LinAlg::BLAS */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_BLAS_GEMV_H_ */
@@ -0,0 +1,627 @@
+/** \file
+ *
+ *  \brief            xGER, xGERC (BLAS-2)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_BLAS_GER_H_
+#define LINALG_BLAS_GER_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::BLAS
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *    LinAlg::BLAS::<NAME>
+ *        bindings to the <NAME> BLAS backend
+ */
+
+#include <utility>      // std::move
+
+#include "../preprocessor.h"
+
+#ifdef HAVE_CUDA
+# include <cuda_runtime.h>
+# include <cublas_v2.h>
+# include "../CUDA/cuda_checks.h"
+# include "../CUDA/cuda_cublas.h"
+#endif
+
+#include "../types.h"
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../utilities/checks.h"
+#include "../streams.h"
+#include "../dense.h"
+#include "vector_layout.h"
+
+#ifndef DOXYGEN_SKIP
+extern "C" {
+
+  using LinAlg::I_t;
+  using LinAlg::S_t;
+  using LinAlg::D_t;
+  using LinAlg::C_t;
+  using LinAlg::Z_t;
+
+  void fortran_name(sger, SGER)(const I_t* m, const I_t* n, const S_t* alpha,
+                                const S_t* x, const I_t* incx, const S_t* y,
+                                const I_t* incy, S_t* A, const I_t* lda);
+  void fortran_name(dger, DGER)(const I_t* m, const I_t* n, const D_t* alpha,
+                                const D_t* x, const I_t* incx, const D_t* y,
+                                const I_t* incy, D_t* A, const I_t* lda);
+  void fortran_name(cgeru, CGERU)(const I_t* m, const I_t* n,
+                                  const C_t* alpha, const C_t* x,
+                                  const I_t* incx, const C_t* y,
+                                  const I_t* incy, C_t* A, const I_t* lda);
+  void fortran_name(zgeru, ZGERU)(const I_t* m, const I_t* n,
+                                  const Z_t* alpha, const Z_t* x,
+                                  const I_t* incx, const Z_t* y,
+                                  const I_t* incy, Z_t* A, const I_t* lda);
+  void fortran_name(cgerc, CGERC)(const I_t* m, const I_t* n,
+                                  const C_t* alpha, const C_t* x,
+                                  const I_t* incx, const C_t* y,
+                                  const I_t* incy, C_t* A, const I_t* lda);
+  void fortran_name(zgerc, ZGERC)(const I_t* m, const I_t* n,
+                                  const Z_t* alpha, const Z_t* x,
+                                  const I_t* incx, const Z_t* y,
+                                  const I_t* incy, Z_t* A, const I_t* lda);
+}
+#endif /* DOXYGEN_SKIP */
+
+namespace LinAlg {
+
+namespace BLAS {
+
+namespace FORTRAN {
+
+/** \brief            Rank-1 update
+ *
+ *  A = alpha * x * y**T + A
+ *
+ *  \param[in]        m
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        x
+ *
+ *  \param[in]        incx
+ *
+ *  \param[in]        y
+ *
+ *  \param[in]        incy
+ *
+ *  \param[in,out]    A
+ *
+ *  \param[in]        lda
+ *
+ *  See [DGER](http://www.mathkeisan.com/usersguide/man/dger.html)
+ */
+inline void xGER(I_t m, I_t n, S_t alpha, S_t* x, I_t incx, S_t* y, I_t incy,
+                 S_t* A, I_t lda) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(sger, SGER)(&m, &n, &alpha, x, &incx, y, &incy, A, &lda);
+
+}
+/** \overload
+ */
+inline void xGER(I_t m, I_t n, D_t alpha, D_t* x, I_t incx, D_t* y, I_t incy,
+                 D_t* A, I_t lda) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(dger, DGER)(&m, &n, &alpha, x, &incx, y, &incy, A, &lda);
+
+}
+/** \overload
+ */
+inline void xGER(I_t m, I_t n, C_t alpha, C_t* x, I_t incx, C_t* y, I_t incy,
+                 C_t* A, I_t lda) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(cgeru, CGERU)(&m, &n, &alpha, x, &incx, y, &incy, A, &lda);
+
+}
+/** \overload
+ */
+inline void xGER(I_t m, I_t n, Z_t alpha, Z_t* x, I_t incx, Z_t* y, I_t incy,
+                 Z_t* A, I_t lda) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(zgeru, ZGERU)(&m, &n, &alpha, x, &incx, y, &incy, A, &lda);
+
+}
+
+/** \brief            Rank-1 update with the conjugate of the second vector
+ *
+ *  A = alpha * x * y**H + A
+ *
+ *  For real types this is xGER().
+ *
+ *  \param[in]        m
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        x
+ *
+ *  \param[in]        incx
+ *
+ *  \param[in]        y
+ *
+ *  \param[in]        incy
+ *
+ *  \param[in,out]    A
+ *
+ *  \param[in]        lda
+ *
+ *  See [ZGERC](http://www.mathkeisan.com/usersguide/man/zgerc.html)
+ */
+inline void xGERC(I_t m, I_t n, S_t alpha, S_t* x, I_t incx, S_t* y,
+                  I_t incy, S_t* A, I_t lda) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(sger, SGER)(&m, &n, &alpha, x, &incx, y, &incy, A, &lda);
+
+}
+/** \overload
+ */
+inline void xGERC(I_t m, I_t n, D_t alpha, D_t* x, I_t incx, D_t* y,
+                  I_t incy, D_t* A, I_t lda) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(dger, DGER)(&m, &n, &alpha, x, &incx, y, &incy, A, &lda);
+
+}
+/** \overload
+ */
+inline void xGERC(I_t m, I_t n, C_t alpha, C_t* x, I_t incx, C_t* y,
+                  I_t incy, C_t* A, I_t lda) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(cgerc, CGERC)(&m, &n, &alpha, x, &incx, y, &incy, A, &lda);
+
+}
+/** \overload
+ */
+inline void xGERC(I_t m, I_t n, Z_t alpha, Z_t* x, I_t incx, Z_t* y,
+                  I_t incy, Z_t* A, I_t lda) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(zgerc, ZGERC)(&m, &n, &alpha, x, &incx, y, &incy, A, &lda);
+
+}
+
+} /* namespace LinAlg::BLAS::FORTRAN */
+
+#ifdef HAVE_CUDA
+namespace cuBLAS {
+
+/** \brief            Rank-1 update
+ *
+ *  A = alpha * x * y**T + A
+ *
+ *  \param[in]        handle
+ *
+ *  \param[in]        m
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        x
+ *
+ *  \param[in]        incx
+ *
+ *  \param[in]        y
+ *
+ *  \param[in]        incy
+ *
+ *  \param[in,out]    A
+ *
+ *  \param[in]        lda
+ *
+ *  See [cuBLAS Documentation](http://docs.nvidia.com/cuda/cublas/)
+ */
+inline void xGER(cublasHandle_t handle, I_t m, I_t n, const S_t* alpha,
+                 const S_t* x, I_t incx, const S_t* y, I_t incy, S_t* A,
+                 I_t lda) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasSger(handle, m, n, alpha, x, incx, y, incy, A, lda));
+
+}
+/** \overload
+ */
+inline void xGER(cublasHandle_t handle, I_t m, I_t n, const D_t* alpha,
+                 const D_t* x, I_t incx, const D_t* y, I_t incy, D_t* A,
+                 I_t lda) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasDger(handle, m, n, alpha, x, incx, y, incy, A, lda));
+
+}
+/** \overload
+ */
+inline void xGER(cublasHandle_t handle, I_t m, I_t n, const C_t* alpha,
+                 const C_t* x, I_t incx, const C_t* y, I_t incy, C_t* A,
+                 I_t lda) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasCgeru(handle, m, n, (const cuComplex*)alpha, \
+                          (const cuComplex*)x, incx, (const cuComplex*)y, \
+                          incy, (cuComplex*)A, lda));
+
+}
+/** \overload
+ */
+inline void xGER(cublasHandle_t handle, I_t m, I_t n, const Z_t* alpha,
+                 const Z_t* x, I_t incx, const Z_t* y, I_t incy, Z_t* A,
+                 I_t lda) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasZgeru(handle, m, n, (const cuDoubleComplex*)alpha, \
+                          (const cuDoubleComplex*)x, incx, \
+                          (const cuDoubleComplex*)y, incy, \
+                          (cuDoubleComplex*)A, lda));
+
+}
+
+/** \brief            Rank-1 update with the conjugate of the second vector
+ *
+ *  A = alpha * x * y**H + A
+ *
+ *  \param[in]        handle
+ *
+ *  \param[in]        m
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        x
+ *
+ *  \param[in]        incx
+ *
+ *  \param[in]        y
+ *
+ *  \param[in]        incy
+ *
+ *  \param[in,out]    A
+ *
+ *  \param[in]        lda
+ *
+ *  See [cuBLAS Documentation](http://docs.nvidia.com/cuda/cublas/)
+ */
+inline void xGERC(cublasHandle_t handle, I_t m, I_t n, const S_t* alpha,
+                  const S_t* x, I_t incx, const S_t* y, I_t incy, S_t* A,
+                  I_t lda) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasSger(handle, m, n, alpha, x, incx, y, incy, A, lda));
+
+}
+/** \overload
+ */
+inline void xGERC(cublasHandle_t handle, I_t m, I_t n, const D_t* alpha,
+                  const D_t* x, I_t incx, const D_t* y, I_t incy, D_t* A,
+                  I_t lda) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasDger(handle, m, n, alpha, x, incx, y, incy, A, lda));
+
+}
+/** \overload
+ */
+inline void xGERC(cublasHandle_t handle, I_t m, I_t n, const C_t* alpha,
+                  const C_t* x, I_t incx, const C_t* y, I_t incy, C_t* A,
+                  I_t lda) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasCgerc(handle, m, n, (const cuComplex*)alpha, \
+                          (const cuComplex*)x, incx, (const cuComplex*)y, \
+                          incy, (cuComplex*)A, lda));
+
+}
+/** \overload
+ */
+inline void xGERC(cublasHandle_t handle, I_t m, I_t n, const Z_t* alpha,
+                  const Z_t* x, I_t incx, const Z_t* y, I_t incy, Z_t* A,
+                  I_t lda) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasZgerc(handle, m, n, (const cuDoubleComplex*)alpha, \
+                          (const cuDoubleComplex*)x, incx, \
+                          (const cuDoubleComplex*)y, incy, \
+                          (cuDoubleComplex*)A, lda));
+
+}
+
+} /* namespace LinAlg::BLAS::cuBLAS */
+#endif /* HAVE_CUDA */
+
+using LinAlg::Utilities::check_device;
+using LinAlg::Utilities::check_format;
+using LinAlg::Utilities::check_vector;
+using LinAlg::Utilities::check_output_transposed;
+using LinAlg::Utilities::check_stream_alive;
+#ifdef HAVE_CUDA
+using LinAlg::Utilities::check_gpu_structures;
+using LinAlg::Utilities::check_stream_prefer_native;
+using LinAlg::Utilities::check_stream_device_id;
+using LinAlg::CUDA::cuBLAS::prepare_cublas;
+using LinAlg::CUDA::cuBLAS::finish_cublas;
+#endif
+
+#ifndef DOXYGEN_SKIP
+// Shared implementation of xGER() and xGERC(). On the GPU the update is
+// added to stream if given, otherwise it runs synchronously on the compute
+// stream.
+template <typename T>
+inline void ger(bool conjugate, const T alpha, const Dense<T>& x,
+                const Dense<T>& y, Dense<T>& A, Stream* stream,
+                const char* caller_name) {
+
+#ifndef LINALG_NO_CHECKS
+  check_device(x, y, A, caller_name);
+  check_format(Format::ColMajor, x, caller_name);
+  check_format(Format::ColMajor, y, caller_name);
+  check_format(Format::ColMajor, A, caller_name);
+  check_output_transposed(A, caller_name);
+  check_vector(A.rows(), x, caller_name);
+  check_vector(A.cols(), y, caller_name);
+#endif
+
+  auto location = A._location;
+  auto device_id = A._device_id;
+  auto m = A.rows();
+  auto n = A.cols();
+  auto x_ptr = x._begin();
+  auto incx = vector_increment(x);
+  auto y_ptr = y._begin();
+  auto incy = vector_increment(y);
+  auto A_ptr = A._begin();
+  auto lda = A._leading_dimension;
+
+  if (location == Location::host) {
+
+    if (conjugate) {
+      FORTRAN::xGERC(m, n, alpha, x_ptr, incx, y_ptr, incy, A_ptr, lda);
+    } else {
+      FORTRAN::xGER(m, n, alpha, x_ptr, incx, y_ptr, incy, A_ptr, lda);
+    }
+
+  }
+#ifdef HAVE_CUDA
+  else if (location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_gpu_structures(caller_name);
+# endif
+
+    int               prev_device = 0;
+    cudaStream_t      prev_cuda_stream;
+    Stream*           stream_ = stream;
+
+# ifndef USE_LOCAL_STREAMS
+    if (stream_ == nullptr) {
+      stream_ = &(LinAlg::CUDA::compute_stream[device_id]);
+    }
+# else
+    Stream my_stream(device_id);
+    if (stream_ == nullptr) stream_ = &my_stream;
+# endif
+
+    auto handle = prepare_cublas(*stream_, &prev_device, &prev_cuda_stream);
+    if (conjugate) {
+      BLAS::cuBLAS::xGERC(*handle, m, n, &alpha, x_ptr, incx, y_ptr, incy,
+                          A_ptr, lda);
+    } else {
+      BLAS::cuBLAS::xGER(*handle, m, n, &alpha, x_ptr, incx, y_ptr, incy,
+                         A_ptr, lda);
+    }
+    finish_cublas(*stream_, &prev_device, &prev_cuda_stream, handle);
+
+    if (stream == nullptr) stream_->sync_cuda();
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    std::string message = caller_name;
+    message = message + ": BLAS-2 GER not supported on selected location";
+    throw excUnimplemented(message);
+
+  }
+#endif
+
+}
+
+// Shared implementation of xGER_async() and xGERC_async()
+template <typename T>
+inline I_t ger_async(bool conjugate, const T alpha, const Dense<T>& x,
+                     const Dense<T>& y, Dense<T>& A, Stream& stream,
+                     const char* caller_name) {
+
+  I_t ticket = 0;
+
+  if (A._location == Location::host && !stream.synchronous) {
+
+#ifndef LINALG_NO_CHECKS
+    check_stream_alive(stream, caller_name);
+#endif
+
+    // Arguments passed by copy, ensures memory lifetime but callee can't
+    // modify the arguments anymore
+    auto task = [=]() mutable {
+      ger(conjugate, alpha, x, y, A, nullptr, caller_name);
+    };
+
+    ticket = stream.add(std::move(task));
+
+  } else if (A._location == Location::host) {
+
+    ger(conjugate, alpha, x, y, A, nullptr, caller_name);
+
+  }
+#ifdef HAVE_CUDA
+  else if (A._location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_stream_prefer_native(stream, caller_name);
+    check_stream_device_id(stream, A._device_id, caller_name);
+# endif
+
+    ger(conjugate, alpha, x, y, A, &stream, caller_name);
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    std::string message = caller_name;
+    message = message + ": BLAS-2 GER not supported on selected location";
+    throw excUnimplemented(message);
+
+  }
+#endif
+
+  return ticket;
+
+}
+#endif /* DOXYGEN_SKIP */
+
+// Convenience bindings (bindings for Dense<T>)
+/** \brief            Rank-1 update
+ *
+ *  A = alpha * x * y**T + A
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        x
+ *                    Vector (one row or one column) of length A.rows().
+ *
+ *  \param[in]        y
+ *                    Vector (one row or one column) of length A.cols().
+ *
+ *  \param[in,out]    A
+ */
+template <typename T>
+inline void xGER(const T alpha, const Dense<T>& x, const Dense<T>& y,
+                 Dense<T>& A) {
+
+  PROFILING_FUNCTION_HEADER
+
+  ger(false, alpha, x, y, A, nullptr, "xGER()");
+
+}
+
+/** \brief            Rank-1 update with the conjugate of the second vector
+ *
+ *  A = alpha * x * y**H + A
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        x
+ *                    Vector (one row or one column) of length A.rows().
+ *
+ *  \param[in]        y
+ *                    Vector (one row or one column) of length A.cols().
+ *
+ *  \param[in,out]    A
+ */
+template <typename T>
+inline void xGERC(const T alpha, const Dense<T>& x, const Dense<T>& y,
+                  Dense<T>& A) {
+
+  PROFILING_FUNCTION_HEADER
+
+  ger(true, alpha, x, y, A, nullptr, "xGERC()");
+
+}
+
+/** \brief            Asynchronous rank-1 update
+ *
+ *  A = alpha * x * y**T + A
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        x
+ *
+ *  \param[in]        y
+ *
+ *  \param[in,out]    A
+ *
+ *  \param[in]        stream
+ *
+ *  \returns          The ticket number for the operation on the stream
+ */
+template <typename T>
+inline I_t xGER_async(const T alpha, const Dense<T>& x, const Dense<T>& y,
+                      Dense<T>& A, Stream& stream) {
+
+  PROFILING_FUNCTION_HEADER
+
+  return ger_async(false, alpha, x, y, A, stream, "xGER_async()");
+
+}
+
+/** \brief            Asynchronous rank-1 update with the conjugate of the
+ *                    second vector
+ *
+ *  A = alpha * x * y**H + A
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        x
+ *
+ *  \param[in]        y
+ *
+ *  \param[in,out]    A
+ *
+ *  \param[in]        stream
+ *
+ *  \returns          The ticket number for the operation on the stream
+ */
+template <typename T>
+inline I_t xGERC_async(const T alpha, const Dense<T>& x, const Dense<T>& y,
+                       Dense<T>& A, Stream& stream) {
+
+  PROFILING_FUNCTION_HEADER
+
+  return ger_async(true, alpha, x, y, A, stream, "xGERC_async()");
+
+}
+
+} /* namespace LinAlg::BLAS */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_BLAS_GER_H_ */
@@ -0,0 +1,464 @@
+/** \file
+ *
+ *  \brief            xHEMM (BLAS-3)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_BLAS_HEMM_H_
+#define LINALG_BLAS_HEMM_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::BLAS
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *    LinAlg::BLAS::<NAME>
+ *        bindings to the <NAME> BLAS backend
+ */
+
+#include <utility>      // std::move
+
+#include "../preprocessor.h"
+
+#ifdef HAVE_CUDA
+# include <cuda_runtime.h>
+# include <cublas_v2.h>
+# include "../CUDA/cuda_checks.h"
+# include "../CUDA/cuda_cublas.h"
+#endif
+
+#include "../types.h"
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../utilities/checks.h"
+#include "../streams.h"
+#include "../dense.h"
+#include "symm.h"         // ?symm for real types, check_symm()
+
+#ifndef DOXYGEN_SKIP
+extern "C" {
+
+  using LinAlg::I_t;
+  using LinAlg::S_t;
+  using LinAlg::D_t;
+  using LinAlg::C_t;
+  using LinAlg::Z_t;
+
+  void fortran_name(chemm, CHEMM)(const char* side, const char* uplo,
+                                  const I_t* m, const I_t* n, const C_t* alpha,
+                                  const C_t* A, const I_t* lda, const C_t* B,
+                                  const I_t* ldb, const C_t* beta, C_t* C,
+                                  const I_t* ldc);
+  void fortran_name(zhemm, ZHEMM)(const char* side, const char* uplo,
+                                  const I_t* m, const I_t* n, const Z_t* alpha,
+                                  const Z_t* A, const I_t* lda, const Z_t* B,
+                                  const I_t* ldb, const Z_t* beta, Z_t* C,
+                                  const I_t* ldc);
+}
+#endif /* DOXYGEN_SKIP */
+
+namespace LinAlg {
+
+namespace BLAS {
+
+namespace FORTRAN {
+
+/** \brief            Hermitian matrix-matrix multiply
+ *
+ *  C = alpha * A * B + beta * C    (side = 'L')
+ *  C = alpha * B * A + beta * C    (side = 'R')
+ *
+ *  where A is hermitian and only its upper (uplo = 'U') or lower (uplo =
+ *  'L') triangle is referenced (the imaginary part of the diagonal is
+ *  assumed to be zero). For real types this is xSYMM().
+ *
+ *  \param[in]        side
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        m
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        ldb
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        ldc
+ *
+ *  See [ZHEMM](http://www.mathkeisan.com/usersguide/man/zhemm.html)
+ */
+inline void xHEMM(char side, char uplo, int m, int n, S_t alpha, S_t* A,
+                  int lda, S_t* B, int ldb, S_t beta, S_t* C, int ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(ssymm, SSYMM)(&side, &uplo, &m, &n, &alpha, A, &lda, B, &ldb,
+                             &beta, C, &ldc);
+
+}
+/** \overload
+ */
+inline void xHEMM(char side, char uplo, int m, int n, D_t alpha, D_t* A,
+                  int lda, D_t* B, int ldb, D_t beta, D_t* C, int ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(dsymm, DSYMM)(&side, &uplo, &m, &n, &alpha, A, &lda, B, &ldb,
+                             &beta, C, &ldc);
+
+}
+/** \overload
+ */
+inline void xHEMM(char side, char uplo, int m, int n, C_t alpha, C_t* A,
+                  int lda, C_t* B, int ldb, C_t beta, C_t* C, int ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(chemm, CHEMM)(&side, &uplo, &m, &n, &alpha, A, &lda, B, &ldb,
+                             &beta, C, &ldc);
+
+}
+/** \overload
+ */
+inline void xHEMM(char side, char uplo, int m, int n, Z_t alpha, Z_t* A,
+                  int lda, Z_t* B, int ldb, Z_t beta, Z_t* C, int ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(zhemm, ZHEMM)(&side, &uplo, &m, &n, &alpha, A, &lda, B, &ldb,
+                             &beta, C, &ldc);
+
+}
+
+} /* namespace LinAlg::BLAS::FORTRAN */
+
+#ifdef HAVE_CUDA
+namespace cuBLAS {
+
+/** \brief            Hermitian matrix-matrix multiply
+ *
+ *  C = alpha * A * B + beta * C    (side = CUBLAS_SIDE_LEFT)
+ *  C = alpha * B * A + beta * C    (side = CUBLAS_SIDE_RIGHT)
+ *
+ *  \param[in]        handle
+ *
+ *  \param[in]        side
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        m
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        ldb
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        ldc
+ *
+ *  See [cuBLAS Documentation](http://docs.nvidia.com/cuda/cublas/)
+ */
+inline void xHEMM(cublasHandle_t handle, cublasSideMode_t side,
+                  cublasFillMode_t uplo, I_t m, I_t n, const S_t* alpha,
+                  const S_t* A, I_t lda, const S_t* B, I_t ldb,
+                  const S_t* beta, S_t* C, I_t ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasSsymm(handle, side, uplo, m, n, alpha, A, lda, B, ldb, \
+                          beta, C, ldc));
+
+}
+/** \overload
+ */
+inline void xHEMM(cublasHandle_t handle, cublasSideMode_t side,
+                  cublasFillMode_t uplo, I_t m, I_t n, const D_t* alpha,
+                  const D_t* A, I_t lda, const D_t* B, I_t ldb,
+                  const D_t* beta, D_t* C, I_t ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasDsymm(handle, side, uplo, m, n, alpha, A, lda, B, ldb, \
+                          beta, C, ldc));
+
+}
+/** \overload
+ */
+inline void xHEMM(cublasHandle_t handle, cublasSideMode_t side,
+                  cublasFillMode_t uplo, I_t m, I_t n, const C_t* alpha,
+                  const C_t* A, I_t lda, const C_t* B, I_t ldb,
+                  const C_t* beta, C_t* C, I_t ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasChemm(handle, side, uplo, m, n, \
+                          (const cuComplex*)alpha, (const cuComplex*)A, lda, \
+                          (const cuComplex*)B, ldb, (const cuComplex*)beta, \
+                          (cuComplex*)C, ldc));
+
+}
+/** \overload
+ */
+inline void xHEMM(cublasHandle_t handle, cublasSideMode_t side,
+                  cublasFillMode_t uplo, I_t m, I_t n, const Z_t* alpha,
+                  const Z_t* A, I_t lda, const Z_t* B, I_t ldb,
+                  const Z_t* beta, Z_t* C, I_t ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasZhemm(handle, side, uplo, m, n, \
+                          (const cuDoubleComplex*)alpha, \
+                          (const cuDoubleComplex*)A, lda, \
+                          (const cuDoubleComplex*)B, ldb, \
+                          (const cuDoubleComplex*)beta, \
+                          (cuDoubleComplex*)C, ldc));
+
+}
+
+} /* namespace LinAlg::BLAS::cuBLAS */
+#endif /* HAVE_CUDA */
+
+using LinAlg::Utilities::check_input_transposed;
+using LinAlg::Utilities::check_stream_alive;
+#ifdef HAVE_CUDA
+using LinAlg::Utilities::check_gpu_structures;
+using LinAlg::Utilities::check_stream_prefer_native;
+using LinAlg::Utilities::check_stream_device_id;
+using LinAlg::CUDA::cuBLAS::prepare_cublas;
+using LinAlg::CUDA::cuBLAS::finish_cublas;
+#endif
+
+// Convenience bindings (bindings for Dense<T>)
+/** \brief            Hermitian matrix-matrix multiply
+ *
+ *  C = alpha * A * B + beta * C    (side = Side::left)
+ *  C = alpha * B * A + beta * C    (side = Side::right)
+ *
+ *  where A is hermitian and only the triangle given by uplo is read. Reads
+ *  half of A compared to xGEMM(), at the same number of operations. A must
+ *  not be transposed (its transpose is its complex conjugate). For real
+ *  types this is xSYMM().
+ *
+ *  \param[in]        side
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ */
+template <typename T>
+inline void xHEMM(Side side, UPLO uplo, const T alpha, const Dense<T>& A,
+                  const Dense<T>& B, const T beta, Dense<T>& C) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_symm(side, A, B, C, "xHEMM()");
+  check_input_transposed(A, "xHEMM()");
+#endif
+
+  auto location = A._location;
+  auto device_id = A._device_id;
+  auto m = C.rows();
+  auto n = C.cols();
+  auto A_ptr = A._begin();
+  auto lda = A._leading_dimension;
+  auto B_ptr = B._begin();
+  auto ldb = B._leading_dimension;
+  auto C_ptr = C._begin();
+  auto ldc = C._leading_dimension;
+
+  if (location == Location::host) {
+
+    char side_ = (side == Side::left)  ? 'L' : 'R';
+    char uplo_ = (uplo == UPLO::lower) ? 'L' : 'U';
+
+    FORTRAN::xHEMM(side_, uplo_, m, n, alpha, A_ptr, lda, B_ptr, ldb, beta,
+                   C_ptr, ldc);
+
+  }
+#ifdef HAVE_CUDA
+  else if (location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_gpu_structures("xHEMM()");
+# endif
+
+    auto side_ = (side == Side::left)  ? CUBLAS_SIDE_LEFT : CUBLAS_SIDE_RIGHT;
+    auto uplo_ = (uplo == UPLO::lower) ? CUBLAS_FILL_MODE_LOWER :
+                                         CUBLAS_FILL_MODE_UPPER;
+
+    int               prev_device = 0;
+    cudaStream_t      prev_cuda_stream;
+    Stream*           stream_;
+
+# ifndef USE_LOCAL_STREAMS
+    stream_ = &(LinAlg::CUDA::compute_stream[device_id]);
+# else
+    Stream my_stream(device_id);
+    stream_ = &my_stream;
+# endif
+
+    auto handle = prepare_cublas(*stream_, &prev_device, &prev_cuda_stream);
+    BLAS::cuBLAS::xHEMM(*handle, side_, uplo_, m, n, &alpha, A_ptr, lda,
+                        B_ptr, ldb, &beta, C_ptr, ldc);
+    finish_cublas(*stream_, &prev_device, &prev_cuda_stream, handle);
+
+    stream_->sync_cuda();
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    throw excUnimplemented("xHEMM(): BLAS-3 HEMM not supported on selected "
+                           "location");
+
+  }
+#endif
+
+}
+
+/** \brief            Asynchronous hermitian matrix-matrix multiply
+ *
+ *  C = alpha * A * B + beta * C    (side = Side::left)
+ *  C = alpha * B * A + beta * C    (side = Side::right)
+ *
+ *  where A is hermitian and only the triangle given by uplo is read.
+ *
+ *  \param[in]        side
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        stream
+ *
+ *  \returns          The ticket number for the operation on the stream
+ */
+template <typename T>
+inline I_t xHEMM_async(Side side, UPLO uplo, const T alpha, const Dense<T>& A,
+                       const Dense<T>& B, const T beta, Dense<T>& C,
+                       Stream& stream) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_symm(side, A, B, C, "xHEMM_async()");
+  check_input_transposed(A, "xHEMM_async()");
+#endif
+
+  I_t ticket = 0;
+
+  auto location = A._location;
+  auto device_id = A._device_id;
+
+  if (location == Location::host) {
+
+    if (stream.synchronous) {
+
+      xHEMM(side, uplo, alpha, A, B, beta, C);
+
+    } else {
+
+      // Create a task using the synchronous variant
+
+#ifndef LINALG_NO_CHECKS
+      check_stream_alive(stream, "xHEMM_async()");
+#endif
+
+      // Arguments passed by copy, ensures memory lifetime but callee can't
+      // modify the arguments anymore
+      auto task = [=]() mutable { xHEMM(side, uplo, alpha, A, B, beta, C); };
+
+      ticket = stream.add(std::move(task));
+
+    }
+
+  }
+#ifdef HAVE_CUDA
+  else if (location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_gpu_structures("xHEMM_async()");
+    check_stream_prefer_native(stream, "xHEMM_async()");
+    check_stream_device_id(stream, device_id, "xHEMM_async()");
+# endif
+
+    auto side_ = (side == Side::left)  ? CUBLAS_SIDE_LEFT : CUBLAS_SIDE_RIGHT;
+    auto uplo_ = (uplo == UPLO::lower) ? CUBLAS_FILL_MODE_LOWER :
+                                         CUBLAS_FILL_MODE_UPPER;
+
+    int               prev_device = 0;
+    cudaStream_t      prev_cuda_stream;
+
+    auto handle = prepare_cublas(stream, &prev_device, &prev_cuda_stream);
+    BLAS::cuBLAS::xHEMM(*handle, side_, uplo_, C.rows(), C.cols(), &alpha,
+                        A._begin(), A._leading_dimension, B._begin(),
+                        B._leading_dimension, &beta, C._begin(),
+                        C._leading_dimension);
+    finish_cublas(stream, &prev_device, &prev_cuda_stream, handle);
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    throw excUnimplemented("xHEMM_async(): BLAS-3 HEMM not supported on "
+                           "selected location");
+
+  }
+#endif
+
+  return ticket;
+
+}
+
+} /* namespace LinAlg::BLAS */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_BLAS_HEMM_H_ */
@@ -0,0 +1,437 @@
+/** \file
+ *
+ *  \brief            xHERK (BLAS-3)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_BLAS_HERK_H_
+#define LINALG_BLAS_HERK_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::BLAS
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *    LinAlg::BLAS::<NAME>
+ *        bindings to the <NAME> BLAS backend
+ */
+
+#include <utility>      // std::move
+
+#include "../preprocessor.h"
+
+#ifdef HAVE_CUDA
+# include <cuda_runtime.h>
+# include <cublas_v2.h>
+# include "../CUDA/cuda_checks.h"
+# include "../CUDA/cuda_cublas.h"
+#endif
+
+#include "../types.h"
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../utilities/checks.h"
+#include "../streams.h"
+#include "../dense.h"
+#include "syrk.h"         // ?syrk for real types, check_syrk()
+
+#ifndef DOXYGEN_SKIP
+extern "C" {
+
+  using LinAlg::I_t;
+  using LinAlg::S_t;
+  using LinAlg::D_t;
+  using LinAlg::C_t;
+  using LinAlg::Z_t;
+
+  void fortran_name(cherk, CHERK)(const char* uplo, const char* trans,
+                                  const I_t* n, const I_t* k, const S_t* alpha,
+                                  const C_t* A, const I_t* lda,
+                                  const S_t* beta, C_t* C, const I_t* ldc);
+  void fortran_name(zherk, ZHERK)(const char* uplo, const char* trans,
+                                  const I_t* n, const I_t* k, const D_t* alpha,
+                                  const Z_t* A, const I_t* lda,
+                                  const D_t* beta, Z_t* C, const I_t* ldc);
+}
+#endif /* DOXYGEN_SKIP */
+
+namespace LinAlg {
+
+namespace BLAS {
+
+namespace FORTRAN {
+
+/** \brief            Hermitian rank-k update
+ *
+ *  C = alpha * A * A**H + beta * C    (trans = 'N')
+ *  C = alpha * A**H * A + beta * C    (trans = 'C')
+ *
+ *  where C is hermitian and only its upper (uplo = 'U') or lower (uplo =
+ *  'L') triangle is referenced and updated. alpha and beta are real.
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        trans
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        k
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        ldc
+ *
+ *  See [ZHERK](http://www.mathkeisan.com/usersguide/man/zherk.html)
+ */
+inline void xHERK(char uplo, char trans, int n, int k, S_t alpha, S_t* A,
+                  int lda, S_t beta, S_t* C, int ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  if (trans == 'C' || trans == 'c') trans = 'T';
+
+  fortran_name(ssyrk, SSYRK)(&uplo, &trans, &n, &k, &alpha, A, &lda, &beta, C,
+                             &ldc);
+
+}
+/** \overload
+ */
+inline void xHERK(char uplo, char trans, int n, int k, D_t alpha, D_t* A,
+                  int lda, D_t beta, D_t* C, int ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  if (trans == 'C' || trans == 'c') trans = 'T';
+
+  fortran_name(dsyrk, DSYRK)(&uplo, &trans, &n, &k, &alpha, A, &lda, &beta, C,
+                             &ldc);
+
+}
+/** \overload
+ */
+inline void xHERK(char uplo, char trans, int n, int k, S_t alpha, C_t* A,
+                  int lda, S_t beta, C_t* C, int ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(cherk, CHERK)(&uplo, &trans, &n, &k, &alpha, A, &lda, &beta, C,
+                             &ldc);
+
+}
+/** \overload
+ */
+inline void xHERK(char uplo, char trans, int n, int k, D_t alpha, Z_t* A,
+                  int lda, D_t beta, Z_t* C, int ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(zherk, ZHERK)(&uplo, &trans, &n, &k, &alpha, A, &lda, &beta, C,
+                             &ldc);
+
+}
+
+} /* namespace LinAlg::BLAS::FORTRAN */
+
+#ifdef HAVE_CUDA
+namespace cuBLAS {
+
+/** \brief            Hermitian rank-k update
+ *
+ *  C = alpha * op(A) * op(A)**H + beta * C
+ *
+ *  \param[in]        handle
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        trans
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        k
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        ldc
+ *
+ *  See [cuBLAS Documentation](http://docs.nvidia.com/cuda/cublas/)
+ */
+inline void xHERK(cublasHandle_t handle, cublasFillMode_t uplo,
+                  cublasOperation_t trans, I_t n, I_t k, const S_t* alpha,
+                  const S_t* A, I_t lda, const S_t* beta, S_t* C, I_t ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  if (trans == CUBLAS_OP_C) trans = CUBLAS_OP_T;
+
+  checkCUBLAS(cublasSsyrk(handle, uplo, trans, n, k, alpha, A, lda, beta, C, \
+                          ldc));
+
+}
+/** \overload
+ */
+inline void xHERK(cublasHandle_t handle, cublasFillMode_t uplo,
+                  cublasOperation_t trans, I_t n, I_t k, const D_t* alpha,
+                  const D_t* A, I_t lda, const D_t* beta, D_t* C, I_t ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  if (trans == CUBLAS_OP_C) trans = CUBLAS_OP_T;
+
+  checkCUBLAS(cublasDsyrk(handle, uplo, trans, n, k, alpha, A, lda, beta, C, \
+                          ldc));
+
+}
+/** \overload
+ */
+inline void xHERK(cublasHandle_t handle, cublasFillMode_t uplo,
+                  cublasOperation_t trans, I_t n, I_t k, const S_t* alpha,
+                  const C_t* A, I_t lda, const S_t* beta, C_t* C, I_t ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasCherk(handle, uplo, trans, n, k, alpha, \
+                          (const cuComplex*)A, lda, beta, (cuComplex*)C, \
+                          ldc));
+
+}
+/** \overload
+ */
+inline void xHERK(cublasHandle_t handle, cublasFillMode_t uplo,
+                  cublasOperation_t trans, I_t n, I_t k, const D_t* alpha,
+                  const Z_t* A, I_t lda, const D_t* beta, Z_t* C, I_t ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasZherk(handle, uplo, trans, n, k, alpha, \
+                          (const cuDoubleComplex*)A, lda, beta, \
+                          (cuDoubleComplex*)C, ldc));
+
+}
+
+} /* namespace LinAlg::BLAS::cuBLAS */
+#endif /* HAVE_CUDA */
+
+using LinAlg::Utilities::check_input_transposed;
+using LinAlg::Utilities::check_stream_alive;
+#ifdef HAVE_CUDA
+using LinAlg::Utilities::check_gpu_structures;
+using LinAlg::Utilities::check_stream_prefer_native;
+using LinAlg::Utilities::check_stream_device_id;
+using LinAlg::CUDA::cuBLAS::prepare_cublas;
+using LinAlg::CUDA::cuBLAS::finish_cublas;
+#endif
+
+// Convenience bindings (bindings for Dense<T>)
+/** \brief            Hermitian rank-k update
+ *
+ *  C = alpha * A * A**H + beta * C
+ *
+ *  Only the triangle of C given by uplo is updated, the other one isn't
+ *  referenced. alpha and beta are real. A must not be transposed (there is
+ *  no conjugated view to express A**H * A). For real types this is xSYRK().
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ */
+template <typename T>
+inline void xHERK(UPLO uplo, const typename RealType<T>::type alpha,
+                  const Dense<T>& A, const typename RealType<T>::type beta,
+                  Dense<T>& C) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_syrk(A, C, "xHERK()");
+  check_input_transposed(A, "xHERK()");
+#endif
+
+  auto location = A._location;
+  auto device_id = A._device_id;
+  auto n = A.rows();
+  auto k = A.cols();
+  auto A_ptr = A._begin();
+  auto lda = A._leading_dimension;
+  auto C_ptr = C._begin();
+  auto ldc = C._leading_dimension;
+
+  if (location == Location::host) {
+
+    char uplo_ = (uplo == UPLO::lower) ? 'L' : 'U';
+
+    FORTRAN::xHERK(uplo_, 'N', n, k, alpha, A_ptr, lda, beta, C_ptr, ldc);
+
+  }
+#ifdef HAVE_CUDA
+  else if (location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_gpu_structures("xHERK()");
+# endif
+
+    auto uplo_ = (uplo == UPLO::lower) ? CUBLAS_FILL_MODE_LOWER :
+                                         CUBLAS_FILL_MODE_UPPER;
+
+    int               prev_device = 0;
+    cudaStream_t      prev_cuda_stream;
+    Stream*           stream_;
+
+# ifndef USE_LOCAL_STREAMS
+    stream_ = &(LinAlg::CUDA::compute_stream[device_id]);
+# else
+    Stream my_stream(device_id);
+    stream_ = &my_stream;
+# endif
+
+    auto handle = prepare_cublas(*stream_, &prev_device, &prev_cuda_stream);
+    BLAS::cuBLAS::xHERK(*handle, uplo_, CUBLAS_OP_N, n, k, &alpha, A_ptr, lda,
+                        &beta, C_ptr, ldc);
+    finish_cublas(*stream_, &prev_device, &prev_cuda_stream, handle);
+
+    stream_->sync_cuda();
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    throw excUnimplemented("xHERK(): BLAS-3 HERK not supported on selected "
+                           "location");
+
+  }
+#endif
+
+}
+
+/** \brief            Asynchronous hermitian rank-k update
+ *
+ *  C = alpha * A * A**H + beta * C
+ *
+ *  Only the triangle of C given by uplo is updated. A must not be
+ *  transposed.
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        stream
+ *
+ *  \returns          The ticket number for the operation on the stream
+ */
+template <typename T>
+inline I_t xHERK_async(UPLO uplo, const typename RealType<T>::type alpha,
+                       const Dense<T>& A,
+                       const typename RealType<T>::type beta, Dense<T>& C,
+                       Stream& stream) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_syrk(A, C, "xHERK_async()");
+  check_input_transposed(A, "xHERK_async()");
+#endif
+
+  I_t ticket = 0;
+
+  auto location = A._location;
+  auto device_id = A._device_id;
+
+  if (location == Location::host) {
+
+    if (stream.synchronous) {
+
+      xHERK(uplo, alpha, A, beta, C);
+
+    } else {
+
+      // Create a task using the synchronous variant
+
+#ifndef LINALG_NO_CHECKS
+      check_stream_alive(stream, "xHERK_async()");
+#endif
+
+      // Arguments passed by copy, ensures memory lifetime but callee can't
+      // modify the arguments anymore
+      auto task = [=]() mutable { xHERK(uplo, alpha, A, beta, C); };
+
+      ticket = stream.add(std::move(task));
+
+    }
+
+  }
+#ifdef HAVE_CUDA
+  else if (location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_gpu_structures("xHERK_async()");
+    check_stream_prefer_native(stream, "xHERK_async()");
+    check_stream_device_id(stream, device_id, "xHERK_async()");
+# endif
+
+    auto uplo_ = (uplo == UPLO::lower) ? CUBLAS_FILL_MODE_LOWER :
+                                         CUBLAS_FILL_MODE_UPPER;
+
+    int               prev_device = 0;
+    cudaStream_t      prev_cuda_stream;
+
+    auto handle = prepare_cublas(stream, &prev_device, &prev_cuda_stream);
+    BLAS::cuBLAS::xHERK(*handle, uplo_, CUBLAS_OP_N, A.rows(), A.cols(),
+                        &alpha, A._begin(), A._leading_dimension, &beta,
+                        C._begin(), C._leading_dimension);
+    finish_cublas(stream, &prev_device, &prev_cuda_stream, handle);
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    throw excUnimplemented("xHERK_async(): BLAS-3 HERK not supported on "
+                           "selected location");
+
+  }
+#endif
+
+  return ticket;
+
+}
+
+} /* namespace LinAlg::BLAS */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_BLAS_HERK_H_ */
@@ -0,0 +1,282 @@
+/** \file
+ *
+ *  \brief            xCSRGEMM (native)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_BLAS_NATIVE_CSRGEMM_H_
+#define LINALG_BLAS_NATIVE_CSRGEMM_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::BLAS
+ *        bindings to routines handing sparse matrices
+ *
+ *    LinAlg::BLAS::NATIVE
+ *        implementations within LinAlg
+ */
+
+#include <vector>     // std::vector
+#include <algorithm>  // std::sort, std::max
+
+#include "../../preprocessor.h"
+#include "../../types.h"
+#include "../../profiling.h"
+#include "../../exceptions.h"
+#include "../../executor.h"
+#include "../../utilities/checks.h"
+#include "../../sparse.h"
+
+namespace LinAlg {
+
+namespace BLAS {
+
+namespace NATIVE {
+
+using LinAlg::Utilities::check_format;
+using LinAlg::Utilities::check_input_transposed;
+
+#ifndef DOXYGEN_SKIP
+template <typename T>
+inline void check_csrgemm_arguments(const Sparse<T>& A, const Sparse<T>& B,
+                                    const char* caller_name) {
+  check_format(Format::CSR, A, caller_name);
+  check_format(Format::CSR, B, caller_name);
+  check_input_transposed(A, caller_name);
+  check_input_transposed(B, caller_name);
+  if (A._location != Location::host || B._location != Location::host) {
+    throw excUnimplemented("%s: native CSRGEMM only supported in main memory",
+                           caller_name);
+  }
+}
+#endif
+
+/** \brief            Sparse matrix-matrix multiply, symbolic phase
+ *
+ *  Computes the sparsity pattern of C = A * B and allocates C accordingly
+ *  (C-style indexing, column indices sorted within each row). The values of
+ *  C are not computed, use xCSRGEMM_numeric() for that. The pattern only
+ *  depends on the patterns of A and B, the symbolic phase can thus be
+ *  skipped if only the values of A and B change.
+ *
+ *  \param[in]        A
+ *                    Format::CSR.
+ *
+ *  \param[in]        B
+ *                    Format::CSR.
+ *
+ *  \param[in]        B_cols
+ *                    Number of columns of B.
+ *
+ *  \param[out]       C
+ *                    Matrix for the result, reallocated.
+ *
+ *  \param[in]        n_threads
+ *                    OPTIONAL: number of threads, <= 0 uses all hardware
+ *                    threads. Default: 0.
+ */
+template <typename T>
+inline void xCSRGEMM_symbolic(const Sparse<T>& A, const Sparse<T>& B,
+                              I_t B_cols, Sparse<T>& C, int n_threads = 0) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_csrgemm_arguments(A, B, "xCSRGEMM_symbolic(A, B, B_cols, C)");
+#endif
+
+  auto rows      = A._size;
+  auto A_first   = A._first_index;
+  auto A_edges   = A._edges.get();
+  auto A_indices = A._indices.get();
+  auto B_first   = B._first_index;
+  auto B_edges   = B._edges.get();
+  auto B_indices = B._indices.get();
+
+  std::vector<I_t> row_nonzeros(rows + 1, 0);
+
+  // Pass 1: count the non-zeros of each row of C
+  Threads::parallel_for(rows, [&](I_t begin, I_t end) {
+    std::vector<I_t> last_row(B_cols, -1);
+    for (auto row = begin; row < end; ++row) {
+      I_t count = 0;
+      for (auto a = A_edges[row] - A_first; a < A_edges[row + 1] - A_first;
+           ++a) {
+        auto k = A_indices[a] - A_first;
+        for (auto b = B_edges[k] - B_first; b < B_edges[k + 1] - B_first;
+             ++b) {
+          auto col = B_indices[b] - B_first;
+          if (last_row[col] != row) {
+            last_row[col] = row;
+            ++count;
+          }
+        }
+      }
+      row_nonzeros[row + 1] = count;
+    }
+  }, n_threads);
+
+  for (I_t row = 0; row < rows; ++row) {
+    row_nonzeros[row + 1] += row_nonzeros[row];
+  }
+
+  Sparse<T> result(rows, row_nonzeros[rows], 0);
+  auto C_edges   = result._edges.get();
+  auto C_indices = result._indices.get();
+  for (I_t row = 0; row <= rows; ++row) C_edges[row] = row_nonzeros[row];
+
+  // Pass 2: fill in the column indices
+  Threads::parallel_for(rows, [&](I_t begin, I_t end) {
+    std::vector<I_t> last_row(B_cols, -1);
+    for (auto row = begin; row < end; ++row) {
+      auto position = C_edges[row];
+      for (auto a = A_edges[row] - A_first; a < A_edges[row + 1] - A_first;
+           ++a) {
+        auto k = A_indices[a] - A_first;
+        for (auto b = B_edges[k] - B_first; b < B_edges[k + 1] - B_first;
+             ++b) {
+          auto col = B_indices[b] - B_first;
+          if (last_row[col] != row) {
+            last_row[col] = row;
+            C_indices[position++] = col;
+          }
+        }
+      }
+      std::sort(C_indices + C_edges[row], C_indices + C_edges[row + 1]);
+    }
+  }, n_threads);
+
+  result._minimal_index = 0;
+  result._maximal_index = B_cols;
+
+  swap(result, C);
+
+}
+
+/** \brief            Sparse matrix-matrix multiply, numeric phase
+ *
+ *  Computes the values of C = A * B, with the pattern of C as computed by
+ *  xCSRGEMM_symbolic() from matrices with the same patterns as A and B.
+ *
+ *  \param[in]        A
+ *                    Format::CSR.
+ *
+ *  \param[in]        B
+ *                    Format::CSR.
+ *
+ *  \param[in]        B_cols
+ *                    Number of columns of B.
+ *
+ *  \param[in,out]    C
+ *                    Matrix with the pattern from xCSRGEMM_symbolic(), the
+ *                    values are overwritten.
+ *
+ *  \param[in]        n_threads
+ *                    OPTIONAL: number of threads, <= 0 uses all hardware
+ *                    threads. Default: 0.
+ */
+template <typename T>
+inline void xCSRGEMM_numeric(const Sparse<T>& A, const Sparse<T>& B,
+                             I_t B_cols, Sparse<T>& C, int n_threads = 0) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_csrgemm_arguments(A, B, "xCSRGEMM_numeric(A, B, B_cols, C)");
+  if (C._size != A._size) {
+    throw excBadArgument("xCSRGEMM_numeric(A, B, B_cols, C), C: pattern does "
+                         "not match A * B, run xCSRGEMM_symbolic() first");
+  }
+#endif
+
+  auto rows      = A._size;
+  auto A_first   = A._first_index;
+  auto A_edges   = A._edges.get();
+  auto A_indices = A._indices.get();
+  auto A_values  = A._values.get();
+  auto B_first   = B._first_index;
+  auto B_edges   = B._edges.get();
+  auto B_indices = B._indices.get();
+  auto B_values  = B._values.get();
+  auto C_first   = C._first_index;
+  auto C_edges   = C._edges.get();
+  auto C_indices = C._indices.get();
+  auto C_values  = C._values.get();
+
+  Threads::parallel_for(rows, [&](I_t begin, I_t end) {
+
+    // Position of each column within the current row of C
+    std::vector<I_t> position_of(B_cols, -1);
+
+    for (auto row = begin; row < end; ++row) {
+
+      for (auto c = C_edges[row] - C_first; c < C_edges[row + 1] - C_first;
+           ++c) {
+        position_of[C_indices[c] - C_first] = c;
+        C_values[c] = cast<T>(0.0);
+      }
+
+      for (auto a = A_edges[row] - A_first; a < A_edges[row + 1] - A_first;
+           ++a) {
+        auto k       = A_indices[a] - A_first;
+        auto A_value = A_values[a];
+        for (auto b = B_edges[k] - B_first; b < B_edges[k + 1] - B_first;
+             ++b) {
+          C_values[position_of[B_indices[b] - B_first]] += A_value *
+                                                           B_values[b];
+        }
+      }
+
+    }
+
+  }, n_threads);
+
+}
+
+/** \brief            Sparse matrix-matrix multiply
+ *
+ *  C <- A * B
+ *
+ *  \param[in]        A
+ *                    Format::CSR.
+ *
+ *  \param[in]        B
+ *                    Format::CSR.
+ *
+ *  \param[out]       C
+ *                    Matrix for the result, reallocated (C-style indexing).
+ *
+ *  \param[in]        n_threads
+ *                    OPTIONAL: number of threads, <= 0 uses all hardware
+ *                    threads. Default: 0.
+ */
+template <typename T>
+inline void xCSRGEMM(const Sparse<T>& A, const Sparse<T>& B, Sparse<T>& C,
+                     int n_threads = 0) {
+
+  PROFILING_FUNCTION_HEADER
+
+  // Number of columns of B
+  I_t B_cols  = 0;
+  auto indices = B._indices.get();
+  for (I_t i = 0; i < B._n_nonzeros; ++i) {
+    B_cols = std::max(B_cols, indices[i] - B._first_index + 1);
+  }
+
+  xCSRGEMM_symbolic(A, B, B_cols, C, n_threads);
+  xCSRGEMM_numeric(A, B, B_cols, C, n_threads);
+
+}
+
+} /* namespace LinAlg::BLAS::NATIVE */
+
+} /* namespace LinAlg::BLAS */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_BLAS_NATIVE_CSRGEMM_H_ */
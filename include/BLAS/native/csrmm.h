@@ -0,0 +1,186 @@
+/** \file
+ *
+ *  \brief            xCSRMM (native)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_BLAS_NATIVE_CSRMM_H_
+#define LINALG_BLAS_NATIVE_CSRMM_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::BLAS
+ *        bindings to routines handing sparse matrices
+ *
+ *    LinAlg::BLAS::NATIVE
+ *        implementations within LinAlg
+ */
+
+#include <algorithm>  // std::min
+
+#include "../../preprocessor.h"
+#include "../../types.h"
+#include "../../profiling.h"
+#include "../../exceptions.h"
+#include "../../executor.h"
+#include "../../utilities/checks.h"
+#include "../../dense.h"
+#include "../../sparse.h"
+
+namespace LinAlg {
+
+namespace BLAS {
+
+namespace NATIVE {
+
+/** \brief            Sparse (CSR) times dense matrix multiply for a range of
+ *                    rows
+ *
+ *  Y(first_row:last_row, :) <- alpha * A(first_row:last_row, :) * X
+ *                              + beta * Y(first_row:last_row, :)
+ *
+ *  \param[in]        first_row
+ *
+ *  \param[in]        last_row
+ *                    First row not to compute.
+ *
+ *  \param[in]        n_vectors
+ *                    Number of columns of X and Y.
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        values
+ *
+ *  \param[in]        indices
+ *
+ *  \param[in]        edges
+ *
+ *  \param[in]        first_index
+ *
+ *  \param[in]        X
+ *                    Column major.
+ *
+ *  \param[in]        ldx
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    Y
+ *                    Column major.
+ *
+ *  \param[in]        ldy
+ */
+template <typename T>
+inline void xCSRMM(I_t first_row, I_t last_row, I_t n_vectors, T alpha,
+                   const T* values, const I_t* indices, const I_t* edges,
+                   int first_index, const T* X, I_t ldx, T beta, T* Y,
+                   I_t ldy) {
+
+  PROFILING_FUNCTION_HEADER
+
+  for (I_t vector = 0; vector < n_vectors; ++vector) {
+
+    auto x = X + vector * ldx - first_index;
+    auto y = Y + vector * ldy;
+
+    for (I_t row = first_row; row < last_row; ++row) {
+
+      auto sum = cast<T>(0.0);
+      for (auto index = edges[row] - first_index;
+           index < edges[row + 1] - first_index; ++index) {
+        sum += values[index] * x[indices[index]];
+      }
+
+      y[row] = (beta == cast<T>(0.0)) ? alpha * sum
+                                      : alpha * sum + beta * y[row];
+
+    }
+
+  }
+
+}
+
+using LinAlg::Utilities::check_format;
+using LinAlg::Utilities::check_input_transposed;
+using LinAlg::Utilities::check_output_transposed;
+
+/** \brief            Sparse (CSR) times dense matrix multiply in main memory
+ *
+ *  Y <- alpha * A * X + beta * Y
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *                    Format::CSR.
+ *
+ *  \param[in]        X
+ *                    Format::ColMajor, at least as many rows as the largest
+ *                    column index used in A.
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    Y
+ *                    Format::ColMajor.
+ *
+ *  \param[in]        n_threads
+ *                    OPTIONAL: number of threads, <= 0 uses all hardware
+ *                    threads. Default: 0.
+ */
+template <typename T>
+inline void xCSRMM(const T alpha, const Sparse<T>& A, const Dense<T>& X,
+                   const T beta, Dense<T>& Y, int n_threads = 0) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_format(Format::CSR, A, "xCSRMM(alpha, A, X, beta, Y), A");
+  check_format(Format::ColMajor, X, "xCSRMM(alpha, A, X, beta, Y), X");
+  check_format(Format::ColMajor, Y, "xCSRMM(alpha, A, X, beta, Y), Y");
+  check_input_transposed(A, "xCSRMM(alpha, A, X, beta, Y), A");
+  check_input_transposed(X, "xCSRMM(alpha, A, X, beta, Y), X");
+  check_output_transposed(Y, "xCSRMM(alpha, A, X, beta, Y), Y");
+  if (Y.rows() != A._size || Y.cols() != X.cols()) {
+    throw excBadArgument("xCSRMM(alpha, A, X, beta, Y), Y: matrix has wrong "
+                         "dimensions");
+  }
+  if (A._location != Location::host || X._location != Location::host ||
+      Y._location != Location::host) {
+    throw excUnimplemented("xCSRMM(): native CSRMM only supported in main "
+                           "memory");
+  }
+#endif /* LINALG_NO_CHECKS */
+
+  auto values      = A._values.get();
+  auto indices     = A._indices.get();
+  auto edges       = A._edges.get();
+  auto first_index = A._first_index;
+  auto n_vectors   = X.cols();
+  auto X_ptr       = X._begin();
+  auto ldx         = X._leading_dimension;
+  auto Y_ptr       = Y._begin();
+  auto ldy         = Y._leading_dimension;
+
+  // Only split when there is enough work per thread
+  const I_t min_nonzeros_per_thread = 1 << 15;
+  auto max_threads = A._n_nonzeros / min_nonzeros_per_thread + 1;
+  if (n_threads <= 0) n_threads = Threads::hardware_threads();
+  n_threads = int(std::min(I_t(n_threads), max_threads));
+
+  Threads::parallel_for(A._size, [&](I_t begin, I_t end) {
+    xCSRMM(begin, end, n_vectors, alpha, values, indices, edges, first_index,
+           X_ptr, ldx, beta, Y_ptr, ldy);
+  }, n_threads);
+
+}
+
+} /* namespace LinAlg::BLAS::NATIVE */
+
+} /* namespace LinAlg::BLAS */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_BLAS_NATIVE_CSRMM_H_ */
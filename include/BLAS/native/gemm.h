@@ -0,0 +1,707 @@
+/** \file
+ *
+ *  \brief            xGEMM (native)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_BLAS_NATIVE_GEMM_H_
+#define LINALG_BLAS_NATIVE_GEMM_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::BLAS
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *    LinAlg::BLAS::NATIVE
+ *        implementations within LinAlg
+ */
+
+#include <algorithm>  // std::min, std::max
+#include <vector>     // std::vector
+
+#if defined(__AVX512F__) || (defined(__AVX2__) && defined(__FMA__))
+# include <immintrin.h>
+#endif
+
+#include "../../preprocessor.h"
+#include "../../types.h"
+#include "../../profiling.h"
+#include "../../exceptions.h"
+#include "../../executor.h"
+#include "../../utilities/checks.h"
+#include "../../dense.h"
+
+namespace LinAlg {
+
+namespace BLAS {
+
+namespace NATIVE {
+
+#ifndef DOXYGEN_SKIP
+/*  Structure of the implementation (as in BLIS / GotoBLAS):
+ *
+ *    for jc in steps of NC:              columns of C and B
+ *      for pc in steps of KC:            the summation index
+ *        pack op(B)(pc:pc+KC, jc:jc+NC)  into micro-panels of NR columns
+ *        for ic in steps of MC:          rows of C and A
+ *          pack op(A)(ic:ic+MC, pc:pc+KC) into micro-panels of MR rows
+ *          for each micro-panel pair:    MR x NR register blocked kernel
+ *
+ *  The packed block of A stays in L2 while the micro-panels of B stream
+ *  through L1. Partial panels at the edges are padded with zeros so the
+ *  micro-kernels always compute a full MR x NR block, which is then added to
+ *  C with the actual size.
+ *
+ *  A kernel provides MR, NR (register block) and MC, KC, NC (cache blocks)
+ *  and multiply(kc, A, lda, B, b_row, b_col, AB), which stores the MR x NR 
+ *  product of an MR x kc and a kc x NR block in AB (column major). Column p 
+ *  of the A block starts at A + p * lda, element (p, j) of the B block is at 
+ *  B + p * b_row + j * b_col. For packed micro-panels lda = MR, b_row = NR 
+ *  and b_col = 1, xGEMM_small() passes the unpacked operands.
+ */
+
+// Portable kernel for real types
+template <typename T, int MR_, int NR_>
+struct GEMMGenericKernel {
+
+  enum { MR = MR_, NR = NR_ };
+
+  static inline void multiply(I_t kc, const T* A, I_t lda, const T* B,
+                              I_t b_row, I_t b_col, T* AB) {
+
+    T accumulator[MR * NR];
+    for (int i = 0; i < MR * NR; ++i) accumulator[i] = cast<T>(0.0);
+
+    for (I_t p = 0; p < kc; ++p, A += lda, B += b_row) {
+      for (int j = 0; j < NR; ++j) {
+        auto b = B[j * b_col];
+        for (int i = 0; i < MR; ++i) accumulator[j * MR + i] += A[i] * b;
+      }
+    }
+
+    for (int i = 0; i < MR * NR; ++i) AB[i] = accumulator[i];
+
+  }
+
+};
+
+// Portable kernel for complex types (real arithmetic on the parts avoids
+// the overflow handling of the complex multiplication)
+template <typename T, int MR_, int NR_>
+struct GEMMComplexKernel {
+
+  enum { MR = MR_, NR = NR_ };
+
+  static inline void multiply(I_t kc, const T* A, I_t lda, const T* B,
+                              I_t b_row, I_t b_col, T* AB) {
+
+    typedef typename RealType<T>::type R;
+
+    R real_part[MR * NR], imag_part[MR * NR];
+    for (int i = 0; i < MR * NR; ++i) real_part[i] = imag_part[i] = R(0);
+
+    for (I_t p = 0; p < kc; ++p, A += lda, B += b_row) {
+
+      R a_real[MR], a_imag[MR];
+      for (int i = 0; i < MR; ++i) {
+        a_real[i] = real(A[i]);
+        a_imag[i] = imag(A[i]);
+      }
+
+      for (int j = 0; j < NR; ++j) {
+        auto b_real = real(B[j * b_col]);
+        auto b_imag = imag(B[j * b_col]);
+        for (int i = 0; i < MR; ++i) {
+          real_part[j * MR + i] += a_real[i] * b_real - a_imag[i] * b_imag;
+          imag_part[j * MR + i] += a_real[i] * b_imag + a_imag[i] * b_real;
+        }
+      }
+
+    }
+
+    for (int i = 0; i < MR * NR; ++i) {
+      AB[i] = cast<T>(real_part[i], imag_part[i]);
+    }
+
+  }
+
+};
+
+// Vectorized kernel for real types: MR = MV vectors of SIMD::width elements,
+// each of the NR columns of the product is held in MV registers
+template <typename T, typename SIMD, int MV, int NR_>
+struct GEMMSIMDKernel {
+
+  enum { MR = MV * SIMD::width, NR = NR_ };
+
+  static inline void multiply(I_t kc, const T* A, I_t lda, const T* B,
+                              I_t b_row, I_t b_col, T* AB) {
+
+    typename SIMD::vector accumulator[NR][MV];
+    for (int j = 0; j < NR; ++j) {
+      for (int v = 0; v < MV; ++v) accumulator[j][v] = SIMD::zero();
+    }
+
+    for (I_t p = 0; p < kc; ++p, A += lda, B += b_row) {
+
+      typename SIMD::vector a[MV];
+      for (int v = 0; v < MV; ++v) a[v] = SIMD::load(A + v * SIMD::width);
+
+      for (int j = 0; j < NR; ++j) {
+        auto b = SIMD::broadcast(B + j * b_col);
+        for (int v = 0; v < MV; ++v) {
+          accumulator[j][v] = SIMD::fma(a[v], b, accumulator[j][v]);
+        }
+      }
+
+    }
+
+    for (int j = 0; j < NR; ++j) {
+      for (int v = 0; v < MV; ++v) {
+        SIMD::store(AB + j * MR + v * SIMD::width, accumulator[j][v]);
+      }
+    }
+
+  }
+
+};
+
+# if defined(__AVX512F__)
+struct AVX512Double {
+  typedef __m512d vector;
+  enum { width = 8 };
+  static inline vector zero() { return _mm512_setzero_pd(); }
+  static inline vector load(const D_t* x) { return _mm512_loadu_pd(x); }
+  static inline vector broadcast(const D_t* x) { return _mm512_set1_pd(*x); }
+  static inline vector fma(vector a, vector b, vector c) {
+    return _mm512_fmadd_pd(a, b, c);
+  }
+  static inline void store(D_t* x, vector a) { _mm512_storeu_pd(x, a); }
+};
+struct AVX512Single {
+  typedef __m512 vector;
+  enum { width = 16 };
+  static inline vector zero() { return _mm512_setzero_ps(); }
+  static inline vector load(const S_t* x) { return _mm512_loadu_ps(x); }
+  static inline vector broadcast(const S_t* x) { return _mm512_set1_ps(*x); }
+  static inline vector fma(vector a, vector b, vector c) {
+    return _mm512_fmadd_ps(a, b, c);
+  }
+  static inline void store(S_t* x, vector a) { _mm512_storeu_ps(x, a); }
+};
+# elif defined(__AVX2__) && defined(__FMA__)
+struct AVX2Double {
+  typedef __m256d vector;
+  enum { width = 4 };
+  static inline vector zero() { return _mm256_setzero_pd(); }
+  static inline vector load(const D_t* x) { return _mm256_loadu_pd(x); }
+  static inline vector broadcast(const D_t* x) {
+    return _mm256_broadcast_sd(x);
+  }
+  static inline vector fma(vector a, vector b, vector c) {
+    return _mm256_fmadd_pd(a, b, c);
+  }
+  static inline void store(D_t* x, vector a) { _mm256_storeu_pd(x, a); }
+};
+struct AVX2Single {
+  typedef __m256 vector;
+  enum { width = 8 };
+  static inline vector zero() { return _mm256_setzero_ps(); }
+  static inline vector load(const S_t* x) { return _mm256_loadu_ps(x); }
+  static inline vector broadcast(const S_t* x) {
+    return _mm256_broadcast_ss(x);
+  }
+  static inline vector fma(vector a, vector b, vector c) {
+    return _mm256_fmadd_ps(a, b, c);
+  }
+  static inline void store(S_t* x, vector a) { _mm256_storeu_ps(x, a); }
+};
+# endif
+
+// The kernel and blocking used for each type
+template <typename T>
+struct GEMMKernel;
+
+# if defined(__AVX512F__)
+template <>
+struct GEMMKernel<S_t> : GEMMSIMDKernel<S_t, AVX512Single, 2, 12> {
+  enum { MC = 192, KC = 256, NC = 4080 };
+};
+template <>
+struct GEMMKernel<D_t> : GEMMSIMDKernel<D_t, AVX512Double, 2, 12> {
+  enum { MC = 144, KC = 256, NC = 4080 };
+};
+# elif defined(__AVX2__) && defined(__FMA__)
+template <>
+struct GEMMKernel<S_t> : GEMMSIMDKernel<S_t, AVX2Single, 2, 6> {
+  enum { MC = 144, KC = 256, NC = 4080 };
+};
+template <>
+struct GEMMKernel<D_t> : GEMMSIMDKernel<D_t, AVX2Double, 2, 6> {
+  enum { MC = 96, KC = 256, NC = 4080 };
+};
+# else
+template <>
+struct GEMMKernel<S_t> : GEMMGenericKernel<S_t, 8, 4> {
+  enum { MC = 128, KC = 256, NC = 4080 };
+};
+template <>
+struct GEMMKernel<D_t> : GEMMGenericKernel<D_t, 4, 4> {
+  enum { MC = 128, KC = 256, NC = 4080 };
+};
+# endif
+template <>
+struct GEMMKernel<C_t> : GEMMComplexKernel<C_t, 4, 4> {
+  enum { MC = 64, KC = 256, NC = 4080 };
+};
+template <>
+struct GEMMKernel<Z_t> : GEMMComplexKernel<Z_t, 4, 4> {
+  enum { MC = 64, KC = 128, NC = 4080 };
+};
+
+// The kernel used by xGEMM_small(): one vector of rows and 8 columns, which
+// keeps the edges that are computed element by element narrow
+template <typename T>
+struct GEMMSmallKernel : GEMMKernel<T> {};
+
+# if defined(__AVX512F__)
+template <>
+struct GEMMSmallKernel<S_t> : GEMMSIMDKernel<S_t, AVX512Single, 1, 8> {};
+template <>
+struct GEMMSmallKernel<D_t> : GEMMSIMDKernel<D_t, AVX512Double, 1, 8> {};
+# elif defined(__AVX2__) && defined(__FMA__)
+template <>
+struct GEMMSmallKernel<S_t> : GEMMSIMDKernel<S_t, AVX2Single, 1, 8> {};
+template <>
+struct GEMMSmallKernel<D_t> : GEMMSIMDKernel<D_t, AVX2Double, 1, 8> {};
+# endif
+
+// Copy op(A)(row:row+mc, col:col+kc) into micro-panels of MR rows (each
+// stored column by column), padding the last panel with zeros
+template <typename T, int MR>
+inline void gemm_pack_A(char trans, const T* A, I_t lda, I_t row, I_t col,
+                        I_t mc, I_t kc, T* packed) {
+
+  auto row_stride = (trans == 'N') ? I_t(1) : lda;
+  auto col_stride = (trans == 'N') ? lda : I_t(1);
+  auto conjugate  = (trans == 'C');
+
+  for (I_t panel = 0; panel < mc; panel += MR, packed += MR * kc) {
+
+    auto rows   = std::min(I_t(MR), mc - panel);
+    auto source = A + (row + panel) * row_stride + col * col_stride;
+
+    for (I_t p = 0; p < kc; ++p) {
+      for (I_t i = 0; i < rows; ++i) {
+        auto value = source[i * row_stride + p * col_stride];
+        packed[p * MR + i] = conjugate ? conj(value) : value;
+      }
+      for (I_t i = rows; i < MR; ++i) packed[p * MR + i] = cast<T>(0.0);
+    }
+
+  }
+
+}
+
+// Copy op(B)(row:row+kc, col:col+nc) into micro-panels of NR columns (each
+// stored row by row), padding the last panel with zeros
+template <typename T, int NR>
+inline void gemm_pack_B(char trans, const T* B, I_t ldb, I_t row, I_t col,
+                        I_t kc, I_t nc, T* packed) {
+
+  auto row_stride = (trans == 'N') ? I_t(1) : ldb;
+  auto col_stride = (trans == 'N') ? ldb : I_t(1);
+  auto conjugate  = (trans == 'C');
+
+  for (I_t panel = 0; panel < nc; panel += NR, packed += NR * kc) {
+
+    auto cols   = std::min(I_t(NR), nc - panel);
+    auto source = B + row * row_stride + (col + panel) * col_stride;
+
+    for (I_t p = 0; p < kc; ++p) {
+      for (I_t j = 0; j < cols; ++j) {
+        auto value = source[p * row_stride + j * col_stride];
+        packed[p * NR + j] = conjugate ? conj(value) : value;
+      }
+      for (I_t j = cols; j < NR; ++j) packed[p * NR + j] = cast<T>(0.0);
+    }
+
+  }
+
+}
+
+// C(0:mr, 0:nr) = alpha * AB + beta * C (C isn't read if beta is 0)
+template <typename T, int MR>
+inline void gemm_update(I_t mr, I_t nr, T alpha, const T* AB, T beta, T* C,
+                        I_t ldc) {
+
+  if (beta == cast<T>(0.0)) {
+    for (I_t j = 0; j < nr; ++j) {
+      for (I_t i = 0; i < mr; ++i) C[i + j * ldc] = alpha * AB[j * MR + i];
+    }
+  } else {
+    for (I_t j = 0; j < nr; ++j) {
+      for (I_t i = 0; i < mr; ++i) {
+        C[i + j * ldc] = alpha * AB[j * MR + i] + beta * C[i + j * ldc];
+      }
+    }
+  }
+
+}
+
+// C(i_begin:i_end, j_begin:j_end) = alpha * A * op(B) + beta * C element by 
+// element, op(B)(p, j) = B[p * b_row + j * b_col] (C isn't read if beta is 
+// 0)
+template <typename T>
+inline void gemm_small_edge(I_t i_begin, I_t i_end, I_t j_begin, I_t j_end,
+                            I_t k, T alpha, const T* A, I_t lda, const T* B,
+                            I_t b_row, I_t b_col, T beta, T* C, I_t ldc) {
+
+  for (I_t j = j_begin; j < j_end; ++j) {
+    for (I_t i = i_begin; i < i_end; ++i) {
+      auto sum = cast<T>(0.0);
+      for (I_t p = 0; p < k; ++p) {
+        sum += A[i + p * lda] * B[p * b_row + j * b_col];
+      }
+      auto& c = C[i + j * ldc];
+      c = (beta == cast<T>(0.0)) ? alpha * sum : alpha * sum + beta * c;
+    }
+  }
+
+}
+
+// Single threaded GEMM on the block C(row:row+m, col:col+n)
+template <typename T>
+inline void gemm_block(char transa, char transb, I_t row, I_t col, I_t m,
+                       I_t n, I_t k, T alpha, const T* A, I_t lda,
+                       const T* B, I_t ldb, T beta, T* C, I_t ldc) {
+
+  typedef GEMMKernel<T> Kernel;
+  const I_t MR = Kernel::MR, NR = Kernel::NR;
+  const I_t MC = Kernel::MC, KC = Kernel::KC, NC = Kernel::NC;
+
+  // Packing buffers are reused across calls from the same thread
+  static thread_local std::vector<T> A_packed, B_packed;
+  auto max_kc = std::min(KC, k);
+  A_packed.resize(std::max(A_packed.size(), std::size_t(
+                    ((std::min(MC, m) + MR - 1) / MR) * MR * max_kc)));
+  B_packed.resize(std::max(B_packed.size(), std::size_t(
+                    ((std::min(NC, n) + NR - 1) / NR) * NR * max_kc)));
+
+  T AB[Kernel::MR * Kernel::NR];
+
+  for (I_t jc = 0; jc < n; jc += NC) {
+
+    auto nc = std::min(NC, n - jc);
+
+    for (I_t pc = 0; pc < k; pc += KC) {
+
+      auto kc = std::min(KC, k - pc);
+
+      // Later blocks of the sum add to what the first one stored
+      auto beta_block = (pc == 0) ? beta : cast<T>(1.0);
+
+      gemm_pack_B<T, Kernel::NR>(transb, B, ldb, pc, col + jc, kc, nc,
+                                 B_packed.data());
+
+      for (I_t ic = 0; ic < m; ic += MC) {
+
+        auto mc = std::min(MC, m - ic);
+
+        gemm_pack_A<T, Kernel::MR>(transa, A, lda, row + ic, pc, mc, kc,
+                                   A_packed.data());
+
+        for (I_t jr = 0; jr < nc; jr += NR) {
+          for (I_t ir = 0; ir < mc; ir += MR) {
+
+            Kernel::multiply(kc, A_packed.data() + ir * kc, MR,
+                             B_packed.data() + jr * kc, NR, 1, AB);
+
+            gemm_update<T, Kernel::MR>(std::min(MR, mc - ir),
+                                       std::min(NR, nc - jr), alpha, AB,
+                                       beta_block,
+                                       C + (row + ic + ir) +
+                                           (col + jc + jr) * ldc,
+                                       ldc);
+
+          }
+        }
+
+      }
+
+    }
+
+  }
+
+}
+
+// Split C (m x n) into one block per thread (along both dimensions, aligned
+// to the register blocking MR x NR) and call block(row, col, rows, cols) for
+// each non-empty block in parallel
+template <typename Function>
+inline void gemm_parallel(I_t m, I_t n, I_t k, I_t MR, I_t NR, int n_threads,
+                          Function block) {
+
+  // Only use as many threads as there are sufficiently large blocks
+  const double min_flops_per_thread = 1 << 22;
+  auto max_threads = int(double(m) * n * k / min_flops_per_thread) + 1;
+  if (n_threads <= 0) n_threads = Threads::hardware_threads();
+  n_threads = std::min(n_threads, max_threads);
+
+  // Thread grid with the squarest blocks
+  int grid_rows = 1;
+  auto aspect = [&](int rows) {
+    auto ratio = (double(m) / rows) / (double(n) / (n_threads / rows));
+    return (ratio > 1) ? ratio : 1 / ratio;
+  };
+  for (int rows = 1; rows <= n_threads; ++rows) {
+    if (n_threads % rows == 0 && aspect(rows) < aspect(grid_rows)) {
+      grid_rows = rows;
+    }
+  }
+  auto grid_cols = n_threads / grid_rows;
+
+  // Block boundaries, aligned to the register blocking
+  auto row_boundary = [&](I_t index) {
+    return (index == grid_rows) ? m : (m * index / grid_rows) / MR * MR;
+  };
+  auto col_boundary = [&](I_t index) {
+    return (index == grid_cols) ? n : (n * index / grid_cols) / NR * NR;
+  };
+
+  Threads::parallel_for(n_threads, [&](I_t first, I_t last) {
+    for (auto t = first; t < last; ++t) {
+      auto row = row_boundary(t % grid_rows);
+      auto col = col_boundary(t / grid_rows);
+      auto rows = row_boundary(t % grid_rows + 1) - row;
+      auto cols = col_boundary(t / grid_rows + 1) - col;
+      if (rows > 0 && cols > 0) block(row, col, rows, cols);
+    }
+  }, n_threads);
+
+}
+#endif /* DOXYGEN_SKIP */
+
+/** \brief            General matrix-matrix multiply
+ *
+ *  C = alpha * op(A) * op(B) + beta * C
+ *
+ *  Packed, cache blocked implementation for systems without an optimized
+ *  BLAS library (see USE_NATIVE_GEMM in preprocessor.h). The micro-kernels
+ *  for S_t and D_t use AVX-512 or AVX2/FMA when the compiler targets them
+ *  (e.g. with -march=native), otherwise portable C++ kernels are used.
+ *
+ *  C is split into one block per thread (along both dimensions, aligned to
+ *  the register blocking), each block is computed independently.
+ *
+ *  \param[in]        transa
+ *                    'N', 'T' or 'C'.
+ *
+ *  \param[in]        transb
+ *                    'N', 'T' or 'C'.
+ *
+ *  \param[in]        m
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        k
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        ldb
+ *
+ *  \param[in]        beta
+ *                    If zero, C isn't read.
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        ldc
+ *
+ *  \param[in]        n_threads
+ *                    OPTIONAL: maximal number of threads, <= 0 uses all
+ *                    hardware threads. Small products use fewer threads.
+ *                    Default: 0.
+ */
+template <typename T>
+inline void xGEMM(char transa, char transb, I_t m, I_t n, I_t k, T alpha,
+                  const T* A, I_t lda, const T* B, I_t ldb, T beta, T* C,
+                  I_t ldc, int n_threads = 0) {
+
+  PROFILING_FUNCTION_HEADER
+
+  if (transa == 'n' || transa == 't' || transa == 'c') transa -= 'a' - 'A';
+  if (transb == 'n' || transb == 't' || transb == 'c') transb -= 'a' - 'A';
+
+#ifndef LINALG_NO_CHECKS
+  if ((transa != 'N' && transa != 'T' && transa != 'C') ||
+      (transb != 'N' && transb != 'T' && transb != 'C')) {
+    throw excBadArgument("NATIVE::xGEMM(): invalid transposition ('%c', "
+                         "'%c')", transa, transb);
+  }
+#endif
+
+  if (m <= 0 || n <= 0) return;
+
+  if (k <= 0 || alpha == cast<T>(0.0)) {
+    for (I_t j = 0; j < n; ++j) {
+      for (I_t i = 0; i < m; ++i) {
+        auto& c = C[i + j * ldc];
+        c = (beta == cast<T>(0.0)) ? cast<T>(0.0) : beta * c;
+      }
+    }
+    return;
+  }
+
+  gemm_parallel(m, n, k, GEMMKernel<T>::MR, GEMMKernel<T>::NR, n_threads,
+                [&](I_t row, I_t col, I_t rows, I_t cols) {
+    gemm_block(transa, transb, row, col, rows, cols, k, alpha, A, lda, B, ldb,
+               beta, C, ldc);
+  });
+
+}
+
+/** \brief            General matrix-matrix multiply for small matrices
+ *
+ *  C = alpha * op(A) * op(B) + beta * C
+ *
+ *  Single threaded variant of xGEMM() for operands that fit in the cache 
+ *  together (e.g. the products of xGEMM_batched()), where packing and the 
+ *  thread setup of xGEMM() cost more than they save. The register blocks of 
+ *  C are computed directly from A and B with one SIMD vector of rows per 
+ *  block, transposed A and conjugated B are copied once beforehand. Rows and 
+ *  columns that don't fill a register block are computed element by 
+ *  element.
+ *
+ *  Arguments as for xGEMM(), transa and transb must be upper case.
+ */
+template <typename T>
+inline void xGEMM_small(char transa, char transb, I_t m, I_t n, I_t k,
+                        T alpha, const T* A, I_t lda, const T* B, I_t ldb,
+                        T beta, T* C, I_t ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  typedef GEMMSmallKernel<T> Kernel;
+  const I_t MR = Kernel::MR, NR = Kernel::NR;
+
+  if (m == 0 || n == 0) return;
+
+  if (k == 0 || alpha == cast<T>(0.0)) {
+    gemm_small_edge(0, m, 0, n, 0, alpha, A, lda, B, 1, 1, beta, C, ldc);
+    return;
+  }
+
+  // Buffers for the copies are reused across calls from the same thread
+  static thread_local std::vector<T> A_copy, B_copy;
+
+  if (transa != 'N') {
+    A_copy.resize(std::max(A_copy.size(), std::size_t(m * k)));
+    for (I_t p = 0; p < k; ++p) {
+      for (I_t i = 0; i < m; ++i) {
+        auto value = A[p + i * lda];
+        A_copy[i + p * m] = (transa == 'C') ? conj(value) : value;
+      }
+    }
+    A   = A_copy.data();
+    lda = m;
+  }
+
+  if (transb == 'C') {
+    B_copy.resize(std::max(B_copy.size(), std::size_t(k * n)));
+    for (I_t j = 0; j < n; ++j) {
+      for (I_t p = 0; p < k; ++p) B_copy[p + j * k] = conj(B[j + p * ldb]);
+    }
+    B      = B_copy.data();
+    ldb    = k;
+    transb = 'N';
+  }
+
+  // op(B)(p, j) = B[p * b_row + j * b_col]
+  auto b_row  = (transb == 'N') ? I_t(1) : ldb;
+  auto b_col  = (transb == 'N') ? ldb : I_t(1);
+  auto m_full = m - m % MR;
+  auto n_full = n - n % NR;
+
+  T AB[Kernel::MR * Kernel::NR];
+
+  for (I_t j = 0; j < n_full; j += NR) {
+    for (I_t i = 0; i < m_full; i += MR) {
+      Kernel::multiply(k, A + i, lda, B + j * b_col, b_row, b_col, AB);
+      gemm_update<T, Kernel::MR>(MR, NR, alpha, AB, beta, C + i + j * ldc,
+                                 ldc);
+    }
+  }
+
+  gemm_small_edge(m_full, m, 0, n_full, k, alpha, A, lda, B, b_row, b_col,
+                  beta, C, ldc);
+  gemm_small_edge(0, m, n_full, n, k, alpha, A, lda, B, b_row, b_col, beta,
+                  C, ldc);
+
+}
+
+using LinAlg::Utilities::check_output_transposed;
+
+/** \brief            General matrix-matrix multiply in main memory
+ *
+ *  C = alpha * op(A) * op(B) + beta * C
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        n_threads
+ *                    OPTIONAL: maximal number of threads, <= 0 uses all
+ *                    hardware threads. Default: 0.
+ */
+template <typename T>
+inline void xGEMM(const T alpha, const Dense<T>& A, const Dense<T>& B,
+                  const T beta, Dense<T>& C, int n_threads = 0) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_output_transposed(C, "NATIVE::xGEMM(alpha, A, B, beta, C)");
+  if (A.rows() != C.rows() || A.cols() != B.rows() || B.cols() != C.cols()) {
+    throw excBadArgument("NATIVE::xGEMM(alpha, A, B, beta, C), A, B, C: "
+                         "argument matrix size mismatch (A:%dx%d B:%dx%d "
+                         "C:%dx%d)", A.rows(), A.cols(), B.rows(), B.cols(),
+                         C.rows(), C.cols());
+  }
+  if (A._location != Location::host || B._location != Location::host ||
+      C._location != Location::host) {
+    throw excUnimplemented("NATIVE::xGEMM(): native GEMM only supported in "
+                           "main memory");
+  }
+#endif
+
+  xGEMM(A._transposed ? 'T' : 'N', B._transposed ? 'T' : 'N', C.rows(),
+        C.cols(), A.cols(), alpha, A._begin(), A._leading_dimension,
+        B._begin(), B._leading_dimension, beta, C._begin(),
+        C._leading_dimension, n_threads);
+
+}
+
+} /* namespace LinAlg::BLAS::NATIVE */
+
+} /* namespace LinAlg::BLAS */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_BLAS_NATIVE_GEMM_H_ */
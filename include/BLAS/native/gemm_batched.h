@@ -0,0 +1,267 @@
+/** \file
+ *
+ *  \brief            xGEMM_batched (native)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_BLAS_NATIVE_GEMM_BATCHED_H_
+#define LINALG_BLAS_NATIVE_GEMM_BATCHED_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::BLAS
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *    LinAlg::BLAS::NATIVE
+ *        implementations within LinAlg
+ */
+
+#include <algorithm>  // std::min
+#include <vector>     // std::vector
+
+#include "../../preprocessor.h"
+#include "../../types.h"
+#include "../../profiling.h"
+#include "../../exceptions.h"
+#include "../../executor.h"
+#include "../../utilities/checks.h"
+#include "../../dense.h"
+#include "gemm.h"
+#include "gemm_fixed.h"
+
+namespace LinAlg {
+
+namespace BLAS {
+
+namespace NATIVE {
+
+#ifndef DOXYGEN_SKIP
+// Products with m * n * k up to this use xGEMM_small(), above it packing
+// pays off
+const double gemm_small_limit = 96. * 96. * 96.;
+
+// Number of threads for a batch with the given total m * n * k (same work
+// per thread as xGEMM())
+inline int gemm_batch_threads(double work, I_t batch, int n_threads) {
+  const double min_flops_per_thread = 1 << 22;
+  auto max_threads = int(work / min_flops_per_thread) + 1;
+  if (n_threads <= 0) n_threads = Threads::hardware_threads();
+  return int(std::min(I_t(std::min(n_threads, max_threads)), batch));
+}
+
+// One product of a batch, transa and transb upper case. Threads are only
+// used within a product if the batch is smaller than the number of threads.
+template <typename T>
+inline void gemm_batch_product(char transa, char transb, I_t m, I_t n, I_t k,
+                               T alpha, const T* A, I_t lda, const T* B,
+                               I_t ldb, T beta, T* C, I_t ldc,
+                               int n_threads) {
+  if (xGEMM_fixed(transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C,
+                  ldc)) {
+    return;
+  } else if (n_threads <= 1 && double(m) * n * k <= gemm_small_limit) {
+    xGEMM_small(transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+  } else {
+    xGEMM(transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc,
+          n_threads);
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+/** \brief            Batch of general matrix-matrix multiplies with
+ *                    equidistant operands
+ *
+ *  C_i = alpha * op(A_i) * op(B_i) + beta * C_i, i = 0 .. batch - 1
+ *
+ *  with A_i = A + i * stride_a, B_i = B + i * stride_b and
+ *  C_i = C + i * stride_c.
+ *
+ *  The products are distributed over the threads, each product is computed
+ *  by one thread with xGEMM_small() or, for products too large to fit in
+ *  the cache, the packed kernels of xGEMM(). Tiny products use the fixed 
+ *  size kernels of xGEMM_fixed(). The C_i must not overlap.
+ *
+ *  \param[in]        transa
+ *                    'N', 'T' or 'C'.
+ *
+ *  \param[in]        transb
+ *                    'N', 'T' or 'C'.
+ *
+ *  \param[in]        m
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        k
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in]        stride_a
+ *                    Distance between the first elements of consecutive
+ *                    A_i.
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        ldb
+ *
+ *  \param[in]        stride_b
+ *                    Distance between the first elements of consecutive
+ *                    B_i.
+ *
+ *  \param[in]        beta
+ *                    If zero, C isn't read.
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        ldc
+ *
+ *  \param[in]        stride_c
+ *                    Distance between the first elements of consecutive
+ *                    C_i.
+ *
+ *  \param[in]        batch
+ *                    Number of products.
+ *
+ *  \param[in]        n_threads
+ *                    OPTIONAL: maximal number of threads, <= 0 uses all
+ *                    hardware threads. Small batches use fewer threads.
+ *                    Default: 0.
+ */
+template <typename T>
+inline void xGEMM_strided_batched(char transa, char transb, I_t m, I_t n,
+                                  I_t k, T alpha, const T* A, I_t lda,
+                                  I_t stride_a, const T* B, I_t ldb,
+                                  I_t stride_b, T beta, T* C, I_t ldc,
+                                  I_t stride_c, I_t batch,
+                                  int n_threads = 0) {
+
+  PROFILING_FUNCTION_HEADER
+
+  if (transa == 'n' || transa == 't' || transa == 'c') transa -= 'a' - 'A';
+  if (transb == 'n' || transb == 't' || transb == 'c') transb -= 'a' - 'A';
+
+#ifndef LINALG_NO_CHECKS
+  if ((transa != 'N' && transa != 'T' && transa != 'C') ||
+      (transb != 'N' && transb != 'T' && transb != 'C')) {
+    throw excBadArgument("NATIVE::xGEMM_strided_batched(): invalid "
+                         "transposition ('%c', '%c')", transa, transb);
+  }
+#endif
+
+  if (batch <= 0 || m <= 0 || n <= 0) return;
+
+  auto threads         = gemm_batch_threads(double(m) * n * k * batch, batch,
+                                            n_threads);
+  auto product_threads = (n_threads <= 0) ? Threads::hardware_threads()
+                                          : n_threads;
+  product_threads      = std::max(1, product_threads / int(batch));
+
+  Threads::parallel_for(batch, [&](I_t first, I_t last) {
+    for (auto i = first; i < last; ++i) {
+      gemm_batch_product(transa, transb, m, n, k, alpha, A + i * stride_a,
+                         lda, B + i * stride_b, ldb, beta, C + i * stride_c,
+                         ldc, product_threads);
+    }
+  }, threads);
+
+}
+
+/** \brief            Batch of general matrix-matrix multiplies
+ *
+ *  C[i] = alpha * A[i] * B[i] + beta * C[i], i = 0 .. C.size() - 1
+ *
+ *  The products may have different sizes. They are distributed over the
+ *  threads like in xGEMM_strided_batched(), the arguments are checked once
+ *  for the whole batch.
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ *                    The matrices must not overlap.
+ *
+ *  \param[in]        n_threads
+ *                    OPTIONAL: maximal number of threads, <= 0 uses all
+ *                    hardware threads. Small batches use fewer threads.
+ *                    Default: 0.
+ */
+template <typename T>
+inline void xGEMM_batched(const T alpha, const std::vector<Dense<T>>& A,
+                          const std::vector<Dense<T>>& B, const T beta,
+                          std::vector<Dense<T>>& C, int n_threads = 0) {
+
+  PROFILING_FUNCTION_HEADER
+
+  auto batch = I_t(C.size());
+  double work = 0;
+
+#ifndef LINALG_NO_CHECKS
+  if (A.size() != C.size() || B.size() != C.size()) {
+    throw excBadArgument("NATIVE::xGEMM_batched(alpha, A, B, beta, C), A, B, "
+                         "C: batch size mismatch (A:%d B:%d C:%d)",
+                         int(A.size()), int(B.size()), int(C.size()));
+  }
+#endif
+
+  for (I_t i = 0; i < batch; ++i) {
+#ifndef LINALG_NO_CHECKS
+    check_output_transposed(C[i], "NATIVE::xGEMM_batched(alpha, A, B, beta, "
+                            "C)");
+    if (A[i].rows() != C[i].rows() || A[i].cols() != B[i].rows() ||
+        B[i].cols() != C[i].cols()) {
+      throw excBadArgument("NATIVE::xGEMM_batched(alpha, A, B, beta, C), A, "
+                           "B, C: argument matrix size mismatch in product "
+                           "%d (A:%dx%d B:%dx%d C:%dx%d)", i, A[i].rows(),
+                           A[i].cols(), B[i].rows(), B[i].cols(),
+                           C[i].rows(), C[i].cols());
+    }
+    if (A[i]._location != Location::host ||
+        B[i]._location != Location::host ||
+        C[i]._location != Location::host) {
+      throw excUnimplemented("NATIVE::xGEMM_batched(): native GEMM only "
+                             "supported in main memory");
+    }
+#endif
+    work += double(C[i].rows()) * C[i].cols() * A[i].cols();
+  }
+
+  if (batch == 0) return;
+
+  auto threads         = gemm_batch_threads(work, batch, n_threads);
+  auto product_threads = (n_threads <= 0) ? Threads::hardware_threads()
+                                          : n_threads;
+  product_threads      = std::max(1, product_threads / int(batch));
+
+  Threads::parallel_for(batch, [&](I_t first, I_t last) {
+    for (auto i = first; i < last; ++i) {
+      gemm_batch_product(A[i]._transposed ? 'T' : 'N',
+                         B[i]._transposed ? 'T' : 'N', C[i].rows(),
+                         C[i].cols(), A[i].cols(), alpha, A[i]._begin(),
+                         A[i]._leading_dimension, B[i]._begin(),
+                         B[i]._leading_dimension, beta, C[i]._begin(),
+                         C[i]._leading_dimension, product_threads);
+    }
+  }, threads);
+
+}
+
+} /* namespace LinAlg::BLAS::NATIVE */
+
+} /* namespace LinAlg::BLAS */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_BLAS_NATIVE_GEMM_BATCHED_H_ */
@@ -0,0 +1,274 @@
+/** \file
+ *
+ *  \brief            xGEMM for small matrices of fixed size (native)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_BLAS_NATIVE_GEMM_FIXED_H_
+#define LINALG_BLAS_NATIVE_GEMM_FIXED_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::BLAS
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *    LinAlg::BLAS::NATIVE
+ *        implementations within LinAlg
+ */
+
+#include "../../preprocessor.h"
+#include "../../types.h"
+
+namespace LinAlg {
+
+namespace BLAS {
+
+namespace NATIVE {
+
+#ifndef DOXYGEN_SKIP
+/*  The products are computed column by column: column j of C is accumulated
+ *  in M values that the compiler keeps in (vector) registers, each step adds
+ *  column p of op(A) times the scalar op(B)(p, j). All loops have trip
+ *  counts known at compile time and are unrolled completely (LINALG_UNROLL,
+ *  see preprocessor.h), such that the accumulators are never written to
+ *  memory. op(A) is first copied to an array on the stack (split
+ *  into real and imaginary parts for complex types), which makes all its
+ *  offsets compile time constants.
+ *
+ *  multiply() computes C = alpha * op(A) * op(B) + beta * C with
+ *  op(A)(i, p) = A[i * a_row + p * a_col] and op(B)(p, j) =
+ *  B[p * b_row + j * b_col] (C isn't read if beta is 0).
+ */
+
+// Real types
+template <typename T, int M, int N, int K>
+struct SmallGEMMProduct {
+
+  static inline void multiply(const T* A, I_t a_row, I_t a_col, bool,
+                              const T* B, I_t b_row, I_t b_col, bool,
+                              T alpha, T beta, T* C, I_t ldc) {
+
+    T a[M * K];
+    for (int p = 0; p < K; ++p) {
+      for (int i = 0; i < M; ++i) a[i + p * M] = A[i * a_row + p * a_col];
+    }
+
+    for (int j = 0; j < N; ++j) {
+
+      T c[M];
+      LINALG_UNROLL
+      for (int i = 0; i < M; ++i) c[i] = cast<T>(0.0);
+
+      LINALG_UNROLL
+      for (int p = 0; p < K; ++p) {
+        auto b = B[p * b_row + j * b_col];
+        LINALG_UNROLL
+        for (int i = 0; i < M; ++i) c[i] += a[i + p * M] * b;
+      }
+
+      auto C_j = C + j * ldc;
+      if (beta == cast<T>(0.0)) {
+        LINALG_UNROLL
+        for (int i = 0; i < M; ++i) C_j[i] = alpha * c[i];
+      } else {
+        LINALG_UNROLL
+        for (int i = 0; i < M; ++i) C_j[i] = alpha * c[i] + beta * C_j[i];
+      }
+
+    }
+
+  }
+
+};
+
+// Complex types (real arithmetic on the split real and imaginary parts of
+// op(A), which vectorizes and avoids the overflow handling of the complex
+// multiplication)
+template <typename T, int M, int N, int K>
+struct SmallGEMMComplexProduct {
+
+  static inline void multiply(const T* A, I_t a_row, I_t a_col, bool conj_a,
+                              const T* B, I_t b_row, I_t b_col, bool conj_b,
+                              T alpha, T beta, T* C, I_t ldc) {
+
+    typedef typename RealType<T>::type R;
+
+    R a_real[M * K], a_imag[M * K];
+    R sign_a = conj_a ? R(-1) : R(1), sign_b = conj_b ? R(-1) : R(1);
+
+    for (int p = 0; p < K; ++p) {
+      for (int i = 0; i < M; ++i) {
+        auto value = A[i * a_row + p * a_col];
+        a_real[i + p * M] = real(value);
+        a_imag[i + p * M] = sign_a * imag(value);
+      }
+    }
+
+    for (int j = 0; j < N; ++j) {
+
+      R c_real[M], c_imag[M];
+      LINALG_UNROLL
+      for (int i = 0; i < M; ++i) c_real[i] = c_imag[i] = R(0);
+
+      LINALG_UNROLL
+      for (int p = 0; p < K; ++p) {
+        auto b      = B[p * b_row + j * b_col];
+        auto b_real = real(b);
+        auto b_imag = sign_b * imag(b);
+        LINALG_UNROLL
+        for (int i = 0; i < M; ++i) {
+          c_real[i] += a_real[i + p * M] * b_real - a_imag[i + p * M] * b_imag;
+          c_imag[i] += a_real[i + p * M] * b_imag + a_imag[i + p * M] * b_real;
+        }
+      }
+
+      auto C_j = C + j * ldc;
+      if (beta == cast<T>(0.0)) {
+        for (int i = 0; i < M; ++i) {
+          C_j[i] = alpha * cast<T>(c_real[i], c_imag[i]);
+        }
+      } else {
+        for (int i = 0; i < M; ++i) {
+          C_j[i] = alpha * cast<T>(c_real[i], c_imag[i]) + beta * C_j[i];
+        }
+      }
+
+    }
+
+  }
+
+};
+
+template <int M, int N, int K>
+struct SmallGEMMProduct<C_t, M, N, K>
+       : SmallGEMMComplexProduct<C_t, M, N, K> {};
+template <int M, int N, int K>
+struct SmallGEMMProduct<Z_t, M, N, K>
+       : SmallGEMMComplexProduct<Z_t, M, N, K> {};
+#endif /* DOXYGEN_SKIP */
+
+/** \brief            General matrix-matrix multiply with sizes fixed at
+ *                    compile time
+ *
+ *  C = alpha * op(A) * op(B) + beta * C,   C is M x N, op(A) is M x K
+ *
+ *  For tiny blocks (e.g. the orbital blocks of a tight binding Hamiltonian)
+ *  the call overhead of a BLAS library dominates the arithmetic. These
+ *  kernels are unrolled completely by the compiler (for sizes up to 16) and
+ *  run single threaded.
+ *  xGEMM_fixed() dispatches runtime sizes to them.
+ *
+ *  Usage:
+ *
+ *    SmallGEMM<D_t, 4, 4, 9>::multiply('N', 'N', alpha, A, lda, B, ldb, beta,
+ *                                      C, ldc);
+ *
+ *  Arguments as for xGEMM(), transa and transb must be 'N', 'T' or 'C'.
+ */
+template <typename T, int M, int N, int K>
+struct SmallGEMM {
+
+  static inline void multiply(char transa, char transb, T alpha, const T* A,
+                              I_t lda, const T* B, I_t ldb, T beta, T* C,
+                              I_t ldc) {
+
+    auto a_row = (transa == 'N') ? I_t(1) : lda;
+    auto a_col = (transa == 'N') ? lda : I_t(1);
+    auto b_row = (transb == 'N') ? I_t(1) : ldb;
+    auto b_col = (transb == 'N') ? ldb : I_t(1);
+
+    SmallGEMMProduct<T, M, N, K>::multiply(A, a_row, a_col, transa == 'C', B,
+                                           b_row, b_col, transb == 'C', alpha,
+                                           beta, C, ldc);
+
+  }
+
+};
+
+#ifndef DOXYGEN_SKIP
+static_assert(LINALG_FIXED_GEMM_MAX >= 0 && LINALG_FIXED_GEMM_MAX <= 8,
+              "LINALG_FIXED_GEMM_MAX must be in [0, 8]");
+
+// Table of the kernels for m x n x k products, the kernel for m, n, k is at
+// index ((m - 1) * LINALG_FIXED_GEMM_MAX + n - 1) * LINALG_FIXED_GEMM_MAX +
+// k - 1
+template <typename T>
+struct SmallGEMMTable {
+
+  typedef void (*Kernel)(char, char, T, const T*, I_t, const T*, I_t, T, T*,
+                         I_t);
+
+  // (never 0 to avoid divisions by zero in the unused Fill<I> if the
+  // kernels are disabled)
+  static const int size = LINALG_FIXED_GEMM_MAX > 0 ? LINALG_FIXED_GEMM_MAX
+                                                    : 1;
+  static const int count = LINALG_FIXED_GEMM_MAX * LINALG_FIXED_GEMM_MAX *
+                           LINALG_FIXED_GEMM_MAX;
+
+  template <int I, int dummy = 0>
+  struct Fill {
+    static inline void fill(Kernel* kernels) {
+      kernels[I - 1] = &SmallGEMM<T, (I - 1) / (size * size) + 1,
+                                  (I - 1) / size % size + 1,
+                                  (I - 1) % size + 1>::multiply;
+      Fill<I - 1>::fill(kernels);
+    }
+  };
+  template <int dummy>
+  struct Fill<0, dummy> {
+    static inline void fill(Kernel*) {}
+  };
+
+  Kernel kernels[count + 1];
+
+  SmallGEMMTable() { Fill<count>::fill(kernels); }
+
+};
+#endif /* DOXYGEN_SKIP */
+
+/** \brief            General matrix-matrix multiply using the fixed size
+ *                    kernels if there is one for the given sizes
+ *
+ *  C = alpha * op(A) * op(B) + beta * C
+ *
+ *  Products with m, n, k <= LINALG_FIXED_GEMM_MAX (see preprocessor.h) are
+ *  computed with SmallGEMM<T, m, n, k>. For other sizes nothing is done.
+ *
+ *  Arguments as for xGEMM(), transa and transb must be 'N', 'T' or 'C'.
+ *
+ *  \returns          true if the product was computed, false if there is no
+ *                    kernel for the sizes
+ */
+template <typename T>
+inline bool xGEMM_fixed(char transa, char transb, I_t m, I_t n, I_t k,
+                        T alpha, const T* A, I_t lda, const T* B, I_t ldb,
+                        T beta, T* C, I_t ldc) {
+
+  const I_t size = LINALG_FIXED_GEMM_MAX;
+
+  if (m < 1 || n < 1 || k < 1 || m > size || n > size || k > size) {
+    return false;
+  }
+
+  static const SmallGEMMTable<T> table;
+
+  table.kernels[((m - 1) * size + n - 1) * size + k - 1](transa, transb, alpha,
+                                                         A, lda, B, ldb, beta,
+                                                         C, ldc);
+
+  return true;
+
+}
+
+} /* namespace LinAlg::BLAS::NATIVE */
+
+} /* namespace LinAlg::BLAS */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_BLAS_NATIVE_GEMM_FIXED_H_ */
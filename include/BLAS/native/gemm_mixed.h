@@ -0,0 +1,389 @@
+/** \file
+ *
+ *  \brief            Real-matrix x complex-matrix xGEMM (native)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_BLAS_NATIVE_GEMM_MIXED_H_
+#define LINALG_BLAS_NATIVE_GEMM_MIXED_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::BLAS
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *    LinAlg::BLAS::NATIVE
+ *        implementations within LinAlg
+ */
+
+#include <algorithm>    // std::min, std::max
+#include <type_traits>  // std::is_same
+#include <vector>       // std::vector
+
+#include "../../preprocessor.h"
+#include "../../types.h"
+#include "../../profiling.h"
+#include "../../exceptions.h"
+#include "../../utilities/checks.h"
+#include "../../dense.h"
+#include "gemm.h"
+
+namespace LinAlg {
+
+namespace BLAS {
+
+namespace NATIVE {
+
+#ifndef DOXYGEN_SKIP
+/*  Mixed products use the blocking of the real xGEMM() in gemm.h. The
+ *  complex operand is read directly from its interleaved storage while
+ *  packing and split into a packed block of real parts and one of imaginary
+ *  parts. Each micro-panel pair then takes two calls of the real
+ *  micro-kernel:
+ *
+ *    A real, B complex:    AB_real = A * B_real,  AB_imag = A * B_imag
+ *    A complex, B real:    AB_real = A_real * B,  AB_imag = A_imag * B
+ *
+ *  which is the minimal amount of arithmetic and runs at the speed of the
+ *  (vectorized) real kernels. Unlike the split done by multiply() on other
+ *  locations, no work space of the size of the operands is needed.
+ */
+
+// As gemm_pack_A() but storing the real parts in real_packed and the
+// imaginary parts in imag_packed (not stored if imag_packed is nullptr)
+template <typename R, int MR, typename T>
+inline void gemm_pack_A_split(char trans, const T* A, I_t lda, I_t row,
+                              I_t col, I_t mc, I_t kc, R* real_packed,
+                              R* imag_packed) {
+
+  auto row_stride = (trans == 'N') ? I_t(1) : lda;
+  auto col_stride = (trans == 'N') ? lda : I_t(1);
+  auto sign       = (trans == 'C') ? R(-1) : R(1);
+
+  for (I_t panel = 0; panel < mc; panel += MR) {
+
+    auto rows   = std::min(I_t(MR), mc - panel);
+    auto source = A + (row + panel) * row_stride + col * col_stride;
+
+    for (I_t p = 0; p < kc; ++p) {
+      for (I_t i = 0; i < rows; ++i) {
+        auto value = source[i * row_stride + p * col_stride];
+        real_packed[p * MR + i] = real(value);
+      }
+      for (I_t i = rows; i < MR; ++i) real_packed[p * MR + i] = R(0);
+    }
+    real_packed += MR * kc;
+
+    if (imag_packed == nullptr) continue;
+
+    for (I_t p = 0; p < kc; ++p) {
+      for (I_t i = 0; i < rows; ++i) {
+        auto value = source[i * row_stride + p * col_stride];
+        imag_packed[p * MR + i] = sign * imag(value);
+      }
+      for (I_t i = rows; i < MR; ++i) imag_packed[p * MR + i] = R(0);
+    }
+    imag_packed += MR * kc;
+
+  }
+
+}
+
+// As gemm_pack_B() but storing the real parts in real_packed and the
+// imaginary parts in imag_packed (not stored if imag_packed is nullptr)
+template <typename R, int NR, typename T>
+inline void gemm_pack_B_split(char trans, const T* B, I_t ldb, I_t row,
+                              I_t col, I_t kc, I_t nc, R* real_packed,
+                              R* imag_packed) {
+
+  auto row_stride = (trans == 'N') ? I_t(1) : ldb;
+  auto col_stride = (trans == 'N') ? ldb : I_t(1);
+  auto sign       = (trans == 'C') ? R(-1) : R(1);
+
+  for (I_t panel = 0; panel < nc; panel += NR) {
+
+    auto cols   = std::min(I_t(NR), nc - panel);
+    auto source = B + row * row_stride + (col + panel) * col_stride;
+
+    for (I_t p = 0; p < kc; ++p) {
+      for (I_t j = 0; j < cols; ++j) {
+        auto value = source[p * row_stride + j * col_stride];
+        real_packed[p * NR + j] = real(value);
+      }
+      for (I_t j = cols; j < NR; ++j) real_packed[p * NR + j] = R(0);
+    }
+    real_packed += NR * kc;
+
+    if (imag_packed == nullptr) continue;
+
+    for (I_t p = 0; p < kc; ++p) {
+      for (I_t j = 0; j < cols; ++j) {
+        auto value = source[p * row_stride + j * col_stride];
+        imag_packed[p * NR + j] = sign * imag(value);
+      }
+      for (I_t j = cols; j < NR; ++j) imag_packed[p * NR + j] = R(0);
+    }
+    imag_packed += NR * kc;
+
+  }
+
+}
+
+// C(0:mr, 0:nr) = alpha * (AB_real + i * AB_imag) + beta * C (C isn't read
+// if beta is 0)
+template <typename U, int MR, typename R>
+inline void gemm_update_split(I_t mr, I_t nr, U alpha, const R* AB_real,
+                              const R* AB_imag, U beta, U* C, I_t ldc) {
+
+  for (I_t j = 0; j < nr; ++j) {
+    for (I_t i = 0; i < mr; ++i) {
+      auto ab = cast<U>(AB_real[j * MR + i], AB_imag[j * MR + i]);
+      auto& c = C[i + j * ldc];
+      c = (beta == cast<U>(0.0)) ? alpha * ab : alpha * ab + beta * c;
+    }
+  }
+
+}
+
+// Single threaded mixed GEMM on the block C(row:row+m, col:col+n), exactly
+// one of TA and TB is the (complex) type U of C
+template <typename TA, typename TB, typename U>
+inline void gemm_mixed_block(char transa, char transb, I_t row, I_t col,
+                             I_t m, I_t n, I_t k, U alpha, const TA* A,
+                             I_t lda, const TB* B, I_t ldb, U beta, U* C,
+                             I_t ldc) {
+
+  typedef typename RealType<U>::type R;
+  typedef GEMMKernel<R> Kernel;
+  const I_t MR = Kernel::MR, NR = Kernel::NR;
+  const I_t MC = Kernel::MC, KC = Kernel::KC, NC = Kernel::NC;
+
+  const bool A_complex = std::is_same<TA, U>::value;
+
+  // Packing buffers are reused across calls from the same thread
+  static thread_local std::vector<R> A_real, A_imag, B_real, B_imag;
+  auto max_kc = std::min(KC, k);
+  auto A_size = std::size_t(((std::min(MC, m) + MR - 1) / MR) * MR * max_kc);
+  auto B_size = std::size_t(((std::min(NC, n) + NR - 1) / NR) * NR * max_kc);
+  A_real.resize(std::max(A_real.size(), A_size));
+  B_real.resize(std::max(B_real.size(), B_size));
+  if (A_complex) A_imag.resize(std::max(A_imag.size(), A_size));
+  else           B_imag.resize(std::max(B_imag.size(), B_size));
+
+  R AB_real[Kernel::MR * Kernel::NR], AB_imag[Kernel::MR * Kernel::NR];
+
+  for (I_t jc = 0; jc < n; jc += NC) {
+
+    auto nc = std::min(NC, n - jc);
+
+    for (I_t pc = 0; pc < k; pc += KC) {
+
+      auto kc = std::min(KC, k - pc);
+
+      // Later blocks of the sum add to what the first one stored
+      auto beta_block = (pc == 0) ? beta : cast<U>(1.0);
+
+      gemm_pack_B_split<R, Kernel::NR>(transb, B, ldb, pc, col + jc, kc, nc,
+                                       B_real.data(), A_complex ? nullptr :
+                                                      B_imag.data());
+
+      for (I_t ic = 0; ic < m; ic += MC) {
+
+        auto mc = std::min(MC, m - ic);
+
+        gemm_pack_A_split<R, Kernel::MR>(transa, A, lda, row + ic, pc, mc,
+                                         kc, A_real.data(), A_complex ?
+                                         A_imag.data() : nullptr);
+
+        for (I_t jr = 0; jr < nc; jr += NR) {
+          for (I_t ir = 0; ir < mc; ir += MR) {
+
+            auto A_panel = A_real.data() + ir * kc;
+            auto B_panel = B_real.data() + jr * kc;
+
+            Kernel::multiply(kc, A_panel, MR, B_panel, NR, 1, AB_real);
+            if (A_complex) {
+              Kernel::multiply(kc, A_imag.data() + ir * kc, MR, B_panel, NR,
+                               1, AB_imag);
+            } else {
+              Kernel::multiply(kc, A_panel, MR, B_imag.data() + jr * kc, NR,
+                               1, AB_imag);
+            }
+
+            gemm_update_split<U, Kernel::MR>(std::min(MR, mc - ir),
+                                             std::min(NR, nc - jr), alpha,
+                                             AB_real, AB_imag, beta_block,
+                                             C + (row + ic + ir) +
+                                                 (col + jc + jr) * ldc,
+                                             ldc);
+
+          }
+        }
+
+      }
+
+    }
+
+  }
+
+}
+#endif /* DOXYGEN_SKIP */
+
+/** \brief            General real-matrix x complex-matrix multiply
+ *
+ *  C = alpha * op(A) * op(B) + beta * C      with one of A and B real, the
+ *                                            other and C complex
+ *
+ *  The native counterpart of MKL's ?zgemm: the complex operand is split into
+ *  real and imaginary parts while it is packed, such that the product costs
+ *  two real products computed with the micro-kernels of xGEMM() (see there)
+ *  and no additional memory.
+ *
+ *  \param[in]        transa
+ *                    'N', 'T' or 'C'.
+ *
+ *  \param[in]        transb
+ *                    'N', 'T' or 'C'.
+ *
+ *  \param[in]        m
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        k
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *                    Real or complex, exactly one of A and B must be of the
+ *                    type of C.
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        ldb
+ *
+ *  \param[in]        beta
+ *                    If zero, C isn't read.
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        ldc
+ *
+ *  \param[in]        n_threads
+ *                    OPTIONAL: maximal number of threads, <= 0 uses all
+ *                    hardware threads. Small products use fewer threads.
+ *                    Default: 0.
+ */
+template <typename TA, typename TB, typename U>
+inline void xGEMM_mixed(char transa, char transb, I_t m, I_t n, I_t k,
+                        U alpha, const TA* A, I_t lda, const TB* B, I_t ldb,
+                        U beta, U* C, I_t ldc, int n_threads = 0) {
+
+  PROFILING_FUNCTION_HEADER
+
+  typedef GEMMKernel<typename RealType<U>::type> Kernel;
+
+  if (transa == 'n' || transa == 't' || transa == 'c') transa -= 'a' - 'A';
+  if (transb == 'n' || transb == 't' || transb == 'c') transb -= 'a' - 'A';
+
+#ifndef LINALG_NO_CHECKS
+  if ((transa != 'N' && transa != 'T' && transa != 'C') ||
+      (transb != 'N' && transb != 'T' && transb != 'C')) {
+    throw excBadArgument("NATIVE::xGEMM_mixed(): invalid transposition ('%c', "
+                         "'%c')", transa, transb);
+  }
+#endif
+
+  if (m <= 0 || n <= 0) return;
+
+  if (k <= 0 || alpha == cast<U>(0.0)) {
+    for (I_t j = 0; j < n; ++j) {
+      for (I_t i = 0; i < m; ++i) {
+        auto& c = C[i + j * ldc];
+        c = (beta == cast<U>(0.0)) ? cast<U>(0.0) : beta * c;
+      }
+    }
+    return;
+  }
+
+  // Two real products per block
+  gemm_parallel(m, n, 2 * k, Kernel::MR, Kernel::NR, n_threads,
+                [&](I_t row, I_t col, I_t rows, I_t cols) {
+    gemm_mixed_block(transa, transb, row, col, rows, cols, k, alpha, A, lda,
+                     B, ldb, beta, C, ldc);
+  });
+
+}
+
+using LinAlg::Utilities::check_output_transposed;
+
+/** \brief            General real-matrix x complex-matrix multiply in main
+ *                    memory
+ *
+ *  C = alpha * op(A) * op(B) + beta * C      with one of A and B real, the
+ *                                            other and C complex
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        n_threads
+ *                    OPTIONAL: maximal number of threads, <= 0 uses all
+ *                    hardware threads. Default: 0.
+ */
+template <typename TA, typename TB, typename U>
+inline void xGEMM_mixed(const U alpha, const Dense<TA>& A,
+                        const Dense<TB>& B, const U beta, Dense<U>& C,
+                        int n_threads = 0) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_output_transposed(C, "NATIVE::xGEMM_mixed(alpha, A, B, beta, C)");
+  if (A.rows() != C.rows() || A.cols() != B.rows() || B.cols() != C.cols()) {
+    throw excBadArgument("NATIVE::xGEMM_mixed(alpha, A, B, beta, C), A, B, "
+                         "C: argument matrix size mismatch (A:%dx%d B:%dx%d "
+                         "C:%dx%d)", A.rows(), A.cols(), B.rows(), B.cols(),
+                         C.rows(), C.cols());
+  }
+  typedef typename RealType<U>::type R;
+  if (!C._is_complex() ||
+      !((std::is_same<TA, R>::value && std::is_same<TB, U>::value) ||
+        (std::is_same<TA, U>::value && std::is_same<TB, R>::value))) {
+    throw excBadArgument("NATIVE::xGEMM_mixed(alpha, A, B, beta, C): C and "
+                         "exactly one of A and B must be complex (of the same "
+                         "precision)");
+  }
+  if (A._location != Location::host || B._location != Location::host ||
+      C._location != Location::host) {
+    throw excUnimplemented("NATIVE::xGEMM_mixed(): native GEMM only "
+                           "supported in main memory");
+  }
+#endif
+
+  xGEMM_mixed(A._transposed ? 'T' : 'N', B._transposed ? 'T' : 'N',
+              C.rows(), C.cols(), A.cols(), alpha, A._begin(),
+              A._leading_dimension, B._begin(), B._leading_dimension, beta,
+              C._begin(), C._leading_dimension, n_threads);
+
+}
+
+} /* namespace LinAlg::BLAS::NATIVE */
+
+} /* namespace LinAlg::BLAS */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_BLAS_NATIVE_GEMM_MIXED_H_ */
@@ -0,0 +1,353 @@
+/** \file
+ *
+ *  \brief            xNRM2 (BLAS-1)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_BLAS_NRM2_H_
+#define LINALG_BLAS_NRM2_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::BLAS
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *    LinAlg::BLAS::<NAME>
+ *        bindings to the <NAME> BLAS backend
+ */
+
+#include <utility>      // std::move
+
+#include "../preprocessor.h"
+
+#ifdef HAVE_CUDA
+# include <cuda_runtime.h>
+# include <cublas_v2.h>
+# include "../CUDA/cuda_checks.h"
+# include "../CUDA/cuda_cublas.h"
+#endif
+
+#include "../types.h"
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../utilities/checks.h"
+#include "../streams.h"
+#include "../dense.h"
+#include "vector_layout.h"
+
+#ifndef DOXYGEN_SKIP
+extern "C" {
+
+  using LinAlg::I_t;
+  using LinAlg::S_t;
+  using LinAlg::D_t;
+  using LinAlg::C_t;
+  using LinAlg::Z_t;
+
+  S_t fortran_name(snrm2, SNRM2)(const I_t* n, const S_t* x,
+                                 const I_t* incx);
+  D_t fortran_name(dnrm2, DNRM2)(const I_t* n, const D_t* x,
+                                 const I_t* incx);
+  S_t fortran_name(scnrm2, SCNRM2)(const I_t* n, const C_t* x,
+                                   const I_t* incx);
+  D_t fortran_name(dznrm2, DZNRM2)(const I_t* n, const Z_t* x,
+                                   const I_t* incx);
+}
+#endif /* DOXYGEN_SKIP */
+
+namespace LinAlg {
+
+namespace BLAS {
+
+namespace FORTRAN {
+
+/** \brief            Euclidean norm of a vector
+ *
+ *  sqrt(x**H * x)
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        x
+ *
+ *  \param[in]        incx
+ *
+ *  \returns          The norm
+ *
+ *  See [DNRM2](http://www.mathkeisan.com/usersguide/man/dnrm2.html)
+ */
+inline S_t xNRM2(I_t n, S_t* x, I_t incx) {
+
+  PROFILING_FUNCTION_HEADER
+
+  return fortran_name(snrm2, SNRM2)(&n, x, &incx);
+
+}
+/** \overload
+ */
+inline D_t xNRM2(I_t n, D_t* x, I_t incx) {
+
+  PROFILING_FUNCTION_HEADER
+
+  return fortran_name(dnrm2, DNRM2)(&n, x, &incx);
+
+}
+/** \overload
+ */
+inline S_t xNRM2(I_t n, C_t* x, I_t incx) {
+
+  PROFILING_FUNCTION_HEADER
+
+  return fortran_name(scnrm2, SCNRM2)(&n, x, &incx);
+
+}
+/** \overload
+ */
+inline D_t xNRM2(I_t n, Z_t* x, I_t incx) {
+
+  PROFILING_FUNCTION_HEADER
+
+  return fortran_name(dznrm2, DZNRM2)(&n, x, &incx);
+
+}
+
+} /* namespace LinAlg::BLAS::FORTRAN */
+
+#ifdef HAVE_CUDA
+namespace cuBLAS {
+
+/** \brief            Euclidean norm of a vector
+ *
+ *  result = sqrt(x**H * x)
+ *
+ *  \param[in]        handle
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        x
+ *
+ *  \param[in]        incx
+ *
+ *  \param[out]       result
+ *
+ *  See [cuBLAS Documentation](http://docs.nvidia.com/cuda/cublas/)
+ */
+inline void xNRM2(cublasHandle_t handle, I_t n, const S_t* x, I_t incx,
+                  S_t* result) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasSnrm2(handle, n, x, incx, result));
+
+}
+/** \overload
+ */
+inline void xNRM2(cublasHandle_t handle, I_t n, const D_t* x, I_t incx,
+                  D_t* result) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasDnrm2(handle, n, x, incx, result));
+
+}
+/** \overload
+ */
+inline void xNRM2(cublasHandle_t handle, I_t n, const C_t* x, I_t incx,
+                  S_t* result) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasScnrm2(handle, n, (const cuComplex*)x, incx, result));
+
+}
+/** \overload
+ */
+inline void xNRM2(cublasHandle_t handle, I_t n, const Z_t* x, I_t incx,
+                  D_t* result) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasDznrm2(handle, n, (const cuDoubleComplex*)x, incx, \
+                           result));
+
+}
+
+} /* namespace LinAlg::BLAS::cuBLAS */
+#endif /* HAVE_CUDA */
+
+using LinAlg::Utilities::check_format;
+using LinAlg::Utilities::check_vector;
+using LinAlg::Utilities::check_stream_alive;
+#ifdef HAVE_CUDA
+using LinAlg::Utilities::check_gpu_structures;
+using LinAlg::Utilities::check_stream_prefer_native;
+using LinAlg::Utilities::check_stream_device_id;
+using LinAlg::CUDA::cuBLAS::prepare_cublas;
+using LinAlg::CUDA::cuBLAS::finish_cublas;
+#endif
+
+#ifndef DOXYGEN_SKIP
+// Shared implementation of xNRM2() and xNRM2_async() on the GPU. The result
+// is written to host memory, the cuBLAS call returns after the result is
+// available.
+template <typename T>
+inline typename RealType<T>::type nrm2(const Dense<T>& x, Stream* stream,
+                                       const char* caller_name) {
+
+#ifndef LINALG_NO_CHECKS
+  check_format(Format::ColMajor, x, caller_name);
+  check_vector(-1, x, caller_name);
+#endif
+
+  auto location = x._location;
+  auto device_id = x._device_id;
+  auto n = vector_length(x);
+  auto x_ptr = x._begin();
+  auto incx = vector_increment(x);
+  typename RealType<T>::type result = 0;
+
+  if (location == Location::host) {
+
+    result = FORTRAN::xNRM2(n, x_ptr, incx);
+
+  }
+#ifdef HAVE_CUDA
+  else if (location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_gpu_structures(caller_name);
+# endif
+
+    int               prev_device = 0;
+    cudaStream_t      prev_cuda_stream;
+    Stream*           stream_ = stream;
+
+# ifndef USE_LOCAL_STREAMS
+    if (stream_ == nullptr) {
+      stream_ = &(LinAlg::CUDA::compute_stream[device_id]);
+    }
+# else
+    Stream my_stream(device_id);
+    if (stream_ == nullptr) stream_ = &my_stream;
+# endif
+
+    auto handle = prepare_cublas(*stream_, &prev_device, &prev_cuda_stream);
+    BLAS::cuBLAS::xNRM2(*handle, n, x_ptr, incx, &result);
+    finish_cublas(*stream_, &prev_device, &prev_cuda_stream, handle);
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    std::string message = caller_name;
+    message = message + ": BLAS-1 NRM2 not supported on selected location";
+    throw excUnimplemented(message);
+
+  }
+#endif
+
+  return result;
+
+}
+#endif /* DOXYGEN_SKIP */
+
+// Convenience bindings (bindings for Dense<T>)
+/** \brief            Euclidean norm of a vector
+ *
+ *  sqrt(x**H * x)
+ *
+ *  \param[in]        x
+ *                    Vector (one row or one column).
+ *
+ *  \returns          The norm
+ */
+template <typename T>
+inline typename RealType<T>::type xNRM2(const Dense<T>& x) {
+
+  PROFILING_FUNCTION_HEADER
+
+  return nrm2(x, nullptr, "xNRM2()");
+
+}
+
+/** \brief            Asynchronous euclidean norm of a vector
+ *
+ *  result = sqrt(x**H * x)
+ *
+ *  On the GPU the result is copied to result before returning (the returned
+ *  ticket is 0).
+ *
+ *  \param[in]        x
+ *
+ *  \param[out]       result
+ *                    Must stay valid until the operation completed.
+ *
+ *  \param[in]        stream
+ *
+ *  \returns          The ticket number for the operation on the stream
+ */
+template <typename T>
+inline I_t xNRM2_async(const Dense<T>& x, typename RealType<T>::type& result,
+                       Stream& stream) {
+
+  PROFILING_FUNCTION_HEADER
+
+  I_t ticket = 0;
+
+  if (x._location == Location::host && !stream.synchronous) {
+
+#ifndef LINALG_NO_CHECKS
+    check_stream_alive(stream, "xNRM2_async()");
+#endif
+
+    // Arguments passed by copy, ensures memory lifetime but callee can't
+    // modify the arguments anymore. The result is written through a pointer
+    auto result_ptr = &result;
+    auto task = [=]() mutable {
+      *result_ptr = nrm2(x, nullptr, "xNRM2_async()");
+    };
+
+    ticket = stream.add(std::move(task));
+
+  } else if (x._location == Location::host) {
+
+    result = nrm2(x, nullptr, "xNRM2_async()");
+
+  }
+#ifdef HAVE_CUDA
+  else if (x._location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_stream_prefer_native(stream, "xNRM2_async()");
+    check_stream_device_id(stream, x._device_id, "xNRM2_async()");
+# endif
+
+    result = nrm2(x, &stream, "xNRM2_async()");
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    throw excUnimplemented("xNRM2_async(): BLAS-1 NRM2 not supported on "
+                           "selected location");
+
+  }
+#endif
+
+  return ticket;
+
+}
+
+} /* namespace LinAlg::BLAS */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_BLAS_NRM2_H_ */
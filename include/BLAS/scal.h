@@ -0,0 +1,350 @@
+/** \file
+ *
+ *  \brief            xSCAL (BLAS-1)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_BLAS_SCAL_H_
+#define LINALG_BLAS_SCAL_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::BLAS
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *    LinAlg::BLAS::<NAME>
+ *        bindings to the <NAME> BLAS backend
+ */
+
+#include <utility>      // std::move
+
+#include "../preprocessor.h"
+
+#ifdef HAVE_CUDA
+# include <cuda_runtime.h>
+# include <cublas_v2.h>
+# include "../CUDA/cuda_checks.h"
+# include "../CUDA/cuda_cublas.h"
+#endif
+
+#include "../types.h"
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../utilities/checks.h"
+#include "../streams.h"
+#include "../dense.h"
+#include "vector_layout.h"
+
+#ifndef DOXYGEN_SKIP
+extern "C" {
+
+  using LinAlg::I_t;
+  using LinAlg::S_t;
+  using LinAlg::D_t;
+  using LinAlg::C_t;
+  using LinAlg::Z_t;
+
+  void fortran_name(sscal, SSCAL)(const I_t* n, const S_t* alpha, S_t* x,
+                                  const I_t* incx);
+  void fortran_name(dscal, DSCAL)(const I_t* n, const D_t* alpha, D_t* x,
+                                  const I_t* incx);
+  void fortran_name(cscal, CSCAL)(const I_t* n, const C_t* alpha, C_t* x,
+                                  const I_t* incx);
+  void fortran_name(zscal, ZSCAL)(const I_t* n, const Z_t* alpha, Z_t* x,
+                                  const I_t* incx);
+}
+#endif /* DOXYGEN_SKIP */
+
+namespace LinAlg {
+
+namespace BLAS {
+
+namespace FORTRAN {
+
+/** \brief            Scale a vector
+ *
+ *  x = alpha * x
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in,out]    x
+ *
+ *  \param[in]        incx
+ *
+ *  See [DSCAL](http://www.mathkeisan.com/usersguide/man/dscal.html)
+ */
+inline void xSCAL(I_t n, S_t alpha, S_t* x, I_t incx) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(sscal, SSCAL)(&n, &alpha, x, &incx);
+
+}
+/** \overload
+ */
+inline void xSCAL(I_t n, D_t alpha, D_t* x, I_t incx) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(dscal, DSCAL)(&n, &alpha, x, &incx);
+
+}
+/** \overload
+ */
+inline void xSCAL(I_t n, C_t alpha, C_t* x, I_t incx) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(cscal, CSCAL)(&n, &alpha, x, &incx);
+
+}
+/** \overload
+ */
+inline void xSCAL(I_t n, Z_t alpha, Z_t* x, I_t incx) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(zscal, ZSCAL)(&n, &alpha, x, &incx);
+
+}
+
+} /* namespace LinAlg::BLAS::FORTRAN */
+
+#ifdef HAVE_CUDA
+namespace cuBLAS {
+
+/** \brief            Scale a vector
+ *
+ *  x = alpha * x
+ *
+ *  \param[in]        handle
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in,out]    x
+ *
+ *  \param[in]        incx
+ *
+ *  See [cuBLAS Documentation](http://docs.nvidia.com/cuda/cublas/)
+ */
+inline void xSCAL(cublasHandle_t handle, I_t n, const S_t* alpha, S_t* x,
+                  I_t incx) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasSscal(handle, n, alpha, x, incx));
+
+}
+/** \overload
+ */
+inline void xSCAL(cublasHandle_t handle, I_t n, const D_t* alpha, D_t* x,
+                  I_t incx) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasDscal(handle, n, alpha, x, incx));
+
+}
+/** \overload
+ */
+inline void xSCAL(cublasHandle_t handle, I_t n, const C_t* alpha, C_t* x,
+                  I_t incx) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasCscal(handle, n, (const cuComplex*)alpha, \
+                          (cuComplex*)x, incx));
+
+}
+/** \overload
+ */
+inline void xSCAL(cublasHandle_t handle, I_t n, const Z_t* alpha, Z_t* x,
+                  I_t incx) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasZscal(handle, n, (const cuDoubleComplex*)alpha, \
+                          (cuDoubleComplex*)x, incx));
+
+}
+
+} /* namespace LinAlg::BLAS::cuBLAS */
+#endif /* HAVE_CUDA */
+
+using LinAlg::Utilities::check_format;
+using LinAlg::Utilities::check_vector;
+using LinAlg::Utilities::check_stream_alive;
+#ifdef HAVE_CUDA
+using LinAlg::Utilities::check_gpu_structures;
+using LinAlg::Utilities::check_stream_prefer_native;
+using LinAlg::Utilities::check_stream_device_id;
+using LinAlg::CUDA::cuBLAS::prepare_cublas;
+using LinAlg::CUDA::cuBLAS::finish_cublas;
+#endif
+
+// Convenience bindings (bindings for Dense<T>)
+/** \brief            Scale a vector
+ *
+ *  x = alpha * x
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in,out]    x
+ *                    Vector (one row or one column).
+ */
+template <typename T>
+inline void xSCAL(const T alpha, Dense<T>& x) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_format(Format::ColMajor, x, "xSCAL()");
+  check_vector(-1, x, "xSCAL()");
+#endif
+
+  auto location = x._location;
+  auto device_id = x._device_id;
+  auto n = vector_length(x);
+  auto x_ptr = x._begin();
+  auto incx = vector_increment(x);
+
+  if (location == Location::host) {
+
+    FORTRAN::xSCAL(n, alpha, x_ptr, incx);
+
+  }
+#ifdef HAVE_CUDA
+  else if (location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_gpu_structures("xSCAL()");
+# endif
+
+    int               prev_device = 0;
+    cudaStream_t      prev_cuda_stream;
+    Stream*           stream_;
+
+# ifndef USE_LOCAL_STREAMS
+    stream_ = &(LinAlg::CUDA::compute_stream[device_id]);
+# else
+    Stream my_stream(device_id);
+    stream_ = &my_stream;
+# endif
+
+    auto handle = prepare_cublas(*stream_, &prev_device, &prev_cuda_stream);
+    BLAS::cuBLAS::xSCAL(*handle, n, &alpha, x_ptr, incx);
+    finish_cublas(*stream_, &prev_device, &prev_cuda_stream, handle);
+
+    stream_->sync_cuda();
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    throw excUnimplemented("xSCAL(): BLAS-1 SCAL not supported on selected "
+                           "location");
+
+  }
+#endif
+
+}
+
+/** \brief            Asynchronously scale a vector
+ *
+ *  x = alpha * x
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in,out]    x
+ *
+ *  \param[in]        stream
+ *
+ *  \returns          The ticket number for the operation on the stream
+ */
+template <typename T>
+inline I_t xSCAL_async(const T alpha, Dense<T>& x, Stream& stream) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_format(Format::ColMajor, x, "xSCAL_async()");
+  check_vector(-1, x, "xSCAL_async()");
+#endif
+
+  I_t ticket = 0;
+
+  auto location = x._location;
+  auto device_id = x._device_id;
+
+  if (location == Location::host) {
+
+    if (stream.synchronous) {
+
+      xSCAL(alpha, x);
+
+    } else {
+
+      // Create a task using the synchronous variant
+
+#ifndef LINALG_NO_CHECKS
+      check_stream_alive(stream, "xSCAL_async()");
+#endif
+
+      // Arguments passed by copy, ensures memory lifetime but callee can't
+      // modify the arguments anymore
+      auto task = [=]() mutable { xSCAL(alpha, x); };
+
+      ticket = stream.add(std::move(task));
+
+    }
+
+  }
+#ifdef HAVE_CUDA
+  else if (location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_gpu_structures("xSCAL_async()");
+    check_stream_prefer_native(stream, "xSCAL_async()");
+    check_stream_device_id(stream, device_id, "xSCAL_async()");
+# endif
+
+    int               prev_device = 0;
+    cudaStream_t      prev_cuda_stream;
+
+    auto handle = prepare_cublas(stream, &prev_device, &prev_cuda_stream);
+    BLAS::cuBLAS::xSCAL(*handle, vector_length(x), &alpha, x._begin(),
+                        vector_increment(x));
+    finish_cublas(stream, &prev_device, &prev_cuda_stream, handle);
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    throw excUnimplemented("xSCAL_async(): BLAS-1 SCAL not supported on "
+                           "selected location");
+
+  }
+#endif
+
+  return ticket;
+
+}
+
+} /* namespace LinAlg::BLAS */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_BLAS_SCAL_H_ */
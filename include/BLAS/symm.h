@@ -0,0 +1,489 @@
+/** \file
+ *
+ *  \brief            xSYMM (BLAS-3)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_BLAS_SYMM_H_
+#define LINALG_BLAS_SYMM_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::BLAS
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *    LinAlg::BLAS::<NAME>
+ *        bindings to the <NAME> BLAS backend
+ */
+
+#include <utility>      // std::move
+
+#include "../preprocessor.h"
+
+#ifdef HAVE_CUDA
+# include <cuda_runtime.h>
+# include <cublas_v2.h>
+# include "../CUDA/cuda_checks.h"
+# include "../CUDA/cuda_cublas.h"
+#endif
+
+#include "../types.h"
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../utilities/checks.h"
+#include "../streams.h"
+#include "../dense.h"
+
+#ifndef DOXYGEN_SKIP
+extern "C" {
+
+  using LinAlg::I_t;
+  using LinAlg::S_t;
+  using LinAlg::D_t;
+  using LinAlg::C_t;
+  using LinAlg::Z_t;
+
+  void fortran_name(ssymm, SSYMM)(const char* side, const char* uplo,
+                                  const I_t* m, const I_t* n, const S_t* alpha,
+                                  const S_t* A, const I_t* lda, const S_t* B,
+                                  const I_t* ldb, const S_t* beta, S_t* C,
+                                  const I_t* ldc);
+  void fortran_name(dsymm, DSYMM)(const char* side, const char* uplo,
+                                  const I_t* m, const I_t* n, const D_t* alpha,
+                                  const D_t* A, const I_t* lda, const D_t* B,
+                                  const I_t* ldb, const D_t* beta, D_t* C,
+                                  const I_t* ldc);
+  void fortran_name(csymm, CSYMM)(const char* side, const char* uplo,
+                                  const I_t* m, const I_t* n, const C_t* alpha,
+                                  const C_t* A, const I_t* lda, const C_t* B,
+                                  const I_t* ldb, const C_t* beta, C_t* C,
+                                  const I_t* ldc);
+  void fortran_name(zsymm, ZSYMM)(const char* side, const char* uplo,
+                                  const I_t* m, const I_t* n, const Z_t* alpha,
+                                  const Z_t* A, const I_t* lda, const Z_t* B,
+                                  const I_t* ldb, const Z_t* beta, Z_t* C,
+                                  const I_t* ldc);
+}
+#endif /* DOXYGEN_SKIP */
+
+namespace LinAlg {
+
+namespace BLAS {
+
+namespace FORTRAN {
+
+/** \brief            Symmetric matrix-matrix multiply
+ *
+ *  C = alpha * A * B + beta * C    (side = 'L')
+ *  C = alpha * B * A + beta * C    (side = 'R')
+ *
+ *  where A is symmetric and only its upper (uplo = 'U') or lower (uplo =
+ *  'L') triangle is referenced.
+ *
+ *  \param[in]        side
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        m
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        ldb
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        ldc
+ *
+ *  See [DSYMM](http://www.mathkeisan.com/usersguide/man/dsymm.html)
+ */
+inline void xSYMM(char side, char uplo, int m, int n, S_t alpha, S_t* A,
+                  int lda, S_t* B, int ldb, S_t beta, S_t* C, int ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(ssymm, SSYMM)(&side, &uplo, &m, &n, &alpha, A, &lda, B, &ldb,
+                             &beta, C, &ldc);
+
+}
+/** \overload
+ */
+inline void xSYMM(char side, char uplo, int m, int n, D_t alpha, D_t* A,
+                  int lda, D_t* B, int ldb, D_t beta, D_t* C, int ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(dsymm, DSYMM)(&side, &uplo, &m, &n, &alpha, A, &lda, B, &ldb,
+                             &beta, C, &ldc);
+
+}
+/** \overload
+ */
+inline void xSYMM(char side, char uplo, int m, int n, C_t alpha, C_t* A,
+                  int lda, C_t* B, int ldb, C_t beta, C_t* C, int ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(csymm, CSYMM)(&side, &uplo, &m, &n, &alpha, A, &lda, B, &ldb,
+                             &beta, C, &ldc);
+
+}
+/** \overload
+ */
+inline void xSYMM(char side, char uplo, int m, int n, Z_t alpha, Z_t* A,
+                  int lda, Z_t* B, int ldb, Z_t beta, Z_t* C, int ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(zsymm, ZSYMM)(&side, &uplo, &m, &n, &alpha, A, &lda, B, &ldb,
+                             &beta, C, &ldc);
+
+}
+
+} /* namespace LinAlg::BLAS::FORTRAN */
+
+#ifdef HAVE_CUDA
+namespace cuBLAS {
+
+/** \brief            Symmetric matrix-matrix multiply
+ *
+ *  C = alpha * A * B + beta * C    (side = CUBLAS_SIDE_LEFT)
+ *  C = alpha * B * A + beta * C    (side = CUBLAS_SIDE_RIGHT)
+ *
+ *  \param[in]        handle
+ *
+ *  \param[in]        side
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        m
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        ldb
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        ldc
+ *
+ *  See [cuBLAS Documentation](http://docs.nvidia.com/cuda/cublas/)
+ */
+inline void xSYMM(cublasHandle_t handle, cublasSideMode_t side,
+                  cublasFillMode_t uplo, I_t m, I_t n, const S_t* alpha,
+                  const S_t* A, I_t lda, const S_t* B, I_t ldb,
+                  const S_t* beta, S_t* C, I_t ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasSsymm(handle, side, uplo, m, n, alpha, A, lda, B, ldb, \
+                          beta, C, ldc));
+
+}
+/** \overload
+ */
+inline void xSYMM(cublasHandle_t handle, cublasSideMode_t side,
+                  cublasFillMode_t uplo, I_t m, I_t n, const D_t* alpha,
+                  const D_t* A, I_t lda, const D_t* B, I_t ldb,
+                  const D_t* beta, D_t* C, I_t ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasDsymm(handle, side, uplo, m, n, alpha, A, lda, B, ldb, \
+                          beta, C, ldc));
+
+}
+/** \overload
+ */
+inline void xSYMM(cublasHandle_t handle, cublasSideMode_t side,
+                  cublasFillMode_t uplo, I_t m, I_t n, const C_t* alpha,
+                  const C_t* A, I_t lda, const C_t* B, I_t ldb,
+                  const C_t* beta, C_t* C, I_t ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasCsymm(handle, side, uplo, m, n, \
+                          (const cuComplex*)alpha, (const cuComplex*)A, lda, \
+                          (const cuComplex*)B, ldb, (const cuComplex*)beta, \
+                          (cuComplex*)C, ldc));
+
+}
+/** \overload
+ */
+inline void xSYMM(cublasHandle_t handle, cublasSideMode_t side,
+                  cublasFillMode_t uplo, I_t m, I_t n, const Z_t* alpha,
+                  const Z_t* A, I_t lda, const Z_t* B, I_t ldb,
+                  const Z_t* beta, Z_t* C, I_t ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasZsymm(handle, side, uplo, m, n, \
+                          (const cuDoubleComplex*)alpha, \
+                          (const cuDoubleComplex*)A, lda, \
+                          (const cuDoubleComplex*)B, ldb, \
+                          (const cuDoubleComplex*)beta, \
+                          (cuDoubleComplex*)C, ldc));
+
+}
+
+} /* namespace LinAlg::BLAS::cuBLAS */
+#endif /* HAVE_CUDA */
+
+using LinAlg::Utilities::check_device;
+using LinAlg::Utilities::check_format;
+using LinAlg::Utilities::check_dimensions;
+using LinAlg::Utilities::check_input_transposed;
+using LinAlg::Utilities::check_output_transposed;
+using LinAlg::Utilities::check_stream_alive;
+#ifdef HAVE_CUDA
+using LinAlg::Utilities::check_gpu_structures;
+using LinAlg::Utilities::check_stream_prefer_native;
+using LinAlg::Utilities::check_stream_device_id;
+using LinAlg::CUDA::cuBLAS::prepare_cublas;
+using LinAlg::CUDA::cuBLAS::finish_cublas;
+#endif
+
+#ifndef DOXYGEN_SKIP
+// Argument checks shared by xSYMM() and xHEMM() (and their _async variants)
+template <typename T>
+inline void check_symm(Side side, const Dense<T>& A, const Dense<T>& B,
+                       const Dense<T>& C, const char* caller_name) {
+  check_device(A, B, C, caller_name);
+  check_format(Format::ColMajor, A, caller_name);
+  check_format(Format::ColMajor, B, caller_name);
+  check_format(Format::ColMajor, C, caller_name);
+  check_input_transposed(B, caller_name);
+  check_output_transposed(C, caller_name);
+  auto size = (side == Side::left) ? C.rows() : C.cols();
+  check_dimensions(size, size, A, caller_name);
+  check_dimensions(C.rows(), C.cols(), B, caller_name);
+}
+#endif /* DOXYGEN_SKIP */
+
+// Convenience bindings (bindings for Dense<T>)
+/** \brief            Symmetric matrix-matrix multiply
+ *
+ *  C = alpha * A * B + beta * C    (side = Side::left)
+ *  C = alpha * B * A + beta * C    (side = Side::right)
+ *
+ *  where A is symmetric and only the triangle given by uplo is read. Reads
+ *  half of A compared to xGEMM(), at the same number of operations.
+ *
+ *  \param[in]        side
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ */
+template <typename T>
+inline void xSYMM(Side side, UPLO uplo, const T alpha, const Dense<T>& A,
+                  const Dense<T>& B, const T beta, Dense<T>& C) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_symm(side, A, B, C, "xSYMM()");
+#endif
+
+  auto location = A._location;
+  auto device_id = A._device_id;
+  auto m = C.rows();
+  auto n = C.cols();
+  auto A_ptr = A._begin();
+  auto lda = A._leading_dimension;
+  auto B_ptr = B._begin();
+  auto ldb = B._leading_dimension;
+  auto C_ptr = C._begin();
+  auto ldc = C._leading_dimension;
+
+  if (location == Location::host) {
+
+    char side_ = (side == Side::left)  ? 'L' : 'R';
+    char uplo_ = (uplo == UPLO::lower) ? 'L' : 'U';
+
+    FORTRAN::xSYMM(side_, uplo_, m, n, alpha, A_ptr, lda, B_ptr, ldb, beta,
+                   C_ptr, ldc);
+
+  }
+#ifdef HAVE_CUDA
+  else if (location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_gpu_structures("xSYMM()");
+# endif
+
+    auto side_ = (side == Side::left)  ? CUBLAS_SIDE_LEFT : CUBLAS_SIDE_RIGHT;
+    auto uplo_ = (uplo == UPLO::lower) ? CUBLAS_FILL_MODE_LOWER :
+                                         CUBLAS_FILL_MODE_UPPER;
+
+    int               prev_device = 0;
+    cudaStream_t      prev_cuda_stream;
+    Stream*           stream_;
+
+# ifndef USE_LOCAL_STREAMS
+    stream_ = &(LinAlg::CUDA::compute_stream[device_id]);
+# else
+    Stream my_stream(device_id);
+    stream_ = &my_stream;
+# endif
+
+    auto handle = prepare_cublas(*stream_, &prev_device, &prev_cuda_stream);
+    BLAS::cuBLAS::xSYMM(*handle, side_, uplo_, m, n, &alpha, A_ptr, lda,
+                        B_ptr, ldb, &beta, C_ptr, ldc);
+    finish_cublas(*stream_, &prev_device, &prev_cuda_stream, handle);
+
+    stream_->sync_cuda();
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    throw excUnimplemented("xSYMM(): BLAS-3 SYMM not supported on selected "
+                           "location");
+
+  }
+#endif
+
+}
+
+/** \brief            Asynchronous symmetric matrix-matrix multiply
+ *
+ *  C = alpha * A * B + beta * C    (side = Side::left)
+ *  C = alpha * B * A + beta * C    (side = Side::right)
+ *
+ *  where A is symmetric and only the triangle given by uplo is read.
+ *
+ *  \param[in]        side
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        stream
+ *
+ *  \returns          The ticket number for the operation on the stream
+ */
+template <typename T>
+inline I_t xSYMM_async(Side side, UPLO uplo, const T alpha, const Dense<T>& A,
+                       const Dense<T>& B, const T beta, Dense<T>& C,
+                       Stream& stream) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_symm(side, A, B, C, "xSYMM_async()");
+#endif
+
+  I_t ticket = 0;
+
+  auto location = A._location;
+  auto device_id = A._device_id;
+
+  if (location == Location::host) {
+
+    if (stream.synchronous) {
+
+      xSYMM(side, uplo, alpha, A, B, beta, C);
+
+    } else {
+
+      // Create a task using the synchronous variant
+
+#ifndef LINALG_NO_CHECKS
+      check_stream_alive(stream, "xSYMM_async()");
+#endif
+
+      // Arguments passed by copy, ensures memory lifetime but callee can't
+      // modify the arguments anymore
+      auto task = [=]() mutable { xSYMM(side, uplo, alpha, A, B, beta, C); };
+
+      ticket = stream.add(std::move(task));
+
+    }
+
+  }
+#ifdef HAVE_CUDA
+  else if (location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_gpu_structures("xSYMM_async()");
+    check_stream_prefer_native(stream, "xSYMM_async()");
+    check_stream_device_id(stream, device_id, "xSYMM_async()");
+# endif
+
+    auto side_ = (side == Side::left)  ? CUBLAS_SIDE_LEFT : CUBLAS_SIDE_RIGHT;
+    auto uplo_ = (uplo == UPLO::lower) ? CUBLAS_FILL_MODE_LOWER :
+                                         CUBLAS_FILL_MODE_UPPER;
+
+    int               prev_device = 0;
+    cudaStream_t      prev_cuda_stream;
+
+    auto handle = prepare_cublas(stream, &prev_device, &prev_cuda_stream);
+    BLAS::cuBLAS::xSYMM(*handle, side_, uplo_, C.rows(), C.cols(), &alpha,
+                        A._begin(), A._leading_dimension, B._begin(),
+                        B._leading_dimension, &beta, C._begin(),
+                        C._leading_dimension);
+    finish_cublas(stream, &prev_device, &prev_cuda_stream, handle);
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    throw excUnimplemented("xSYMM_async(): BLAS-3 SYMM not supported on "
+                           "selected location");
+
+  }
+#endif
+
+  return ticket;
+
+}
+
+} /* namespace LinAlg::BLAS */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_BLAS_SYMM_H_ */
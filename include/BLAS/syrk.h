@@ -0,0 +1,454 @@
+/** \file
+ *
+ *  \brief            xSYRK (BLAS-3)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_BLAS_SYRK_H_
+#define LINALG_BLAS_SYRK_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::BLAS
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *    LinAlg::BLAS::<NAME>
+ *        bindings to the <NAME> BLAS backend
+ */
+
+#include <utility>      // std::move
+
+#include "../preprocessor.h"
+
+#ifdef HAVE_CUDA
+# include <cuda_runtime.h>
+# include <cublas_v2.h>
+# include "../CUDA/cuda_checks.h"
+# include "../CUDA/cuda_cublas.h"
+#endif
+
+#include "../types.h"
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../utilities/checks.h"
+#include "../streams.h"
+#include "../dense.h"
+
+#ifndef DOXYGEN_SKIP
+extern "C" {
+
+  using LinAlg::I_t;
+  using LinAlg::S_t;
+  using LinAlg::D_t;
+  using LinAlg::C_t;
+  using LinAlg::Z_t;
+
+  void fortran_name(ssyrk, SSYRK)(const char* uplo, const char* trans,
+                                  const I_t* n, const I_t* k, const S_t* alpha,
+                                  const S_t* A, const I_t* lda,
+                                  const S_t* beta, S_t* C, const I_t* ldc);
+  void fortran_name(dsyrk, DSYRK)(const char* uplo, const char* trans,
+                                  const I_t* n, const I_t* k, const D_t* alpha,
+                                  const D_t* A, const I_t* lda,
+                                  const D_t* beta, D_t* C, const I_t* ldc);
+  void fortran_name(csyrk, CSYRK)(const char* uplo, const char* trans,
+                                  const I_t* n, const I_t* k, const C_t* alpha,
+                                  const C_t* A, const I_t* lda,
+                                  const C_t* beta, C_t* C, const I_t* ldc);
+  void fortran_name(zsyrk, ZSYRK)(const char* uplo, const char* trans,
+                                  const I_t* n, const I_t* k, const Z_t* alpha,
+                                  const Z_t* A, const I_t* lda,
+                                  const Z_t* beta, Z_t* C, const I_t* ldc);
+}
+#endif /* DOXYGEN_SKIP */
+
+namespace LinAlg {
+
+namespace BLAS {
+
+namespace FORTRAN {
+
+/** \brief            Symmetric rank-k update
+ *
+ *  C = alpha * A * A**T + beta * C    (trans = 'N')
+ *  C = alpha * A**T * A + beta * C    (trans = 'T')
+ *
+ *  where C is symmetric and only its upper (uplo = 'U') or lower (uplo =
+ *  'L') triangle is referenced and updated.
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        trans
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        k
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        ldc
+ *
+ *  See [DSYRK](http://www.mathkeisan.com/usersguide/man/dsyrk.html)
+ */
+inline void xSYRK(char uplo, char trans, int n, int k, S_t alpha, S_t* A,
+                  int lda, S_t beta, S_t* C, int ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(ssyrk, SSYRK)(&uplo, &trans, &n, &k, &alpha, A, &lda, &beta, C,
+                             &ldc);
+
+}
+/** \overload
+ */
+inline void xSYRK(char uplo, char trans, int n, int k, D_t alpha, D_t* A,
+                  int lda, D_t beta, D_t* C, int ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(dsyrk, DSYRK)(&uplo, &trans, &n, &k, &alpha, A, &lda, &beta, C,
+                             &ldc);
+
+}
+/** \overload
+ */
+inline void xSYRK(char uplo, char trans, int n, int k, C_t alpha, C_t* A,
+                  int lda, C_t beta, C_t* C, int ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(csyrk, CSYRK)(&uplo, &trans, &n, &k, &alpha, A, &lda, &beta, C,
+                             &ldc);
+
+}
+/** \overload
+ */
+inline void xSYRK(char uplo, char trans, int n, int k, Z_t alpha, Z_t* A,
+                  int lda, Z_t beta, Z_t* C, int ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(zsyrk, ZSYRK)(&uplo, &trans, &n, &k, &alpha, A, &lda, &beta, C,
+                             &ldc);
+
+}
+
+} /* namespace LinAlg::BLAS::FORTRAN */
+
+#ifdef HAVE_CUDA
+namespace cuBLAS {
+
+/** \brief            Symmetric rank-k update
+ *
+ *  C = alpha * op(A) * op(A)**T + beta * C
+ *
+ *  \param[in]        handle
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        trans
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        k
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        ldc
+ *
+ *  See [cuBLAS Documentation](http://docs.nvidia.com/cuda/cublas/)
+ */
+inline void xSYRK(cublasHandle_t handle, cublasFillMode_t uplo,
+                  cublasOperation_t trans, I_t n, I_t k, const S_t* alpha,
+                  const S_t* A, I_t lda, const S_t* beta, S_t* C, I_t ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasSsyrk(handle, uplo, trans, n, k, alpha, A, lda, beta, C, \
+                          ldc));
+
+}
+/** \overload
+ */
+inline void xSYRK(cublasHandle_t handle, cublasFillMode_t uplo,
+                  cublasOperation_t trans, I_t n, I_t k, const D_t* alpha,
+                  const D_t* A, I_t lda, const D_t* beta, D_t* C, I_t ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasDsyrk(handle, uplo, trans, n, k, alpha, A, lda, beta, C, \
+                          ldc));
+
+}
+/** \overload
+ */
+inline void xSYRK(cublasHandle_t handle, cublasFillMode_t uplo,
+                  cublasOperation_t trans, I_t n, I_t k, const C_t* alpha,
+                  const C_t* A, I_t lda, const C_t* beta, C_t* C, I_t ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasCsyrk(handle, uplo, trans, n, k, \
+                          (const cuComplex*)alpha, (const cuComplex*)A, lda, \
+                          (const cuComplex*)beta, (cuComplex*)C, ldc));
+
+}
+/** \overload
+ */
+inline void xSYRK(cublasHandle_t handle, cublasFillMode_t uplo,
+                  cublasOperation_t trans, I_t n, I_t k, const Z_t* alpha,
+                  const Z_t* A, I_t lda, const Z_t* beta, Z_t* C, I_t ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasZsyrk(handle, uplo, trans, n, k, \
+                          (const cuDoubleComplex*)alpha, \
+                          (const cuDoubleComplex*)A, lda, \
+                          (const cuDoubleComplex*)beta, \
+                          (cuDoubleComplex*)C, ldc));
+
+}
+
+} /* namespace LinAlg::BLAS::cuBLAS */
+#endif /* HAVE_CUDA */
+
+using LinAlg::Utilities::check_device;
+using LinAlg::Utilities::check_format;
+using LinAlg::Utilities::check_dimensions;
+using LinAlg::Utilities::check_output_transposed;
+using LinAlg::Utilities::check_stream_alive;
+#ifdef HAVE_CUDA
+using LinAlg::Utilities::check_gpu_structures;
+using LinAlg::Utilities::check_stream_prefer_native;
+using LinAlg::Utilities::check_stream_device_id;
+using LinAlg::CUDA::cuBLAS::prepare_cublas;
+using LinAlg::CUDA::cuBLAS::finish_cublas;
+#endif
+
+#ifndef DOXYGEN_SKIP
+// Argument checks shared by xSYRK() and xHERK() (and their _async variants)
+template <typename T>
+inline void check_syrk(const Dense<T>& A, const Dense<T>& C,
+                       const char* caller_name) {
+  check_device(A, C, caller_name);
+  check_format(Format::ColMajor, A, caller_name);
+  check_format(Format::ColMajor, C, caller_name);
+  check_output_transposed(C, caller_name);
+  check_dimensions(A.rows(), A.rows(), C, caller_name);
+}
+#endif /* DOXYGEN_SKIP */
+
+// Convenience bindings (bindings for Dense<T>)
+/** \brief            Symmetric rank-k update
+ *
+ *  C = alpha * A * A**T + beta * C
+ *
+ *  Only the triangle of C given by uplo is updated, the other one isn't
+ *  referenced. Needs half the operations of the equivalent xGEMM().
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *                    If A is transposed, C = alpha * A**T * A + beta * C
+ *                    with A as stored.
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ */
+template <typename T>
+inline void xSYRK(UPLO uplo, const T alpha, const Dense<T>& A, const T beta,
+                  Dense<T>& C) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_syrk(A, C, "xSYRK()");
+#endif
+
+  auto location = A._location;
+  auto device_id = A._device_id;
+  auto n = A.rows();
+  auto k = A.cols();
+  auto A_ptr = A._begin();
+  auto lda = A._leading_dimension;
+  auto C_ptr = C._begin();
+  auto ldc = C._leading_dimension;
+
+  if (location == Location::host) {
+
+    char uplo_  = (uplo == UPLO::lower) ? 'L' : 'U';
+    char trans_ = (A._transposed)       ? 'T' : 'N';
+
+    FORTRAN::xSYRK(uplo_, trans_, n, k, alpha, A_ptr, lda, beta, C_ptr, ldc);
+
+  }
+#ifdef HAVE_CUDA
+  else if (location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_gpu_structures("xSYRK()");
+# endif
+
+    auto uplo_  = (uplo == UPLO::lower) ? CUBLAS_FILL_MODE_LOWER :
+                                          CUBLAS_FILL_MODE_UPPER;
+    auto trans_ = (A._transposed)       ? CUBLAS_OP_T : CUBLAS_OP_N;
+
+    int               prev_device = 0;
+    cudaStream_t      prev_cuda_stream;
+    Stream*           stream_;
+
+# ifndef USE_LOCAL_STREAMS
+    stream_ = &(LinAlg::CUDA::compute_stream[device_id]);
+# else
+    Stream my_stream(device_id);
+    stream_ = &my_stream;
+# endif
+
+    auto handle = prepare_cublas(*stream_, &prev_device, &prev_cuda_stream);
+    BLAS::cuBLAS::xSYRK(*handle, uplo_, trans_, n, k, &alpha, A_ptr, lda,
+                        &beta, C_ptr, ldc);
+    finish_cublas(*stream_, &prev_device, &prev_cuda_stream, handle);
+
+    stream_->sync_cuda();
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    throw excUnimplemented("xSYRK(): BLAS-3 SYRK not supported on selected "
+                           "location");
+
+  }
+#endif
+
+}
+
+/** \brief            Asynchronous symmetric rank-k update
+ *
+ *  C = alpha * A * A**T + beta * C
+ *
+ *  Only the triangle of C given by uplo is updated.
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *                    If A is transposed, C = alpha * A**T * A + beta * C
+ *                    with A as stored.
+ *
+ *  \param[in]        beta
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        stream
+ *
+ *  \returns          The ticket number for the operation on the stream
+ */
+template <typename T>
+inline I_t xSYRK_async(UPLO uplo, const T alpha, const Dense<T>& A,
+                       const T beta, Dense<T>& C, Stream& stream) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_syrk(A, C, "xSYRK_async()");
+#endif
+
+  I_t ticket = 0;
+
+  auto location = A._location;
+  auto device_id = A._device_id;
+
+  if (location == Location::host) {
+
+    if (stream.synchronous) {
+
+      xSYRK(uplo, alpha, A, beta, C);
+
+    } else {
+
+      // Create a task using the synchronous variant
+
+#ifndef LINALG_NO_CHECKS
+      check_stream_alive(stream, "xSYRK_async()");
+#endif
+
+      // Arguments passed by copy, ensures memory lifetime but callee can't
+      // modify the arguments anymore
+      auto task = [=]() mutable { xSYRK(uplo, alpha, A, beta, C); };
+
+      ticket = stream.add(std::move(task));
+
+    }
+
+  }
+#ifdef HAVE_CUDA
+  else if (location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_gpu_structures("xSYRK_async()");
+    check_stream_prefer_native(stream, "xSYRK_async()");
+    check_stream_device_id(stream, device_id, "xSYRK_async()");
+# endif
+
+    auto uplo_  = (uplo == UPLO::lower) ? CUBLAS_FILL_MODE_LOWER :
+                                          CUBLAS_FILL_MODE_UPPER;
+    auto trans_ = (A._transposed)       ? CUBLAS_OP_T : CUBLAS_OP_N;
+
+    int               prev_device = 0;
+    cudaStream_t      prev_cuda_stream;
+
+    auto handle = prepare_cublas(stream, &prev_device, &prev_cuda_stream);
+    BLAS::cuBLAS::xSYRK(*handle, uplo_, trans_, A.rows(), A.cols(), &alpha,
+                        A._begin(), A._leading_dimension, &beta, C._begin(),
+                        C._leading_dimension);
+    finish_cublas(stream, &prev_device, &prev_cuda_stream, handle);
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    throw excUnimplemented("xSYRK_async(): BLAS-3 SYRK not supported on "
+                           "selected location");
+
+  }
+#endif
+
+  return ticket;
+
+}
+
+} /* namespace LinAlg::BLAS */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_BLAS_SYRK_H_ */
@@ -0,0 +1,491 @@
+/** \file
+ *
+ *  \brief            xTRMM (BLAS-3)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_BLAS_TRMM_H_
+#define LINALG_BLAS_TRMM_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::BLAS
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *    LinAlg::BLAS::<NAME>
+ *        bindings to the <NAME> BLAS backend
+ */
+
+#include <utility>      // std::move
+
+#include "../preprocessor.h"
+
+#ifdef HAVE_CUDA
+# include <cuda_runtime.h>
+# include <cublas_v2.h>
+# include "../CUDA/cuda_checks.h"
+# include "../CUDA/cuda_cublas.h"
+#endif
+
+#include "../types.h"
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../utilities/checks.h"
+#include "../streams.h"
+#include "../dense.h"
+
+#ifndef DOXYGEN_SKIP
+extern "C" {
+
+  using LinAlg::I_t;
+  using LinAlg::S_t;
+  using LinAlg::D_t;
+  using LinAlg::C_t;
+  using LinAlg::Z_t;
+
+  void fortran_name(strmm, STRMM)(const char* side, const char* uplo,
+                                  const char* transa, const char* diag,
+                                  const I_t* m, const I_t* n, const S_t* alpha,
+                                  const S_t* A, const I_t* lda, S_t* B,
+                                  const I_t* ldb);
+  void fortran_name(dtrmm, DTRMM)(const char* side, const char* uplo,
+                                  const char* transa, const char* diag,
+                                  const I_t* m, const I_t* n, const D_t* alpha,
+                                  const D_t* A, const I_t* lda, D_t* B,
+                                  const I_t* ldb);
+  void fortran_name(ctrmm, CTRMM)(const char* side, const char* uplo,
+                                  const char* transa, const char* diag,
+                                  const I_t* m, const I_t* n, const C_t* alpha,
+                                  const C_t* A, const I_t* lda, C_t* B,
+                                  const I_t* ldb);
+  void fortran_name(ztrmm, ZTRMM)(const char* side, const char* uplo,
+                                  const char* transa, const char* diag,
+                                  const I_t* m, const I_t* n, const Z_t* alpha,
+                                  const Z_t* A, const I_t* lda, Z_t* B,
+                                  const I_t* ldb);
+}
+#endif /* DOXYGEN_SKIP */
+
+namespace LinAlg {
+
+namespace BLAS {
+
+namespace FORTRAN {
+
+/** \brief            Triangular matrix-matrix multiply
+ *
+ *  B = alpha * op(A) * B    (side = 'L')
+ *  B = alpha * B * op(A)    (side = 'R')
+ *
+ *  \param[in]        side
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        transa
+ *
+ *  \param[in]        diag
+ *
+ *  \param[in]        m
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in,out]    B
+ *
+ *  \param[in]        ldb
+ *
+ *  See [DTRMM](http://www.mathkeisan.com/usersguide/man/dtrmm.html)
+ */
+inline void xTRMM(char side, char uplo, char transa, char diag, int m,
+                  int n, S_t alpha, S_t* A, int lda, S_t* B, int ldb) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(strmm, STRMM)(&side, &uplo, &transa, &diag, &m, &n, &alpha, A,
+                             &lda, B, &ldb);
+
+}
+/** \overload
+ */
+inline void xTRMM(char side, char uplo, char transa, char diag, int m,
+                  int n, D_t alpha, D_t* A, int lda, D_t* B, int ldb) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(dtrmm, DTRMM)(&side, &uplo, &transa, &diag, &m, &n, &alpha, A,
+                             &lda, B, &ldb);
+
+}
+/** \overload
+ */
+inline void xTRMM(char side, char uplo, char transa, char diag, int m,
+                  int n, C_t alpha, C_t* A, int lda, C_t* B, int ldb) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(ctrmm, CTRMM)(&side, &uplo, &transa, &diag, &m, &n, &alpha, A,
+                             &lda, B, &ldb);
+
+}
+/** \overload
+ */
+inline void xTRMM(char side, char uplo, char transa, char diag, int m,
+                  int n, Z_t alpha, Z_t* A, int lda, Z_t* B, int ldb) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(ztrmm, ZTRMM)(&side, &uplo, &transa, &diag, &m, &n, &alpha, A,
+                             &lda, B, &ldb);
+
+}
+
+} /* namespace LinAlg::BLAS::FORTRAN */
+
+#ifdef HAVE_CUDA
+namespace cuBLAS {
+
+/** \brief            Triangular matrix-matrix multiply
+ *
+ *  C = alpha * op(A) * B    (side = CUBLAS_SIDE_LEFT)
+ *  C = alpha * B * op(A)    (side = CUBLAS_SIDE_RIGHT)
+ *
+ *  NOTE: cuBLAS' trmm is out-of-place, passing C = B makes it in-place
+ *
+ *  \param[in]        handle
+ *
+ *  \param[in]        side
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        trans
+ *
+ *  \param[in]        diag
+ *
+ *  \param[in]        m
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in]        B
+ *
+ *  \param[in]        ldb
+ *
+ *  \param[in,out]    C
+ *
+ *  \param[in]        ldc
+ *
+ *  See [cuBLAS Documentation](http://docs.nvidia.com/cuda/cublas/)
+ */
+inline void xTRMM(cublasHandle_t handle, cublasSideMode_t side,
+                  cublasFillMode_t uplo, cublasOperation_t trans,
+                  cublasDiagType_t diag, I_t m, I_t n, const S_t* alpha,
+                  const S_t* A, I_t lda, const S_t* B, I_t ldb, S_t* C,
+                  I_t ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasStrmm(handle, side, uplo, trans, diag, m, n, alpha, A, \
+                          lda, B, ldb, C, ldc));
+
+}
+/** \overload
+ */
+inline void xTRMM(cublasHandle_t handle, cublasSideMode_t side,
+                  cublasFillMode_t uplo, cublasOperation_t trans,
+                  cublasDiagType_t diag, I_t m, I_t n, const D_t* alpha,
+                  const D_t* A, I_t lda, const D_t* B, I_t ldb, D_t* C,
+                  I_t ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasDtrmm(handle, side, uplo, trans, diag, m, n, alpha, A, \
+                          lda, B, ldb, C, ldc));
+
+}
+/** \overload
+ */
+inline void xTRMM(cublasHandle_t handle, cublasSideMode_t side,
+                  cublasFillMode_t uplo, cublasOperation_t trans,
+                  cublasDiagType_t diag, I_t m, I_t n, const C_t* alpha,
+                  const C_t* A, I_t lda, const C_t* B, I_t ldb, C_t* C,
+                  I_t ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasCtrmm(handle, side, uplo, trans, diag, m, n, \
+                          (const cuComplex*)alpha, (const cuComplex*)A, lda, \
+                          (const cuComplex*)B, ldb, (cuComplex*)C, ldc));
+
+}
+/** \overload
+ */
+inline void xTRMM(cublasHandle_t handle, cublasSideMode_t side,
+                  cublasFillMode_t uplo, cublasOperation_t trans,
+                  cublasDiagType_t diag, I_t m, I_t n, const Z_t* alpha,
+                  const Z_t* A, I_t lda, const Z_t* B, I_t ldb, Z_t* C,
+                  I_t ldc) {
+
+  PROFILING_FUNCTION_HEADER
+
+  checkCUBLAS(cublasZtrmm(handle, side, uplo, trans, diag, m, n, \
+                          (const cuDoubleComplex*)alpha, \
+                          (const cuDoubleComplex*)A, lda, \
+                          (const cuDoubleComplex*)B, ldb, \
+                          (cuDoubleComplex*)C, ldc));
+
+}
+
+} /* namespace LinAlg::BLAS::cuBLAS */
+#endif /* HAVE_CUDA */
+
+using LinAlg::Utilities::check_device;
+using LinAlg::Utilities::check_format;
+using LinAlg::Utilities::check_dimensions;
+using LinAlg::Utilities::check_output_transposed;
+using LinAlg::Utilities::check_stream_alive;
+#ifdef HAVE_CUDA
+using LinAlg::Utilities::check_gpu_structures;
+using LinAlg::Utilities::check_stream_prefer_native;
+using LinAlg::Utilities::check_stream_device_id;
+using LinAlg::CUDA::cuBLAS::prepare_cublas;
+using LinAlg::CUDA::cuBLAS::finish_cublas;
+#endif
+
+#ifndef DOXYGEN_SKIP
+// Argument checks shared by xTRMM() and xTRMM_async()
+template <typename T>
+inline void check_trmm(Side side, const Dense<T>& A, const Dense<T>& B,
+                       const char* caller_name) {
+  check_device(A, B, caller_name);
+  check_format(Format::ColMajor, A, caller_name);
+  check_format(Format::ColMajor, B, caller_name);
+  check_output_transposed(B, caller_name);
+  auto size = (side == Side::left) ? B.rows() : B.cols();
+  check_dimensions(size, size, A, caller_name);
+}
+#endif /* DOXYGEN_SKIP */
+
+// Convenience bindings (bindings for Dense<T>)
+/** \brief            Triangular matrix-matrix multiply
+ *
+ *  B = alpha * A * B    (side = Side::left)
+ *  B = alpha * B * A    (side = Side::right)
+ *
+ *  where A is triangular and only the triangle given by uplo is read. Takes
+ *  half the operations of the equivalent xGEMM() and needs no zeroed copy
+ *  of A.
+ *
+ *  \param[in]        side
+ *
+ *  \param[in]        uplo
+ *                    Triangle of A as stored (for a transposed A, UPLO::upper
+ *                    multiplies with a lower triangular matrix).
+ *
+ *  \param[in]        diag
+ *                    Diag::unit assumes a unit diagonal without reading it.
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in,out]    B
+ */
+template <typename T>
+inline void xTRMM(Side side, UPLO uplo, Diag diag, const T alpha,
+                  const Dense<T>& A, Dense<T>& B) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_trmm(side, A, B, "xTRMM()");
+#endif
+
+  auto location = A._location;
+  auto device_id = A._device_id;
+  auto m = B.rows();
+  auto n = B.cols();
+  auto A_ptr = A._begin();
+  auto lda = A._leading_dimension;
+  auto B_ptr = B._begin();
+  auto ldb = B._leading_dimension;
+
+  if (location == Location::host) {
+
+    char side_   = (side == Side::left)  ? 'L' : 'R';
+    char uplo_   = (uplo == UPLO::lower) ? 'L' : 'U';
+    char transa_ = (A._transposed)       ? 'T' : 'N';
+    char diag_   = (diag == Diag::unit)  ? 'U' : 'N';
+
+    FORTRAN::xTRMM(side_, uplo_, transa_, diag_, m, n, alpha, A_ptr, lda,
+                   B_ptr, ldb);
+
+  }
+#ifdef HAVE_CUDA
+  else if (location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_gpu_structures("xTRMM()");
+# endif
+
+    auto side_   = (side == Side::left)  ? CUBLAS_SIDE_LEFT :
+                                           CUBLAS_SIDE_RIGHT;
+    auto uplo_   = (uplo == UPLO::lower) ? CUBLAS_FILL_MODE_LOWER :
+                                           CUBLAS_FILL_MODE_UPPER;
+    auto transa_ = (A._transposed)       ? CUBLAS_OP_T : CUBLAS_OP_N;
+    auto diag_   = (diag == Diag::unit)  ? CUBLAS_DIAG_UNIT :
+                                           CUBLAS_DIAG_NON_UNIT;
+
+    int               prev_device = 0;
+    cudaStream_t      prev_cuda_stream;
+    Stream*           stream_;
+
+# ifndef USE_LOCAL_STREAMS
+    stream_ = &(LinAlg::CUDA::compute_stream[device_id]);
+# else
+    Stream my_stream(device_id);
+    stream_ = &my_stream;
+# endif
+
+    auto handle = prepare_cublas(*stream_, &prev_device, &prev_cuda_stream);
+    BLAS::cuBLAS::xTRMM(*handle, side_, uplo_, transa_, diag_, m, n, &alpha,
+                        A_ptr, lda, B_ptr, ldb, B_ptr, ldb);
+    finish_cublas(*stream_, &prev_device, &prev_cuda_stream, handle);
+
+    stream_->sync_cuda();
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    throw excUnimplemented("xTRMM(): BLAS-3 TRMM not supported on selected "
+                           "location");
+
+  }
+#endif
+
+}
+
+/** \brief            Asynchronous triangular matrix-matrix multiply
+ *
+ *  B = alpha * A * B    (side = Side::left)
+ *  B = alpha * B * A    (side = Side::right)
+ *
+ *  \param[in]        side
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        diag
+ *
+ *  \param[in]        alpha
+ *
+ *  \param[in]        A
+ *
+ *  \param[in,out]    B
+ *
+ *  \param[in]        stream
+ *
+ *  \returns          The ticket number for the operation on the stream
+ */
+template <typename T>
+inline I_t xTRMM_async(Side side, UPLO uplo, Diag diag, const T alpha,
+                       const Dense<T>& A, Dense<T>& B, Stream& stream) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_trmm(side, A, B, "xTRMM_async()");
+#endif
+
+  I_t ticket = 0;
+
+  auto location = A._location;
+  auto device_id = A._device_id;
+
+  if (location == Location::host) {
+
+    if (stream.synchronous) {
+
+      xTRMM(side, uplo, diag, alpha, A, B);
+
+    } else {
+
+      // Create a task using the synchronous variant
+
+#ifndef LINALG_NO_CHECKS
+      check_stream_alive(stream, "xTRMM_async()");
+#endif
+
+      // Arguments passed by copy, ensures memory lifetime but callee can't
+      // modify the arguments anymore
+      auto task = [=]() mutable { xTRMM(side, uplo, diag, alpha, A, B); };
+
+      ticket = stream.add(std::move(task));
+
+    }
+
+  }
+#ifdef HAVE_CUDA
+  else if (location == Location::GPU) {
+
+# ifndef LINALG_NO_CHECKS
+    check_gpu_structures("xTRMM_async()");
+    check_stream_prefer_native(stream, "xTRMM_async()");
+    check_stream_device_id(stream, device_id, "xTRMM_async()");
+# endif
+
+    auto side_   = (side == Side::left)  ? CUBLAS_SIDE_LEFT :
+                                           CUBLAS_SIDE_RIGHT;
+    auto uplo_   = (uplo == UPLO::lower) ? CUBLAS_FILL_MODE_LOWER :
+                                           CUBLAS_FILL_MODE_UPPER;
+    auto transa_ = (A._transposed)       ? CUBLAS_OP_T : CUBLAS_OP_N;
+    auto diag_   = (diag == Diag::unit)  ? CUBLAS_DIAG_UNIT :
+                                           CUBLAS_DIAG_NON_UNIT;
+
+    int               prev_device = 0;
+    cudaStream_t      prev_cuda_stream;
+
+    auto handle = prepare_cublas(stream, &prev_device, &prev_cuda_stream);
+    BLAS::cuBLAS::xTRMM(*handle, side_, uplo_, transa_, diag_, B.rows(),
+                        B.cols(), &alpha, A._begin(), A._leading_dimension,
+                        B._begin(), B._leading_dimension, B._begin(),
+                        B._leading_dimension);
+    finish_cublas(stream, &prev_device, &prev_cuda_stream, handle);
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+
+    throw excUnimplemented("xTRMM_async(): BLAS-3 TRMM not supported on "
+                           "selected location");
+
+  }
+#endif
+
+  return ticket;
+
+}
+
+} /* namespace LinAlg::BLAS */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_BLAS_TRMM_H_ */
@@ -0,0 +1,43 @@
+/** \file
+ *
+ *  \brief            Length and increment of Dense<T> vectors for the BLAS-1
+ *                    and BLAS-2 bindings
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_BLAS_VECTOR_LAYOUT_H_
+#define LINALG_BLAS_VECTOR_LAYOUT_H_
+
+#include "../types.h"
+#include "../dense.h"
+
+namespace LinAlg {
+
+namespace BLAS {
+
+#ifndef DOXYGEN_SKIP
+/*  A vector is a ColMajor Dense<T> with one column (consecutive elements) or
+ *  one row (elements one leading dimension apart), independent of whether
+ *  it is marked transposed. Use check_vector() to check the shape first.
+ */
+template <typename T>
+inline I_t vector_length(const Dense<T>& x) {
+  return (x._cols == 1) ? x._rows : x._cols;
+}
+
+template <typename T>
+inline I_t vector_increment(const Dense<T>& x) {
+  return (x._cols == 1) ? 1 : x._leading_dimension;
+}
+#endif /* DOXYGEN_SKIP */
+
+} /* namespace LinAlg::BLAS */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_BLAS_VECTOR_LAYOUT_H_ */
@@ -0,0 +1,180 @@
+/** \file
+ *
+ *  \brief            xGBTRF
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_LAPACK_GBTRF_H_
+#define LINALG_LAPACK_GBTRF_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::LAPACK
+ *        convenience bindings supporting different locations for Banded<T>
+ *
+ *    LinAlg::LAPACK::<NAME>
+ *        bindings to the <NAME> LAPACK backend
+ */
+
+#include "../preprocessor.h"
+#include "../types.h"
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../utilities/checks.h"
+#include "../dense.h"
+#include "../banded.h"
+
+#ifndef DOXYGEN_SKIP
+extern "C" {
+
+  using LinAlg::I_t;
+  using LinAlg::S_t;
+  using LinAlg::D_t;
+  using LinAlg::C_t;
+  using LinAlg::Z_t;
+
+  void fortran_name(sgbtrf, SGBTRF)(const I_t* m, const I_t* n, const I_t* kl,
+                                    const I_t* ku, S_t* AB, const I_t* ldab,
+                                    I_t* ipiv, int* info);
+  void fortran_name(dgbtrf, DGBTRF)(const I_t* m, const I_t* n, const I_t* kl,
+                                    const I_t* ku, D_t* AB, const I_t* ldab,
+                                    I_t* ipiv, int* info);
+  void fortran_name(cgbtrf, CGBTRF)(const I_t* m, const I_t* n, const I_t* kl,
+                                    const I_t* ku, C_t* AB, const I_t* ldab,
+                                    I_t* ipiv, int* info);
+  void fortran_name(zgbtrf, ZGBTRF)(const I_t* m, const I_t* n, const I_t* kl,
+                                    const I_t* ku, Z_t* AB, const I_t* ldab,
+                                    I_t* ipiv, int* info);
+}
+#endif
+
+namespace LinAlg {
+
+namespace LAPACK {
+
+namespace FORTRAN {
+
+/** \brief            Compute LU factorization of a general banded matrix
+ *
+ *  A <- P * L * U
+ *
+ *  \param[in]        m
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        kl
+ *
+ *  \param[in]        ku
+ *
+ *  \param[in,out]    AB
+ *
+ *  \param[in]        ldab
+ *
+ *  \param[in,out]    ipiv
+ *
+ *  \param[in,out]    info
+ *
+ *  See
+ *  [DGBTRF](http://www.math.utah.edu/software/lapack/lapack-d/dgbtrf.html)
+ */
+inline void xGBTRF(I_t m, I_t n, I_t kl, I_t ku, S_t* AB, I_t ldab, I_t* ipiv,
+                   int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(sgbtrf, SGBTRF)(&m, &n, &kl, &ku, AB, &ldab, ipiv, info);
+
+}
+/** \overload
+ */
+inline void xGBTRF(I_t m, I_t n, I_t kl, I_t ku, D_t* AB, I_t ldab, I_t* ipiv,
+                   int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(dgbtrf, DGBTRF)(&m, &n, &kl, &ku, AB, &ldab, ipiv, info);
+
+}
+/** \overload
+ */
+inline void xGBTRF(I_t m, I_t n, I_t kl, I_t ku, C_t* AB, I_t ldab, I_t* ipiv,
+                   int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(cgbtrf, CGBTRF)(&m, &n, &kl, &ku, AB, &ldab, ipiv, info);
+
+}
+/** \overload
+ */
+inline void xGBTRF(I_t m, I_t n, I_t kl, I_t ku, Z_t* AB, I_t ldab, I_t* ipiv,
+                   int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(zgbtrf, ZGBTRF)(&m, &n, &kl, &ku, AB, &ldab, ipiv, info);
+
+}
+
+} /* namespace LinAlg::LAPACK::FORTRAN */
+
+
+using LinAlg::Utilities::check_format;
+using LinAlg::Utilities::check_input_transposed;
+using LinAlg::Utilities::check_minimal_dimensions;
+
+/** \brief            Compute LU factorization of a general banded matrix
+ *
+ *  A <- P * L * U
+ *
+ *  \param[in,out]    A
+ *                    Banded matrix, overwritten with its LU factorization
+ *                    (including the fill-in in the first kl rows of the
+ *                    storage).
+ *
+ *  \param[in,out]    ipiv
+ *                    Pivoting vector, at least A.rows() x 1.
+ */
+template <typename T>
+inline void xGBTRF(Banded<T>& A, Dense<int>& ipiv) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_format(Format::ColMajor, A._values, "xGBTRF(A, ipiv), A");
+  check_input_transposed(A._values, "xGBTRF(A, ipiv), A");
+  check_input_transposed(ipiv, "xGBTRF(A, ipiv), ipiv");
+  check_minimal_dimensions(A.rows(), 1, ipiv, "xGBTRF(A, ipiv), ipiv");
+  if (A._values._location != Location::host || 
+      ipiv._location != Location::host) {
+    throw excUnimplemented("xGBTRF(): LAPACK GBTRF not supported on selected "
+                           "location");
+  }
+#endif /* LINALG_NO_CHECKS */
+
+  auto n        = A.rows();
+  auto AB_ptr   = A._values._begin();
+  auto ldab     = A._values._leading_dimension;
+  auto ipiv_ptr = ipiv._begin();
+  int  info     = 0;
+
+  FORTRAN::xGBTRF(n, n, A._kl, A._ku, AB_ptr, ldab, ipiv_ptr, &info);
+
+#ifndef LINALG_NO_CHECKS
+  if (info != 0) {
+    throw excMath("xGBTRF(): error: info = %d", info);
+  }
+#endif
+
+}
+
+} /* namespace LinAlg::LAPACK */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_LAPACK_GBTRF_H_ */
@@ -0,0 +1,205 @@
+/** \file
+ *
+ *  \brief            xGBTRS
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_LAPACK_GBTRS_H_
+#define LINALG_LAPACK_GBTRS_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::LAPACK
+ *        convenience bindings supporting different locations for Banded<T>
+ *
+ *    LinAlg::LAPACK::<NAME>
+ *        bindings to the <NAME> LAPACK backend
+ */
+
+#include "../preprocessor.h"
+#include "../types.h"
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../utilities/checks.h"
+#include "../dense.h"
+#include "../banded.h"
+
+#ifndef DOXYGEN_SKIP
+extern "C" {
+
+  using LinAlg::I_t;
+  using LinAlg::S_t;
+  using LinAlg::D_t;
+  using LinAlg::C_t;
+  using LinAlg::Z_t;
+
+  void fortran_name(sgbtrs, SGBTRS)(const char* trans, const I_t* n,
+                                    const I_t* kl, const I_t* ku,
+                                    const I_t* nrhs, const S_t* AB,
+                                    const I_t* ldab, const I_t* ipiv, S_t* B,
+                                    const I_t* ldb, int* info);
+  void fortran_name(dgbtrs, DGBTRS)(const char* trans, const I_t* n,
+                                    const I_t* kl, const I_t* ku,
+                                    const I_t* nrhs, const D_t* AB,
+                                    const I_t* ldab, const I_t* ipiv, D_t* B,
+                                    const I_t* ldb, int* info);
+  void fortran_name(cgbtrs, CGBTRS)(const char* trans, const I_t* n,
+                                    const I_t* kl, const I_t* ku,
+                                    const I_t* nrhs, const C_t* AB,
+                                    const I_t* ldab, const I_t* ipiv, C_t* B,
+                                    const I_t* ldb, int* info);
+  void fortran_name(zgbtrs, ZGBTRS)(const char* trans, const I_t* n,
+                                    const I_t* kl, const I_t* ku,
+                                    const I_t* nrhs, const Z_t* AB,
+                                    const I_t* ldab, const I_t* ipiv, Z_t* B,
+                                    const I_t* ldb, int* info);
+}
+#endif
+
+namespace LinAlg {
+
+namespace LAPACK {
+
+namespace FORTRAN {
+
+/** \brief            Solve a general banded system using the LU
+ *                    factorization computed by xGBTRF
+ *
+ *  B <- A^(-1) * B
+ *
+ *  \param[in]        trans
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        kl
+ *
+ *  \param[in]        ku
+ *
+ *  \param[in]        nrhs
+ *
+ *  \param[in]        AB
+ *
+ *  \param[in]        ldab
+ *
+ *  \param[in]        ipiv
+ *
+ *  \param[in,out]    B
+ *
+ *  \param[in]        ldb
+ *
+ *  \param[in,out]    info
+ *
+ *  See
+ *  [DGBTRS](http://www.math.utah.edu/software/lapack/lapack-d/dgbtrs.html)
+ */
+inline void xGBTRS(char trans, I_t n, I_t kl, I_t ku, I_t nrhs, const S_t* AB,
+                   I_t ldab, const I_t* ipiv, S_t* B, I_t ldb, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(sgbtrs, SGBTRS)(&trans, &n, &kl, &ku, &nrhs, AB, &ldab, ipiv,
+                               B, &ldb, info);
+
+}
+/** \overload
+ */
+inline void xGBTRS(char trans, I_t n, I_t kl, I_t ku, I_t nrhs, const D_t* AB,
+                   I_t ldab, const I_t* ipiv, D_t* B, I_t ldb, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(dgbtrs, DGBTRS)(&trans, &n, &kl, &ku, &nrhs, AB, &ldab, ipiv,
+                               B, &ldb, info);
+
+}
+/** \overload
+ */
+inline void xGBTRS(char trans, I_t n, I_t kl, I_t ku, I_t nrhs, const C_t* AB,
+                   I_t ldab, const I_t* ipiv, C_t* B, I_t ldb, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(cgbtrs, CGBTRS)(&trans, &n, &kl, &ku, &nrhs, AB, &ldab, ipiv,
+                               B, &ldb, info);
+
+}
+/** \overload
+ */
+inline void xGBTRS(char trans, I_t n, I_t kl, I_t ku, I_t nrhs, const Z_t* AB,
+                   I_t ldab, const I_t* ipiv, Z_t* B, I_t ldb, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(zgbtrs, ZGBTRS)(&trans, &n, &kl, &ku, &nrhs, AB, &ldab, ipiv,
+                               B, &ldb, info);
+
+}
+
+} /* namespace LinAlg::LAPACK::FORTRAN */
+
+
+using LinAlg::Utilities::check_format;
+using LinAlg::Utilities::check_input_transposed;
+using LinAlg::Utilities::check_dimensions;
+using LinAlg::Utilities::check_minimal_dimensions;
+
+/** \brief            Solve a general banded system using the LU
+ *                    factorization computed by xGBTRF
+ *
+ *  B <- A^(-1) * B
+ *
+ *  \param[in]        A
+ *                    LU factorization of A as computed by xGBTRF().
+ *
+ *  \param[in]        ipiv
+ *                    Pivoting vector as computed by xGBTRF().
+ *
+ *  \param[in,out]    B
+ *                    Right hand sides, overwritten with the solution.
+ */
+template <typename T>
+inline void xGBTRS(const Banded<T>& A, const Dense<int>& ipiv, Dense<T>& B) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_format(Format::ColMajor, B, "xGBTRS(A, ipiv, B), B");
+  check_input_transposed(B, "xGBTRS(A, ipiv, B), B");
+  check_dimensions(A.rows(), B.cols(), B, "xGBTRS(A, ipiv, B), B");
+  check_minimal_dimensions(A.rows(), 1, ipiv, "xGBTRS(A, ipiv, B), ipiv");
+  if (B._location != Location::host || ipiv._location != Location::host) {
+    throw excUnimplemented("xGBTRS(): LAPACK GBTRS not supported on selected "
+                           "location");
+  }
+#endif /* LINALG_NO_CHECKS */
+
+  auto n        = A.rows();
+  auto nrhs     = B.cols();
+  auto AB_ptr   = A._values._begin();
+  auto ldab     = A._values._leading_dimension;
+  auto ipiv_ptr = ipiv._begin();
+  auto B_ptr    = B._begin();
+  auto ldb      = B._leading_dimension;
+  int  info     = 0;
+
+  FORTRAN::xGBTRS('N', n, A._kl, A._ku, nrhs, AB_ptr, ldab, ipiv_ptr, B_ptr,
+                  ldb, &info);
+
+#ifndef LINALG_NO_CHECKS
+  if (info != 0) {
+    throw excMath("xGBTRS(): error: info = %d", info);
+  }
+#endif
+
+}
+
+} /* namespace LinAlg::LAPACK */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_LAPACK_GBTRS_H_ */
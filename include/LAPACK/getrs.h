@@ -0,0 +1,203 @@
+/** \file
+ *
+ *  \brief            xGETRS
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_LAPACK_GETRS_H_
+#define LINALG_LAPACK_GETRS_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::LAPACK
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *    LinAlg::LAPACK::<NAME>
+ *        bindings to the <NAME> LAPACK backend
+ */
+
+#include "../preprocessor.h"
+#include "../types.h"
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../utilities/checks.h"
+#include "../dense.h"
+
+#ifndef DOXYGEN_SKIP
+extern "C" {
+
+  using LinAlg::I_t;
+  using LinAlg::S_t;
+  using LinAlg::D_t;
+  using LinAlg::C_t;
+  using LinAlg::Z_t;
+
+  void fortran_name(sgetrs, SGETRS)(const char* trans, const I_t* n,
+                                    const I_t* nrhs, const S_t* A,
+                                    const I_t* lda, const I_t* ipiv, S_t* B,
+                                    const I_t* ldb, int* info);
+  void fortran_name(dgetrs, DGETRS)(const char* trans, const I_t* n,
+                                    const I_t* nrhs, const D_t* A,
+                                    const I_t* lda, const I_t* ipiv, D_t* B,
+                                    const I_t* ldb, int* info);
+  void fortran_name(cgetrs, CGETRS)(const char* trans, const I_t* n,
+                                    const I_t* nrhs, const C_t* A,
+                                    const I_t* lda, const I_t* ipiv, C_t* B,
+                                    const I_t* ldb, int* info);
+  void fortran_name(zgetrs, ZGETRS)(const char* trans, const I_t* n,
+                                    const I_t* nrhs, const Z_t* A,
+                                    const I_t* lda, const I_t* ipiv, Z_t* B,
+                                    const I_t* ldb, int* info);
+}
+#endif
+
+namespace LinAlg {
+
+namespace LAPACK {
+
+namespace FORTRAN {
+
+/** \brief            Solve a general system using the LU factorization
+ *                    computed by xGETRF
+ *
+ *  B <- op(A)^(-1) * B
+ *
+ *  \param[in]        trans
+ *                    'N': op(A) = A, 'T': op(A) = A^T, 'C': op(A) = A^H
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        nrhs
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in]        ipiv
+ *
+ *  \param[in,out]    B
+ *
+ *  \param[in]        ldb
+ *
+ *  \param[in,out]    info
+ *
+ *  See
+ *  [DGETRS](http://www.math.utah.edu/software/lapack/lapack-d/dgetrs.html)
+ */
+inline void xGETRS(char trans, I_t n, I_t nrhs, const S_t* A, I_t lda,
+                   const I_t* ipiv, S_t* B, I_t ldb, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(sgetrs, SGETRS)(&trans, &n, &nrhs, A, &lda, ipiv, B, &ldb,
+                               info);
+
+}
+/** \overload
+ */
+inline void xGETRS(char trans, I_t n, I_t nrhs, const D_t* A, I_t lda,
+                   const I_t* ipiv, D_t* B, I_t ldb, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(dgetrs, DGETRS)(&trans, &n, &nrhs, A, &lda, ipiv, B, &ldb,
+                               info);
+
+}
+/** \overload
+ */
+inline void xGETRS(char trans, I_t n, I_t nrhs, const C_t* A, I_t lda,
+                   const I_t* ipiv, C_t* B, I_t ldb, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(cgetrs, CGETRS)(&trans, &n, &nrhs, A, &lda, ipiv, B, &ldb,
+                               info);
+
+}
+/** \overload
+ */
+inline void xGETRS(char trans, I_t n, I_t nrhs, const Z_t* A, I_t lda,
+                   const I_t* ipiv, Z_t* B, I_t ldb, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(zgetrs, ZGETRS)(&trans, &n, &nrhs, A, &lda, ipiv, B, &ldb,
+                               info);
+
+}
+
+} /* namespace LinAlg::LAPACK::FORTRAN */
+
+
+using LinAlg::Utilities::check_format;
+using LinAlg::Utilities::check_input_transposed;
+using LinAlg::Utilities::check_dimensions;
+using LinAlg::Utilities::check_minimal_dimensions;
+
+/** \brief            Solve a general system using the LU factorization
+ *                    computed by xGETRF
+ *
+ *  B <- op(A)^(-1) * B
+ *
+ *  \param[in]        A
+ *                    LU factorization of A as computed by xGETRF(). If A is
+ *                    marked as transposed, the system with A^T is solved.
+ *
+ *  \param[in]        ipiv
+ *                    Pivoting vector as computed by xGETRF().
+ *
+ *  \param[in,out]    B
+ *                    Right hand sides, overwritten with the solution.
+ */
+template <typename T>
+inline void xGETRS(const Dense<T>& A, const Dense<int>& ipiv, Dense<T>& B) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_format(Format::ColMajor, A, "xGETRS(A, ipiv, B), A");
+  check_format(Format::ColMajor, B, "xGETRS(A, ipiv, B), B");
+  check_input_transposed(B, "xGETRS(A, ipiv, B), B");
+  if (A.rows() != A.cols()) {
+    throw excBadArgument("xGETRS(A, ipiv, B), A: matrix must be square");
+  }
+  check_dimensions(A.rows(), B.cols(), B, "xGETRS(A, ipiv, B), B");
+  check_minimal_dimensions(A.rows(), 1, ipiv, "xGETRS(A, ipiv, B), ipiv");
+  if (A._location != Location::host || B._location != Location::host ||
+      ipiv._location != Location::host) {
+    throw excUnimplemented("xGETRS(): LAPACK GETRS not supported on selected "
+                           "location");
+  }
+#endif /* LINALG_NO_CHECKS */
+
+  auto n        = A.rows();
+  auto nrhs     = B.cols();
+  auto A_ptr    = A._begin();
+  auto lda      = A._leading_dimension;
+  auto ipiv_ptr = ipiv._begin();
+  auto B_ptr    = B._begin();
+  auto ldb      = B._leading_dimension;
+  char trans    = (A._transposed) ? 'T' : 'N';
+  int  info     = 0;
+
+  FORTRAN::xGETRS(trans, n, nrhs, A_ptr, lda, ipiv_ptr, B_ptr, ldb, &info);
+
+#ifndef LINALG_NO_CHECKS
+  if (info != 0) {
+    throw excMath("xGETRS(): error: info = %d", info);
+  }
+#endif
+
+}
+
+} /* namespace LinAlg::LAPACK */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_LAPACK_GETRS_H_ */
@@ -0,0 +1,708 @@
+/** \file
+ *
+ *  \brief            xGTSV, batched (block-)tridiagonal solvers
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_LAPACK_GTSV_H_
+#define LINALG_LAPACK_GTSV_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::LAPACK
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *    LinAlg::LAPACK::<NAME>
+ *        bindings to the <NAME> LAPACK backend
+ *
+ *    LinAlg::LAPACK::NATIVE
+ *        implementations within LinAlg (batched solvers for which there is no
+ *        LAPACK routine)
+ */
+
+#include <vector>     // std::vector
+#include <algorithm>  // std::min
+
+#include "../preprocessor.h"
+#include "../types.h"
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../executor.h"
+#include "../utilities/checks.h"
+#include "../dense.h"
+
+#ifndef DOXYGEN_SKIP
+extern "C" {
+
+  using LinAlg::I_t;
+  using LinAlg::S_t;
+  using LinAlg::D_t;
+  using LinAlg::C_t;
+  using LinAlg::Z_t;
+
+  void fortran_name(sgtsv, SGTSV)(const I_t* n, const I_t* nrhs, S_t* DL,
+                                  S_t* D, S_t* DU, S_t* B, const I_t* ldb,
+                                  int* info);
+  void fortran_name(dgtsv, DGTSV)(const I_t* n, const I_t* nrhs, D_t* DL,
+                                  D_t* D, D_t* DU, D_t* B, const I_t* ldb,
+                                  int* info);
+  void fortran_name(cgtsv, CGTSV)(const I_t* n, const I_t* nrhs, C_t* DL,
+                                  C_t* D, C_t* DU, C_t* B, const I_t* ldb,
+                                  int* info);
+  void fortran_name(zgtsv, ZGTSV)(const I_t* n, const I_t* nrhs, Z_t* DL,
+                                  Z_t* D, Z_t* DU, Z_t* B, const I_t* ldb,
+                                  int* info);
+}
+#endif
+
+namespace LinAlg {
+
+namespace LAPACK {
+
+namespace FORTRAN {
+
+/** \brief            GTSV
+ *
+ *  X = A^(-1) * B    (A tridiagonal)
+ *
+ *  \param[in]        n
+ *
+ *  \param[in]        nrhs
+ *
+ *  \param[in,out]    DL
+ *
+ *  \param[in,out]    D
+ *
+ *  \param[in,out]    DU
+ *
+ *  \param[in,out]    B
+ *
+ *  \param[in]        ldb
+ *
+ *  \param[in,out]    info
+ *
+ *  See [DGTSV](http://www.math.utah.edu/software/lapack/lapack-d/dgtsv.html)
+ */
+inline void xGTSV(I_t n, I_t nrhs, S_t* DL, S_t* D, S_t* DU, S_t* B, I_t ldb,
+                  int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(sgtsv, SGTSV)(&n, &nrhs, DL, D, DU, B, &ldb, info);
+
+}
+/** \overload
+ */
+inline void xGTSV(I_t n, I_t nrhs, D_t* DL, D_t* D, D_t* DU, D_t* B, I_t ldb,
+                  int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(dgtsv, DGTSV)(&n, &nrhs, DL, D, DU, B, &ldb, info);
+
+}
+/** \overload
+ */
+inline void xGTSV(I_t n, I_t nrhs, C_t* DL, C_t* D, C_t* DU, C_t* B, I_t ldb,
+                  int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(cgtsv, CGTSV)(&n, &nrhs, DL, D, DU, B, &ldb, info);
+
+}
+/** \overload
+ */
+inline void xGTSV(I_t n, I_t nrhs, Z_t* DL, Z_t* D, Z_t* DU, Z_t* B, I_t ldb,
+                  int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(zgtsv, ZGTSV)(&n, &nrhs, DL, D, DU, B, &ldb, info);
+
+}
+
+} /* namespace LinAlg::LAPACK::FORTRAN */
+
+
+namespace NATIVE {
+
+/** \brief            Batched tridiagonal solve on interleaved arrays (Thomas
+ *                    algorithm, no pivoting)
+ *
+ *  Element k of system s is stored at array[k * ld + s], i.e. consecutive
+ *  systems are adjacent in memory and the innermost loops (over the systems)
+ *  map one system to each SIMD lane.
+ *
+ *  \param[in]        n
+ *                    Size of each system.
+ *
+ *  \param[in]        batch
+ *                    Number of systems.
+ *
+ *  \param[in]        DL
+ *                    Subdiagonals, element 0 is ignored.
+ *
+ *  \param[in]        D
+ *                    Diagonals.
+ *
+ *  \param[in,out]    DU
+ *                    Superdiagonals, element n - 1 is ignored. Overwritten
+ *                    with the modified superdiagonals.
+ *
+ *  \param[in,out]    B
+ *                    Right hand sides, overwritten with the solutions.
+ *
+ *  \param[in]        ld
+ *                    Distance between element k and k + 1 of a system
+ *                    (>= batch).
+ *
+ *  \param[out]       info
+ *                    0 on success, k + 1 if a zero pivot was encountered in
+ *                    row k of some system.
+ *
+ *  \note             No pivoting is done, the systems should be diagonally
+ *                    dominant or symmetric positive definite.
+ */
+template <typename T>
+inline void xGTSV_interleaved(I_t n, I_t batch, const T* DL, const T* D,
+                              T* DU, T* B, I_t ld, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  *info = 0;
+  const auto zero = cast<T>(0.0);
+  const auto one  = cast<T>(1.0);
+
+  // Forward sweep, row 0
+  bool zero_pivot = false;
+  for (I_t s = 0; s < batch; ++s) {
+    zero_pivot |= (D[s] == zero);
+    auto m = one / D[s];
+    DU[s] *= m;
+    B[s]  *= m;
+  }
+  if (zero_pivot && *info == 0) *info = 1;
+
+  // Forward sweep, remaining rows
+  for (I_t k = 1; k < n; ++k) {
+
+    auto dl      = DL + k * ld;
+    auto d       = D  + k * ld;
+    auto du      = DU + k * ld;
+    auto b       = B  + k * ld;
+    auto du_prev = DU + (k - 1) * ld;
+    auto b_prev  = B  + (k - 1) * ld;
+
+    zero_pivot = false;
+    for (I_t s = 0; s < batch; ++s) {
+      auto pivot = d[s] - dl[s] * du_prev[s];
+      zero_pivot |= (pivot == zero);
+      auto m = one / pivot;
+      du[s]  = du[s] * m;
+      b[s]   = (b[s] - dl[s] * b_prev[s]) * m;
+    }
+    if (zero_pivot && *info == 0) *info = int(k + 1);
+
+  }
+
+  // Back substitution
+  for (I_t k = n - 2; k >= 0; --k) {
+
+    auto du     = DU + k * ld;
+    auto b      = B  + k * ld;
+    auto b_next = B  + (k + 1) * ld;
+
+    for (I_t s = 0; s < batch; ++s) {
+      b[s] -= du[s] * b_next[s];
+    }
+
+  }
+
+}
+
+/** \brief            Batched block tridiagonal solve on interleaved arrays
+ *                    (block Thomas algorithm, no pivoting)
+ *
+ *  Element e of system s is stored at array[e * ld + s]. The m x m blocks of
+ *  block row k are stored consecutively in column major order, i.e. element
+ *  (i, j) of block k is element e = (k * m + j) * m + i. Element i of block k
+ *  of the right hand side is element e = k * m + i.
+ *
+ *  \param[in]        n
+ *                    Number of block rows of each system.
+ *
+ *  \param[in]        m
+ *                    Size of the blocks.
+ *
+ *  \param[in]        batch
+ *                    Number of systems.
+ *
+ *  \param[in]        DL
+ *                    Subdiagonal blocks, block 0 is ignored.
+ *
+ *  \param[in,out]    D
+ *                    Diagonal blocks, overwritten with the LU factors of the
+ *                    Schur complements.
+ *
+ *  \param[in,out]    DU
+ *                    Superdiagonal blocks, block n - 1 is ignored.
+ *                    Overwritten.
+ *
+ *  \param[in,out]    B
+ *                    Right hand sides, overwritten with the solutions.
+ *
+ *  \param[in]        ld
+ *                    Distance between element e and e + 1 of a system
+ *                    (>= batch).
+ *
+ *  \param[out]       info
+ *                    0 on success, k + 1 if a zero pivot was encountered in
+ *                    block row k of some system.
+ *
+ *  \note             No pivoting is done (neither between nor within blocks).
+ */
+template <typename T>
+inline void xGTSV_block_interleaved(I_t n, I_t m, I_t batch, const T* DL,
+                                    T* D, T* DU, T* B, I_t ld, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  *info = 0;
+  const auto zero = cast<T>(0.0);
+  const auto one  = cast<T>(1.0);
+
+  auto block  = [&](T* base, I_t k, I_t i, I_t j) {
+    return base + ((k * m + j) * m + i) * ld;
+  };
+  auto cblock = [&](const T* base, I_t k, I_t i, I_t j) {
+    return base + ((k * m + j) * m + i) * ld;
+  };
+  auto vector = [&](T* base, I_t k, I_t i) { return base + (k * m + i) * ld; };
+
+  for (I_t k = 0; k < n; ++k) {
+
+    if (k > 0) {
+
+      // D_k -= L_k * C_{k-1},  b_k -= L_k * y_{k-1} (C is stored in DU)
+      for (I_t i = 0; i < m; ++i) {
+        for (I_t l = 0; l < m; ++l) {
+
+          auto a = cblock(DL, k, i, l);
+
+          for (I_t j = 0; j < m; ++j) {
+            auto d = block(D, k, i, j);
+            auto c = block(DU, k - 1, l, j);
+            for (I_t s = 0; s < batch; ++s) d[s] -= a[s] * c[s];
+          }
+
+          auto b      = vector(B, k, i);
+          auto y_prev = vector(B, k - 1, l);
+          for (I_t s = 0; s < batch; ++s) b[s] -= a[s] * y_prev[s];
+
+        }
+      }
+
+    }
+
+    // LU decompose D_k in place
+    bool zero_pivot = false;
+    for (I_t p = 0; p < m; ++p) {
+
+      auto pivot = block(D, k, p, p);
+      for (I_t s = 0; s < batch; ++s) zero_pivot |= (pivot[s] == zero);
+
+      for (I_t i = p + 1; i < m; ++i) {
+
+        auto l = block(D, k, i, p);
+        for (I_t s = 0; s < batch; ++s) l[s] *= one / pivot[s];
+
+        for (I_t j = p + 1; j < m; ++j) {
+          auto d = block(D, k, i, j);
+          auto u = block(D, k, p, j);
+          for (I_t s = 0; s < batch; ++s) d[s] -= l[s] * u[s];
+        }
+
+      }
+
+    }
+    if (zero_pivot && *info == 0) *info = int(k + 1);
+
+    // Solve D_k * [C_k, y_k] = [U_k, b_k]. Column m is the right hand side
+    auto rhs = [&](I_t i, I_t j) {
+      return (j < m) ? block(DU, k, i, j) : vector(B, k, i);
+    };
+    auto n_rhs = (k < n - 1) ? m + 1 : 1;
+
+    for (I_t r = 0; r < n_rhs; ++r) {
+
+      auto j = (k < n - 1) ? r : m;
+
+      // Forward (unit lower triangular)
+      for (I_t i = 1; i < m; ++i) {
+        auto x_i = rhs(i, j);
+        for (I_t l = 0; l < i; ++l) {
+          auto a   = block(D, k, i, l);
+          auto x_l = rhs(l, j);
+          for (I_t s = 0; s < batch; ++s) x_i[s] -= a[s] * x_l[s];
+        }
+      }
+
+      // Backward (upper triangular)
+      for (I_t i = m - 1; i >= 0; --i) {
+        auto x_i = rhs(i, j);
+        for (I_t l = i + 1; l < m; ++l) {
+          auto a   = block(D, k, i, l);
+          auto x_l = rhs(l, j);
+          for (I_t s = 0; s < batch; ++s) x_i[s] -= a[s] * x_l[s];
+        }
+        auto pivot = block(D, k, i, i);
+        for (I_t s = 0; s < batch; ++s) x_i[s] /= pivot[s];
+      }
+
+    }
+
+  }
+
+  // Back substitution: y_k -= C_k * y_{k+1}
+  for (I_t k = n - 2; k >= 0; --k) {
+    for (I_t i = 0; i < m; ++i) {
+      auto y = vector(B, k, i);
+      for (I_t j = 0; j < m; ++j) {
+        auto c      = block(DU, k, i, j);
+        auto y_next = vector(B, k + 1, j);
+        for (I_t s = 0; s < batch; ++s) y[s] -= c[s] * y_next[s];
+      }
+    }
+  }
+
+}
+
+} /* namespace LinAlg::LAPACK::NATIVE */
+
+
+using LinAlg::Utilities::check_device;
+using LinAlg::Utilities::check_format;
+using LinAlg::Utilities::check_input_transposed;
+using LinAlg::Utilities::check_dimensions;
+using LinAlg::Utilities::check_same_dimensions;
+
+/** \brief            xGTSV
+ *
+ *  B <- A^(-1) * B   (A tridiagonal)
+ *
+ *  \param[in,out]    DL
+ *                    Subdiagonal, (n - 1) x 1, overwritten.
+ *
+ *  \param[in,out]    D
+ *                    Diagonal, n x 1, overwritten.
+ *
+ *  \param[in,out]    DU
+ *                    Superdiagonal, (n - 1) x 1, overwritten.
+ *
+ *  \param[in,out]    B
+ *                    Right hand sides, n x nrhs, overwritten with the
+ *                    solutions.
+ */
+template <typename T>
+inline void xGTSV(Dense<T>& DL, Dense<T>& D, Dense<T>& DU, Dense<T>& B) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_format(Format::ColMajor, B, "xGTSV(DL, D, DU, B), B");
+  check_input_transposed(B, "xGTSV(DL, D, DU, B), B");
+  check_dimensions(B.rows(), 1, D, "xGTSV(DL, D, DU, B), D");
+  check_dimensions(B.rows() - 1, 1, DL, "xGTSV(DL, D, DU, B), DL");
+  check_dimensions(B.rows() - 1, 1, DU, "xGTSV(DL, D, DU, B), DU");
+  check_device(D, B, "xGTSV(DL, D, DU, B)");
+  check_device(DL, DU, "xGTSV(DL, D, DU, B)");
+  check_device(D, DU, "xGTSV(DL, D, DU, B)");
+#endif /* LINALG_NO_CHECKS */
+
+  auto n    = B.rows();
+  auto nrhs = B.cols();
+  auto ldb  = B._leading_dimension;
+  int  info = 0;
+
+  if (B._location == Location::host) {
+    FORTRAN::xGTSV(n, nrhs, DL._begin(), D._begin(), DU._begin(), B._begin(),
+                   ldb, &info);
+  }
+#ifndef LINALG_NO_CHECKS
+  else {
+    throw excUnimplemented("xGTSV(): LAPACK GTSV not supported on selected "
+                           "location");
+  }
+
+  if (info != 0) {
+    throw excMath("xGTSV(): error: info = %d", info);
+  }
+#endif
+
+}
+
+#ifndef DOXYGEN_SKIP
+namespace {
+
+// Common driver for the batched solvers: systems are the columns of the
+// operands. Format::RowMajor operands with a common leading dimension are
+// already interleaved and are solved in place, other operands are gathered in
+// chunks into an interleaved buffer, solved and scattered back. Ranges of
+// systems are distributed over the threads.
+template <typename T>
+inline void gtsv_batched_driver(I_t n, I_t m, Dense<T>& DL, Dense<T>& D,
+                                Dense<T>& DU, Dense<T>& B, int n_threads,
+                                const char* caller_name) {
+
+  auto batch      = B.cols();
+  auto block_size = m * m;
+
+  if (n == 0 || batch == 0) return;
+
+  int  info       = 0;
+  Threads::Mutex info_lock;
+
+  auto solve = [n, m](const T* dl, T* d, T* du, T* b, I_t ld, I_t count,
+                      int* chunk_info) {
+    if (m == 1) {
+      NATIVE::xGTSV_interleaved(n, count, dl, d, du, b, ld, chunk_info);
+    } else {
+      NATIVE::xGTSV_block_interleaved(n, m, count, dl, d, du, b, ld,
+                                      chunk_info);
+    }
+  };
+
+  std::function<void(I_t, I_t)> body;
+
+  auto ld       = B._leading_dimension;
+  auto in_place = (B._format == Format::RowMajor &&
+                   DL._leading_dimension == ld &&
+                   D._leading_dimension == ld &&
+                   DU._leading_dimension == ld);
+
+  if (in_place) {
+
+    body = [&](I_t begin, I_t end) {
+      int chunk_info = 0;
+      solve(DL._begin() + begin, D._begin() + begin, DU._begin() + begin,
+            B._begin() + begin, ld, end - begin, &chunk_info);
+      if (chunk_info != 0) {
+        Threads::MutexLock lock(info_lock);
+        if (info == 0 || chunk_info < info) info = chunk_info;
+      }
+    };
+
+  } else {
+
+    body = [&](I_t begin, I_t end) {
+
+      // Systems per chunk: enough for the SIMD lanes, small enough for the
+      // chunk's working set to stay in cache
+      const I_t chunk  = 16;
+      auto matrix_size = n * block_size;
+      auto vector_size = n * m;
+      std::vector<T> buffer((3 * matrix_size + vector_size) * chunk);
+      auto dl = buffer.data();
+      auto d  = dl + matrix_size * chunk;
+      auto du = d  + matrix_size * chunk;
+      auto b  = du + matrix_size * chunk;
+      int chunk_info = 0;
+
+      // Pointer to element e of system s of an operand
+      auto element = [](const Dense<T>& A, I_t e, I_t s) {
+        return (A._format == Format::ColMajor) ?
+               A._begin() + s * A._leading_dimension + e :
+               A._begin() + e * A._leading_dimension + s;
+      };
+
+      for (I_t first = begin; first < end; first += chunk) {
+
+        auto count = std::min(chunk, end - first);
+
+        for (I_t s = 0; s < count; ++s) {
+          for (I_t e = 0; e < matrix_size; ++e) {
+            dl[e * chunk + s] = *element(DL, e, first + s);
+            d[e * chunk + s]  = *element(D, e, first + s);
+            du[e * chunk + s] = *element(DU, e, first + s);
+          }
+          for (I_t e = 0; e < vector_size; ++e) {
+            b[e * chunk + s] = *element(B, e, first + s);
+          }
+        }
+
+        solve(dl, d, du, b, chunk, count, &chunk_info);
+
+        for (I_t s = 0; s < count; ++s) {
+          for (I_t e = 0; e < vector_size; ++e) {
+            *element(B, e, first + s) = b[e * chunk + s];
+          }
+        }
+
+        if (chunk_info != 0) {
+          Threads::MutexLock lock(info_lock);
+          if (info == 0 || chunk_info < info) info = chunk_info;
+        }
+
+      }
+
+    };
+
+  }
+
+  Threads::parallel_for(batch, body, n_threads);
+
+#ifndef LINALG_NO_CHECKS
+  if (info != 0) {
+    throw excMath("%s: zero pivot in (block) row %d", caller_name, info - 1);
+  }
+#endif
+
+}
+
+} /* anonymous namespace */
+#endif /* DOXYGEN_SKIP */
+
+/** \brief            Batched tridiagonal solve
+ *
+ *  B(:, s) <- A_s^(-1) * B(:, s)   for all systems s
+ *
+ *  Each column of the operands describes one independent n x n tridiagonal
+ *  system. The systems are solved with the Thomas algorithm, vectorized
+ *  across systems (one system per SIMD lane) and threaded across ranges of
+ *  systems. The operands are used in place if they are in Format::RowMajor
+ *  and share the leading dimension (i.e. are already interleaved), otherwise
+ *  chunks of systems are interleaved through a small buffer.
+ *
+ *  \param[in]        DL
+ *                    Subdiagonals, n x batch. Row 0 is ignored.
+ *
+ *  \param[in]        D
+ *                    Diagonals, n x batch.
+ *
+ *  \param[in,out]    DU
+ *                    Superdiagonals, n x batch. Row n - 1 is ignored.
+ *                    Overwritten if in Format::RowMajor.
+ *
+ *  \param[in,out]    B
+ *                    Right hand sides, n x batch, overwritten with the
+ *                    solutions.
+ *
+ *  \param[in]        n_threads
+ *                    OPTIONAL: number of threads, <= 0 uses all hardware
+ *                    threads. Default: 0.
+ *
+ *  \note             No pivoting is done, the systems should be diagonally
+ *                    dominant or symmetric positive definite. Use xGTSV() for
+ *                    the general case.
+ */
+template <typename T>
+inline void xGTSV_batched(Dense<T>& DL, Dense<T>& D, Dense<T>& DU,
+                          Dense<T>& B, int n_threads = 0) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_input_transposed(DL, "xGTSV_batched(DL, D, DU, B), DL");
+  check_input_transposed(D, "xGTSV_batched(DL, D, DU, B), D");
+  check_input_transposed(DU, "xGTSV_batched(DL, D, DU, B), DU");
+  check_input_transposed(B, "xGTSV_batched(DL, D, DU, B), B");
+  check_same_dimensions(B, DL, "xGTSV_batched(DL, D, DU, B), DL");
+  check_same_dimensions(B, D, "xGTSV_batched(DL, D, DU, B), D");
+  check_same_dimensions(B, DU, "xGTSV_batched(DL, D, DU, B), DU");
+  check_format(B._format, DL, "xGTSV_batched(DL, D, DU, B), DL");
+  check_format(B._format, D, "xGTSV_batched(DL, D, DU, B), D");
+  check_format(B._format, DU, "xGTSV_batched(DL, D, DU, B), DU");
+  if (B._location != Location::host || D._location != Location::host ||
+      DL._location != Location::host || DU._location != Location::host) {
+    throw excUnimplemented("xGTSV_batched(): only supported for matrices in "
+                           "main memory");
+  }
+#endif /* LINALG_NO_CHECKS */
+
+  gtsv_batched_driver(B.rows(), 1, DL, D, DU, B, n_threads,
+                      "xGTSV_batched()");
+
+}
+
+/** \brief            Batched block tridiagonal solve
+ *
+ *  B(:, s) <- A_s^(-1) * B(:, s)   for all systems s
+ *
+ *  Like xGTSV_batched() for block tridiagonal systems with n block rows of
+ *  m x m blocks. Column s of DL, D and DU contains the n blocks of system s,
+ *  each stored in column major order one after the other.
+ *
+ *  \param[in]        block_size
+ *                    Size m of the blocks.
+ *
+ *  \param[in]        DL
+ *                    Subdiagonal blocks, (n * m * m) x batch. Block 0 is
+ *                    ignored.
+ *
+ *  \param[in,out]    D
+ *                    Diagonal blocks, (n * m * m) x batch. Overwritten if in
+ *                    Format::RowMajor.
+ *
+ *  \param[in,out]    DU
+ *                    Superdiagonal blocks, (n * m * m) x batch. Block n - 1
+ *                    is ignored. Overwritten if in Format::RowMajor.
+ *
+ *  \param[in,out]    B
+ *                    Right hand sides, (n * m) x batch, overwritten with the
+ *                    solutions.
+ *
+ *  \param[in]        n_threads
+ *                    OPTIONAL: number of threads, <= 0 uses all hardware
+ *                    threads. Default: 0.
+ *
+ *  \note             No pivoting is done (neither between nor within blocks).
+ */
+template <typename T>
+inline void xGTSV_block_batched(I_t block_size, Dense<T>& DL, Dense<T>& D,
+                                Dense<T>& DU, Dense<T>& B, int n_threads = 0) {
+
+  PROFILING_FUNCTION_HEADER
+
+  auto m = block_size;
+
+#ifndef LINALG_NO_CHECKS
+  if (m < 1 || B.rows() % m != 0) {
+    throw excBadArgument("xGTSV_block_batched(): number of rows of B must be "
+                         "a multiple of block_size");
+  }
+  check_input_transposed(DL, "xGTSV_block_batched(DL, D, DU, B), DL");
+  check_input_transposed(D, "xGTSV_block_batched(DL, D, DU, B), D");
+  check_input_transposed(DU, "xGTSV_block_batched(DL, D, DU, B), DU");
+  check_input_transposed(B, "xGTSV_block_batched(DL, D, DU, B), B");
+  check_dimensions(B.rows() * m, B.cols(), DL, "xGTSV_block_batched(DL, D, "
+                   "DU, B), DL");
+  check_dimensions(B.rows() * m, B.cols(), D, "xGTSV_block_batched(DL, D, "
+                   "DU, B), D");
+  check_dimensions(B.rows() * m, B.cols(), DU, "xGTSV_block_batched(DL, D, "
+                   "DU, B), DU");
+  check_format(B._format, DL, "xGTSV_block_batched(DL, D, DU, B), DL");
+  check_format(B._format, D, "xGTSV_block_batched(DL, D, DU, B), D");
+  check_format(B._format, DU, "xGTSV_block_batched(DL, D, DU, B), DU");
+  if (B._location != Location::host || D._location != Location::host ||
+      DL._location != Location::host || DU._location != Location::host) {
+    throw excUnimplemented("xGTSV_block_batched(): only supported for "
+                           "matrices in main memory");
+  }
+#endif /* LINALG_NO_CHECKS */
+
+  gtsv_batched_driver(B.rows() / m, m, DL, D, DU, B, n_threads,
+                      "xGTSV_block_batched()");
+
+}
+
+} /* namespace LinAlg::LAPACK */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_LAPACK_GTSV_H_ */
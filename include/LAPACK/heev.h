@@ -0,0 +1,208 @@
+/** \file
+ *
+ *  \brief            xHEEV (xSYEV for real types)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_LAPACK_HEEV_H_
+#define LINALG_LAPACK_HEEV_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::LAPACK
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *    LinAlg::LAPACK::<NAME>
+ *        bindings to the <NAME> LAPACK backend
+ */
+
+#include <algorithm>  // std::max
+
+#include "../preprocessor.h"
+#include "../types.h"
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../utilities/checks.h"
+#include "../dense.h"
+
+#ifndef DOXYGEN_SKIP
+extern "C" {
+
+  using LinAlg::I_t;
+  using LinAlg::S_t;
+  using LinAlg::D_t;
+  using LinAlg::C_t;
+  using LinAlg::Z_t;
+
+  void fortran_name(ssyev, SSYEV)(const char* jobz, const char* uplo,
+                                  const I_t* n, S_t* A, const I_t* lda,
+                                  S_t* w, S_t* work, const I_t* lwork,
+                                  int* info);
+  void fortran_name(dsyev, DSYEV)(const char* jobz, const char* uplo,
+                                  const I_t* n, D_t* A, const I_t* lda,
+                                  D_t* w, D_t* work, const I_t* lwork,
+                                  int* info);
+  void fortran_name(cheev, CHEEV)(const char* jobz, const char* uplo,
+                                  const I_t* n, C_t* A, const I_t* lda,
+                                  S_t* w, C_t* work, const I_t* lwork,
+                                  S_t* rwork, int* info);
+  void fortran_name(zheev, ZHEEV)(const char* jobz, const char* uplo,
+                                  const I_t* n, Z_t* A, const I_t* lda,
+                                  D_t* w, Z_t* work, const I_t* lwork,
+                                  D_t* rwork, int* info);
+}
+#endif
+
+namespace LinAlg {
+
+namespace LAPACK {
+
+namespace FORTRAN {
+
+/** \brief            Hermitian eigenproblem
+ *
+ *  A * x = lambda * x
+ *
+ *  For the real types, xSYEV is called and rwork is ignored.
+ *
+ *  \param[in]        jobz
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        n
+ *
+ *  \param[in,out]    A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[out]       w
+ *
+ *  \param[in,out]    work
+ *
+ *  \param[in]        lwork
+ *
+ *  \param[in,out]    rwork
+ *                    At least max(1, 3 * n - 2) elements (complex types only).
+ *
+ *  \param[in,out]    info
+ *
+ *  See [ZHEEV](http://www.math.utah.edu/software/lapack/lapack-z/zheev.html)
+ */
+inline void xHEEV(char jobz, char uplo, I_t n, S_t* A, I_t lda, S_t* w,
+                  S_t* work, I_t lwork, S_t* rwork, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(ssyev, SSYEV)(&jobz, &uplo, &n, A, &lda, w, work, &lwork,
+                             info);
+
+}
+/** \overload
+ */
+inline void xHEEV(char jobz, char uplo, I_t n, D_t* A, I_t lda, D_t* w,
+                  D_t* work, I_t lwork, D_t* rwork, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(dsyev, DSYEV)(&jobz, &uplo, &n, A, &lda, w, work, &lwork,
+                             info);
+
+}
+/** \overload
+ */
+inline void xHEEV(char jobz, char uplo, I_t n, C_t* A, I_t lda, S_t* w,
+                  C_t* work, I_t lwork, S_t* rwork, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(cheev, CHEEV)(&jobz, &uplo, &n, A, &lda, w, work, &lwork,
+                             rwork, info);
+
+}
+/** \overload
+ */
+inline void xHEEV(char jobz, char uplo, I_t n, Z_t* A, I_t lda, D_t* w,
+                  Z_t* work, I_t lwork, D_t* rwork, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(zheev, ZHEEV)(&jobz, &uplo, &n, A, &lda, w, work, &lwork,
+                             rwork, info);
+
+}
+
+} /* namespace LinAlg::LAPACK::FORTRAN */
+
+
+using LinAlg::Utilities::check_format;
+using LinAlg::Utilities::check_input_transposed;
+using LinAlg::Utilities::check_dimensions;
+
+/** \brief            Hermitian eigenproblem
+ *
+ *  A * V = V * diag(w), V^H * V = I
+ *
+ *  \param[in,out]    A
+ *                    Hermitian matrix (upper triangle is referenced), on exit
+ *                    the eigenvectors V.
+ *
+ *  \param[out]       w
+ *                    Eigenvalues in ascending order, A.rows() x 1. If empty,
+ *                    it is allocated.
+ */
+template <typename T, typename R>
+inline void xHEEV(Dense<T>& A, Dense<R>& w) {
+
+  PROFILING_FUNCTION_HEADER
+
+  auto n = A.rows();
+
+  if (w.is_empty()) w.reallocate(n, 1);
+
+#ifndef LINALG_NO_CHECKS
+  check_format(Format::ColMajor, A, "xHEEV(A, w), A");
+  check_input_transposed(A, "xHEEV(A, w), A");
+  if (A.rows() != A.cols()) {
+    throw excBadArgument("xHEEV(A, w), A: matrix must be square");
+  }
+  check_dimensions(n, 1, w, "xHEEV(A, w), w");
+  if (A._location != Location::host || w._location != Location::host) {
+    throw excUnimplemented("xHEEV(): LAPACK HEEV not supported on selected "
+                           "location");
+  }
+#endif /* LINALG_NO_CHECKS */
+
+  auto A_ptr = A._begin();
+  auto lda   = A._leading_dimension;
+  auto w_ptr = w._begin();
+  int  info  = 0;
+
+  // Workspace query
+  T work_size;
+  FORTRAN::xHEEV('V', 'U', n, A_ptr, lda, w_ptr, &work_size, -1, nullptr,
+                 &info);
+  auto lwork = std::max(I_t(1), I_t(real(work_size)));
+  Dense<T> work(lwork, 1);
+  Dense<R> rwork(std::max(I_t(1), 3 * n - 2), 1);
+
+  FORTRAN::xHEEV('V', 'U', n, A_ptr, lda, w_ptr, work._begin(), lwork,
+                 rwork._begin(), &info);
+
+#ifndef LINALG_NO_CHECKS
+  if (info != 0) {
+    throw excMath("xHEEV(): error: info = %d", info);
+  }
+#endif
+
+}
+
+} /* namespace LinAlg::LAPACK */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_LAPACK_HEEV_H_ */
@@ -0,0 +1,236 @@
+/** \file
+ *
+ *  \brief            xHEGV (xSYGV for real types)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_LAPACK_HEGV_H_
+#define LINALG_LAPACK_HEGV_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::LAPACK
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *    LinAlg::LAPACK::<NAME>
+ *        bindings to the <NAME> LAPACK backend
+ */
+
+#include <algorithm>  // std::max
+
+#include "../preprocessor.h"
+#include "../types.h"
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../utilities/checks.h"
+#include "../dense.h"
+
+#ifndef DOXYGEN_SKIP
+extern "C" {
+
+  using LinAlg::I_t;
+  using LinAlg::S_t;
+  using LinAlg::D_t;
+  using LinAlg::C_t;
+  using LinAlg::Z_t;
+
+  void fortran_name(ssygv, SSYGV)(const I_t* itype, const char* jobz,
+                                  const char* uplo, const I_t* n, S_t* A,
+                                  const I_t* lda, S_t* B, const I_t* ldb,
+                                  S_t* w, S_t* work, const I_t* lwork,
+                                  int* info);
+  void fortran_name(dsygv, DSYGV)(const I_t* itype, const char* jobz,
+                                  const char* uplo, const I_t* n, D_t* A,
+                                  const I_t* lda, D_t* B, const I_t* ldb,
+                                  D_t* w, D_t* work, const I_t* lwork,
+                                  int* info);
+  void fortran_name(chegv, CHEGV)(const I_t* itype, const char* jobz,
+                                  const char* uplo, const I_t* n, C_t* A,
+                                  const I_t* lda, C_t* B, const I_t* ldb,
+                                  S_t* w, C_t* work, const I_t* lwork,
+                                  S_t* rwork, int* info);
+  void fortran_name(zhegv, ZHEGV)(const I_t* itype, const char* jobz,
+                                  const char* uplo, const I_t* n, Z_t* A,
+                                  const I_t* lda, Z_t* B, const I_t* ldb,
+                                  D_t* w, Z_t* work, const I_t* lwork,
+                                  D_t* rwork, int* info);
+}
+#endif
+
+namespace LinAlg {
+
+namespace LAPACK {
+
+namespace FORTRAN {
+
+/** \brief            Generalized Hermitian-definite eigenproblem
+ *
+ *  A * x = lambda * B * x  (itype = 1)
+ *
+ *  For the real types, xSYGV is called and rwork is ignored.
+ *
+ *  \param[in]        itype
+ *
+ *  \param[in]        jobz
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        n
+ *
+ *  \param[in,out]    A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in,out]    B
+ *
+ *  \param[in]        ldb
+ *
+ *  \param[out]       w
+ *
+ *  \param[in,out]    work
+ *
+ *  \param[in]        lwork
+ *
+ *  \param[in,out]    rwork
+ *                    At least max(1, 3 * n - 2) elements (complex types only).
+ *
+ *  \param[in,out]    info
+ *
+ *  See [ZHEGV](http://www.math.utah.edu/software/lapack/lapack-z/zhegv.html)
+ */
+inline void xHEGV(I_t itype, char jobz, char uplo, I_t n, S_t* A, I_t lda,
+                  S_t* B, I_t ldb, S_t* w, S_t* work, I_t lwork,
+                  S_t* rwork, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(ssygv, SSYGV)(&itype, &jobz, &uplo, &n, A, &lda, B, &ldb, w,
+                             work, &lwork, info);
+
+}
+/** \overload
+ */
+inline void xHEGV(I_t itype, char jobz, char uplo, I_t n, D_t* A, I_t lda,
+                  D_t* B, I_t ldb, D_t* w, D_t* work, I_t lwork,
+                  D_t* rwork, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(dsygv, DSYGV)(&itype, &jobz, &uplo, &n, A, &lda, B, &ldb, w,
+                             work, &lwork, info);
+
+}
+/** \overload
+ */
+inline void xHEGV(I_t itype, char jobz, char uplo, I_t n, C_t* A, I_t lda,
+                  C_t* B, I_t ldb, S_t* w, C_t* work, I_t lwork,
+                  S_t* rwork, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(chegv, CHEGV)(&itype, &jobz, &uplo, &n, A, &lda, B, &ldb, w,
+                             work, &lwork, rwork, info);
+
+}
+/** \overload
+ */
+inline void xHEGV(I_t itype, char jobz, char uplo, I_t n, Z_t* A, I_t lda,
+                  Z_t* B, I_t ldb, D_t* w, Z_t* work, I_t lwork,
+                  D_t* rwork, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(zhegv, ZHEGV)(&itype, &jobz, &uplo, &n, A, &lda, B, &ldb, w,
+                             work, &lwork, rwork, info);
+
+}
+
+} /* namespace LinAlg::LAPACK::FORTRAN */
+
+
+using LinAlg::Utilities::check_format;
+using LinAlg::Utilities::check_input_transposed;
+using LinAlg::Utilities::check_dimensions;
+using LinAlg::Utilities::check_same_dimensions;
+
+/** \brief            Generalized Hermitian-definite eigenproblem
+ *
+ *  A * V = B * V * diag(w), V^H * B * V = I
+ *
+ *  \param[in,out]    A
+ *                    Hermitian matrix (upper triangle is referenced), on exit
+ *                    the eigenvectors V.
+ *
+ *  \param[in,out]    B
+ *                    Hermitian positive definite matrix (upper triangle is
+ *                    referenced), on exit its Cholesky factor.
+ *
+ *  \param[out]       w
+ *                    Eigenvalues in ascending order, A.rows() x 1. If empty,
+ *                    it is allocated.
+ */
+template <typename T, typename R>
+inline void xHEGV(Dense<T>& A, Dense<T>& B, Dense<R>& w) {
+
+  PROFILING_FUNCTION_HEADER
+
+  auto n = A.rows();
+
+  if (w.is_empty()) w.reallocate(n, 1);
+
+#ifndef LINALG_NO_CHECKS
+  check_format(Format::ColMajor, A, "xHEGV(A, B, w), A");
+  check_format(Format::ColMajor, B, "xHEGV(A, B, w), B");
+  check_input_transposed(A, "xHEGV(A, B, w), A");
+  check_input_transposed(B, "xHEGV(A, B, w), B");
+  if (A.rows() != A.cols()) {
+    throw excBadArgument("xHEGV(A, B, w), A: matrix must be square");
+  }
+  check_same_dimensions(A, B, "xHEGV(A, B, w), B");
+  check_dimensions(n, 1, w, "xHEGV(A, B, w), w");
+  if (A._location != Location::host || B._location != Location::host ||
+      w._location != Location::host) {
+    throw excUnimplemented("xHEGV(): LAPACK HEGV not supported on selected "
+                           "location");
+  }
+#endif /* LINALG_NO_CHECKS */
+
+  auto A_ptr = A._begin();
+  auto lda   = A._leading_dimension;
+  auto B_ptr = B._begin();
+  auto ldb   = B._leading_dimension;
+  auto w_ptr = w._begin();
+  int  info  = 0;
+
+  // Workspace query
+  T work_size;
+  FORTRAN::xHEGV(1, 'V', 'U', n, A_ptr, lda, B_ptr, ldb, w_ptr, &work_size,
+                 -1, nullptr, &info);
+  auto lwork = std::max(I_t(1), I_t(real(work_size)));
+  Dense<T> work(lwork, 1);
+  Dense<R> rwork(std::max(I_t(1), 3 * n - 2), 1);
+
+  FORTRAN::xHEGV(1, 'V', 'U', n, A_ptr, lda, B_ptr, ldb, w_ptr, work._begin(),
+                 lwork, rwork._begin(), &info);
+
+#ifndef LINALG_NO_CHECKS
+  if (info > n) {
+    throw excMath("xHEGV(): error: B is not positive definite (info = %d)",
+                  info);
+  } else if (info != 0) {
+    throw excMath("xHEGV(): error: info = %d", info);
+  }
+#endif
+
+}
+
+} /* namespace LinAlg::LAPACK */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_LAPACK_HEGV_H_ */
@@ -22,12 +22,19 @@
 #define LINALG_LAPACK_LAPACK_H_
 
 // Keep this in alphabetical order
+#include "gbtrf.h"
+#include "gbtrs.h"
 #include "gesv.h"
 #include "getrf.h"
 #include "getri.h"
+#include "getrs.h"
+#include "gtsv.h"
+#include "heev.h"
+#include "hegv.h"
 #include "ilaenv.h"
 #include "larnv.h"
 #include "laset.h"
 #include "laswp.h"
+#include "trtri.h"
 
 #endif /* LINALG_LAPACK_LAPACK_H_ */
@@ -0,0 +1,324 @@
+/** \file
+ *
+ *  \brief            xTRTRI
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_LAPACK_TRTRI_H_
+#define LINALG_LAPACK_TRTRI_H_
+
+/* Organization of the namespace:
+ *
+ *    LinAlg::LAPACK
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *        'Abstract' functions like 'solve' and 'invert'
+ *
+ *    LinAlg::LAPACK::<NAME>
+ *        bindings to the <NAME> LAPACK backend
+ */
+
+#include <utility>      // std::move
+
+#include "../preprocessor.h"
+
+#ifdef HAVE_CUDA
+
+# include <cuda_runtime.h>
+
+# ifdef HAVE_MAGMA
+#   include <magma.h>
+# endif /* HAVE_MAGMA */
+
+#endif /* HAVE_CUDA */
+
+
+#include "../types.h"
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../utilities/checks.h"
+#include "../streams.h"
+#include "../dense.h"
+
+#ifndef DOXYGEN_SKIP
+extern "C" {
+
+  using LinAlg::I_t;
+  using LinAlg::S_t;
+  using LinAlg::D_t;
+  using LinAlg::C_t;
+  using LinAlg::Z_t;
+
+  void fortran_name(strtri, STRTRI)(const char* uplo, const char* diag,
+                                    const I_t* n, S_t* A, const I_t* lda,
+                                    int* info);
+  void fortran_name(dtrtri, DTRTRI)(const char* uplo, const char* diag,
+                                    const I_t* n, D_t* A, const I_t* lda,
+                                    int* info);
+  void fortran_name(ctrtri, CTRTRI)(const char* uplo, const char* diag,
+                                    const I_t* n, C_t* A, const I_t* lda,
+                                    int* info);
+  void fortran_name(ztrtri, ZTRTRI)(const char* uplo, const char* diag,
+                                    const I_t* n, Z_t* A, const I_t* lda,
+                                    int* info);
+}
+#endif
+
+namespace LinAlg {
+
+namespace LAPACK {
+
+namespace FORTRAN {
+
+/** \brief            TRTRI
+ *
+ *  A <- A^{-1} for a triangular matrix A
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        diag
+ *
+ *  \param[in]        n
+ *
+ *  \param[in,out]    A
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in,out]    info
+ *
+ * See [DTRTRI](http://www.math.utah.edu/software/lapack/lapack-d/dtrtri.html)
+ */
+inline void xTRTRI(char uplo, char diag, I_t n, S_t* A, I_t lda, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(strtri, STRTRI)(&uplo, &diag, &n, A, &lda, info);
+
+}
+/** \overload
+ */
+inline void xTRTRI(char uplo, char diag, I_t n, D_t* A, I_t lda, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(dtrtri, DTRTRI)(&uplo, &diag, &n, A, &lda, info);
+
+}
+/** \overload
+ */
+inline void xTRTRI(char uplo, char diag, I_t n, C_t* A, I_t lda, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(ctrtri, CTRTRI)(&uplo, &diag, &n, A, &lda, info);
+
+}
+/** \overload
+ */
+inline void xTRTRI(char uplo, char diag, I_t n, Z_t* A, I_t lda, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  fortran_name(ztrtri, ZTRTRI)(&uplo, &diag, &n, A, &lda, info);
+
+}
+
+} /* namespace LinAlg::LAPACK::FORTRAN */
+
+#ifdef HAVE_CUDA
+# ifdef HAVE_MAGMA
+namespace MAGMA {
+
+/** \brief            TRTRI
+ *
+ *  A <- A^{-1} for a triangular matrix A
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        diag
+ *
+ *  \param[in]        n
+ *
+ *  \param[in,out]    A (on device)
+ *
+ *  \param[in]        lda
+ *
+ *  \param[in,out]    info
+ *
+ * See [DTRTRI](http://www.math.utah.edu/software/lapack/lapack-d/dtrtri.html)
+ * or the MAGMA sources
+ */
+inline void xTRTRI(magma_uplo_t uplo, magma_diag_t diag, I_t n, S_t* A,
+                   I_t lda, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  magma_strtri_gpu(uplo, diag, n, A, lda, info);
+
+}
+/** \overload
+ */
+inline void xTRTRI(magma_uplo_t uplo, magma_diag_t diag, I_t n, D_t* A,
+                   I_t lda, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  magma_dtrtri_gpu(uplo, diag, n, A, lda, info);
+
+}
+/** \overload
+ */
+inline void xTRTRI(magma_uplo_t uplo, magma_diag_t diag, I_t n, C_t* A,
+                   I_t lda, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  magma_ctrtri_gpu(uplo, diag, n, A, lda, info);
+
+}
+/** \overload
+ */
+inline void xTRTRI(magma_uplo_t uplo, magma_diag_t diag, I_t n, Z_t* A,
+                   I_t lda, int* info) {
+
+  PROFILING_FUNCTION_HEADER
+
+  magma_ztrtri_gpu(uplo, diag, n, A, lda, info);
+
+}
+
+} /* namespace LinAlg::LAPACK::MAGMA */
+# endif /* HAVE_MAGMA */
+#endif /* HAVE_CUDA */
+
+using LinAlg::Utilities::check_format;
+using LinAlg::Utilities::check_input_transposed;
+using LinAlg::Utilities::check_stream_alive;
+
+/** \brief            Compute the inverse of a triangular matrix in-place
+ *
+ *  A = A**-1 (in-place)
+ *
+ *  Only the triangle given by uplo is read and overwritten, the other one
+ *  isn't referenced. On the GPU this requires MAGMA.
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        diag
+ *                    Diag::unit assumes a unit diagonal without reading it.
+ *
+ *  \param[in,out]    A
+ *
+ *  \note             The return value of the routine is checked and a
+ *                    corresponding exception is thrown if the matrix is
+ *                    singular.
+ */
+template <typename T>
+inline void xTRTRI(UPLO uplo, Diag diag, Dense<T>& A) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_format(Format::ColMajor, A, "xTRTRI(uplo, diag, A), A");
+  check_input_transposed(A, "xTRTRI(uplo, diag, A), A");
+  if (A._rows != A._cols) {
+    throw excBadArgument("xTRTRI(uplo, diag, A), A: matrix must be square");
+  }
+#endif
+
+  auto n = A.cols();
+  auto A_ptr = A._begin();
+  auto lda = A._leading_dimension;
+  int  info = 0;
+
+  if (A._location == Location::host) {
+
+    char uplo_ = (uplo == UPLO::lower) ? 'L' : 'U';
+    char diag_ = (diag == Diag::unit)  ? 'U' : 'N';
+
+    FORTRAN::xTRTRI(uplo_, diag_, n, A_ptr, lda, &info);
+
+  }
+#if defined(HAVE_CUDA) && defined(HAVE_MAGMA)
+  else if (A._location == Location::GPU) {
+
+    auto uplo_ = (uplo == UPLO::lower) ? MagmaLower : MagmaUpper;
+    auto diag_ = (diag == Diag::unit)  ? MagmaUnit  : MagmaNonUnit;
+
+    MAGMA::xTRTRI(uplo_, diag_, n, A_ptr, lda, &info);
+
+  }
+#endif
+
+#ifndef LINALG_NO_CHECKS
+  else {
+    throw excUnimplemented("xTRTRI(): LAPACK TRTRI not supported on selected "
+                           "location");
+  }
+
+  if (info != 0) {
+    throw excMath("xTRTRI(): error: info = %d", info);
+  }
+#endif
+
+}
+
+/** \brief            Asynchronously compute the inverse of a triangular
+ *                    matrix in-place
+ *
+ *  A = A**-1 (in-place)
+ *
+ *  MAGMA's TRTRI runs on the default stream and returns after completion,
+ *  so for matrices on the GPU this synchronizes with the stream and runs
+ *  xTRTRI().
+ *
+ *  \param[in]        uplo
+ *
+ *  \param[in]        diag
+ *
+ *  \param[in,out]    A
+ *
+ *  \param[in]        stream
+ *
+ *  \returns          The ticket number for the operation on the stream
+ */
+template <typename T>
+inline I_t xTRTRI_async(UPLO uplo, Diag diag, Dense<T>& A, Stream& stream) {
+
+  PROFILING_FUNCTION_HEADER
+
+  I_t ticket = 0;
+
+  if (A._location == Location::host && !stream.synchronous) {
+
+#ifndef LINALG_NO_CHECKS
+    check_stream_alive(stream, "xTRTRI_async()");
+#endif
+
+    // Arguments passed by copy, ensures memory lifetime but callee can't
+    // modify the arguments anymore
+    auto task = [=]() mutable { xTRTRI(uplo, diag, A); };
+
+    ticket = stream.add(std::move(task));
+
+  } else {
+
+    if (A._location != Location::host) stream.sync();
+    xTRTRI(uplo, diag, A);
+
+  }
+
+  return ticket;
+
+}
+
+} /* namespace LinAlg::LAPACK */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_LAPACK_TRTRI_H_ */
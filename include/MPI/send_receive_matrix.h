@@ -230,7 +230,7 @@ inline I_t send_matrix_async(Dense<T>& matrix, MPI_Comm communicator,
     auto task = [=](){ send_matrix(buffer, communicator, receiving_rank, tag, 
                                    recipient_preallocated, buffered); };
 
-    return stream.add(task);
+    return stream.add(std::move(task));
 
   }
 
@@ -448,7 +448,7 @@ I_t receive_matrix_async(Dense<T>& matrix, MPI_Comm communicator,
                                                             sending_rank, 
                                                             tag); };
 
-        return stream.add(task);
+        return stream.add(std::move(task));
 
       } else {
 
@@ -457,7 +457,7 @@ I_t receive_matrix_async(Dense<T>& matrix, MPI_Comm communicator,
         auto task = [=]() mutable { receive_matrix(matrix, communicator, 
                                                    sending_rank, tag); };
 
-        return stream.add(task);
+        return stream.add(std::move(task));
 
       }
 
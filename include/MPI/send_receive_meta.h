@@ -164,7 +164,7 @@ inline I_t send_meta_async(MetaData& meta, MPI_Comm communicator,
 
     auto task = [=]() { send_meta(meta, communicator, receiving_rank, tag); };
   
-    return stream.add(task);
+    return stream.add(std::move(task));
   
   }
 
@@ -375,7 +375,7 @@ inline I_t receive_meta_async(MetaData& meta, MPI_Comm communicator,
     auto task = [=, &meta]() mutable { receive_meta(meta, communicator, 
                                                     sending_rank, tag); };
 
-    return stream.add(task);
+    return stream.add(std::move(task));
   
   }
 
@@ -455,7 +455,7 @@ inline I_t receive_meta_async(Dense<T>& matrix, MPI_Comm communicator,
     auto task = [=, &matrix]() mutable { receive_meta(matrix, communicator, 
                                                       sending_rank, tag); };
 
-    return stream.add(task);
+    return stream.add(std::move(task));
 
   }
 
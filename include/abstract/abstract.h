@@ -38,6 +38,7 @@
 
 #include "add.h"
 #include "invert.h"
+#include "matrix_powers.h"
 #include "multiply.h"
 #include "solve.h"
 
@@ -0,0 +1,546 @@
+/** \file
+ *
+ *  \brief            Sparse matrix powers kernel
+ *
+ *  Organization of the namespace:
+ *
+ *    LinAlg
+ *        functions like 'solve' and 'multiply' (abstract/\*.h)
+ *
+ *    LinAlg::BLAS
+ *
+ *        convenience bindings supporting different locations for Dense<T>
+ *
+ *    LinAlg::BLAS::\<backend\>
+ *
+ *        bindings for the backend
+ *
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_ABSTRACT_MATRIX_POWERS_H_
+#define LINALG_ABSTRACT_MATRIX_POWERS_H_
+
+#include <vector>     // std::vector
+#include <algorithm>  // std::min, std::max, std::sort, std::lower_bound
+#include <utility>    // std::swap, std::pair
+
+#include "../preprocessor.h"
+
+#include "../types.h"
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../executor.h"
+#include "../utilities/checks.h"
+#include "../dense.h"
+#include "../sparse.h"
+#include "../BLAS/native/csrmm.h"
+
+namespace LinAlg {
+
+#ifndef DOXYGEN_SKIP
+/*  Products of the local copies of the tiles of MatrixPowers with a vector.
+ *  The copies are stored in slices of C consecutive rows, within a slice the
+ *  k-th elements of the C rows are stored next to each other and shorter rows
+ *  are padded with zeros (sliced ELLPACK). A slice is multiplied with C
+ *  independent accumulators and without a loop over the row lengths.
+ *
+ *  multiply() computes y[0, C * n_slices) from the slices [0, n_slices).
+ */
+
+// Real types
+template <typename T, int C>
+struct MatrixPowersSlices {
+
+  static inline void multiply(I_t n_slices, const I_t* start,
+                              const I_t* indices, const T* values, const T* x,
+                              T* y) {
+
+    for (I_t slice = 0; slice < n_slices; ++slice) {
+
+      T sum[C];
+      for (int row = 0; row < C; ++row) sum[row] = cast<T>(0.0);
+
+      for (auto index = start[slice]; index < start[slice + 1]; index += C) {
+        for (int row = 0; row < C; ++row) {
+          sum[row] += values[index + row] * x[indices[index + row]];
+        }
+      }
+
+      for (int row = 0; row < C; ++row) y[slice * C + row] = sum[row];
+
+    }
+
+  }
+
+};
+
+// Complex types (real arithmetic on the real and imaginary parts, which
+// avoids the overflow handling of the complex multiplication)
+template <typename T, int C>
+struct MatrixPowersComplexSlices {
+
+  static inline void multiply(I_t n_slices, const I_t* start,
+                              const I_t* indices, const T* values, const T* x,
+                              T* y) {
+
+    typedef typename RealType<T>::type R;
+
+    // std::complex<R> is laid out as R[2]
+    auto values_ri = reinterpret_cast<const R*>(values);
+    auto x_ri      = reinterpret_cast<const R*>(x);
+
+    for (I_t slice = 0; slice < n_slices; ++slice) {
+
+      R sum_real[C], sum_imag[C];
+      for (int row = 0; row < C; ++row) sum_real[row] = sum_imag[row] = R(0);
+
+      for (auto index = start[slice]; index < start[slice + 1]; index += C) {
+        for (int row = 0; row < C; ++row) {
+          auto a_real = values_ri[2 * (index + row)];
+          auto a_imag = values_ri[2 * (index + row) + 1];
+          auto x_real = x_ri[2 * indices[index + row]];
+          auto x_imag = x_ri[2 * indices[index + row] + 1];
+          sum_real[row] += a_real * x_real - a_imag * x_imag;
+          sum_imag[row] += a_real * x_imag + a_imag * x_real;
+        }
+      }
+
+      for (int row = 0; row < C; ++row) {
+        y[slice * C + row] = cast<T>(sum_real[row], sum_imag[row]);
+      }
+
+    }
+
+  }
+
+};
+
+template <int C>
+struct MatrixPowersSlices<C_t, C> : MatrixPowersComplexSlices<C_t, C> {};
+template <int C>
+struct MatrixPowersSlices<Z_t, C> : MatrixPowersComplexSlices<Z_t, C> {};
+#endif /* DOXYGEN_SKIP */
+
+/** \brief            Matrix powers kernel for repeated application
+ *
+ *  V <- [x, A * x, A^2 * x, ..., A^s * x]
+ *
+ *  The rows of A are split into tiles. For each tile, the rows of all powers
+ *  up to s that the tile depends on (the tile plus its ghost zone, found by
+ *  following the sparsity pattern of A s - 1 times) are gathered into a local
+ *  copy with local column indices. All s powers are then computed from
+ *  that copy before moving to the next tile, such that A is read from main
+ *  memory once instead of s times. The price is the redundant computation of
+ *  the ghost zone rows, which is small for matrices with local coupling
+ *  (e.g. from stencils on structured grids with reasonably ordered unknowns).
+ *  Tiles are processed in parallel.
+ *
+ *  setup() builds the ghost zones and the local copies, apply() only runs
+ *  the powers on them. The local copies are stored in slices of a few rows
+ *  padded to the same length (sliced ELLPACK), which are multiplied without
+ *  the row length loop of CSR and, for complex types, without the overflow
+ *  handling of the complex multiplication. The setup costs in the order of
+ *  ten multiplies with A, so the kernel only pays off if it is applied many
+ *  times (e.g. in s-step Krylov methods). For s <= 1 apply() is a plain
+ *  xCSRMM().
+ *
+ *  Example:
+ *
+ *    MatrixPowers<D_t> powers;
+ *    powers.tile_rows = 64 * grid;
+ *    powers.setup(A, s);
+ *    powers.apply(x, V);    // V <- [x, A * x, ..., A^s * x]
+ *    ...
+ *    powers.apply(y, W);
+ */
+template <typename T>
+struct MatrixPowers {
+
+  /// Number of rows per tile. Tiles should be small enough for the tile and
+  /// its ghost zone to stay in cache. Default: 2048
+  I_t tile_rows;
+  /// Number of threads, <= 0 uses all hardware threads. Default: 0
+  int n_threads;
+
+  MatrixPowers();
+
+  // Build the tiles for the powers of A up to A^s
+  void setup(const Sparse<T>& A, I_t s);
+
+  // V <- [x, A * x, ..., A^s * x]
+  void apply(const Dense<T>& x, Dense<T>& V) const;
+
+  /// Highest power computed by apply(), -1 before setup()
+  inline I_t s() const { return _s; }
+
+#ifndef DOXYGEN_SKIP
+  struct Tile {
+
+    // Rows [begin, end) of A, the first end - begin local rows
+    I_t              begin;
+    I_t              end;
+    // Global rows of the ghost zone, local row end - begin + i is ghost[i]
+    std::vector<I_t> ghost;
+    // level_end[j]: number of local rows for which power j is required. The
+    // local rows are ordered such that these are the first level_end[j] rows
+    std::vector<I_t> level_end;
+    // Local copy of the rows for which any power >= 1 is computed, in
+    // slices of _slice_rows rows. Slice i starts at start[i].
+    std::vector<I_t> start;
+    std::vector<I_t> indices;
+    std::vector<T>   values;
+
+    Tile() : begin(0), end(0) {}
+
+  };
+
+  static const int  _slice_rows = 4;
+
+  Sparse<T>         _A;
+  I_t               _s;
+  std::vector<Tile> _tiles;
+  // Length of the local vectors: largest number of local rows of a tile,
+  // rounded up to full slices
+  I_t               _max_local;
+
+  void _setup_tile(Tile& tile) const;
+#endif /* DOXYGEN_SKIP */
+
+};
+
+/** \brief            Constructor, sets the default parameters
+ */
+template <typename T>
+MatrixPowers<T>::MatrixPowers()
+  : tile_rows(2048),
+    n_threads(0),
+    _s(-1),
+    _max_local(0) {}
+
+#ifndef DOXYGEN_SKIP
+// Ghost zone and local copy of one tile. The rows of the tile are a
+// contiguous range, only the ghost rows need a lookup (a sorted list instead
+// of an array over all rows of A, such that the cost stays proportional to
+// the size of the tile)
+template <typename T>
+inline void MatrixPowers<T>::_setup_tile(Tile& tile) const {
+
+  typedef std::pair<I_t, I_t> Entry;
+
+  auto values      = _A._values.get();
+  auto indices     = _A._indices.get();
+  auto edges       = _A._edges.get();
+  auto first_index = _A._first_index;
+  auto tile_size   = tile.end - tile.begin;
+
+  auto global_of = [&](I_t local) {
+    return (local < tile_size) ? tile.begin + local
+                               : tile.ghost[local - tile_size];
+  };
+  auto before = [](const Entry& entry, I_t row) { return entry.first < row; };
+
+  // Ghost rows as (global row, local row), sorted by global row
+  std::vector<Entry> sorted_ghosts;
+  std::vector<I_t>   columns;
+
+  tile.ghost.clear();
+  tile.level_end.assign(_s + 1, 0);
+  tile.level_end[_s] = tile_size;
+
+  // Level s are the tile's rows, level j - 1 adds all columns referenced by
+  // rows of level j
+  I_t level_begin = 0;
+  for (auto j = _s; j > 0; --j) {
+
+    columns.clear();
+    for (auto local = level_begin; local < tile.level_end[j]; ++local) {
+      auto row = global_of(local);
+      for (auto index = edges[row] - first_index;
+           index < edges[row + 1] - first_index; ++index) {
+        auto col = indices[index] - first_index;
+        if (col < tile.begin || col >= tile.end) columns.push_back(col);
+      }
+    }
+    std::sort(columns.begin(), columns.end());
+    columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+
+    auto n_sorted = sorted_ghosts.size();
+    for (auto col : columns) {
+      auto known = std::lower_bound(sorted_ghosts.begin(),
+                                    sorted_ghosts.begin() + n_sorted, col,
+                                    before);
+      if (known == sorted_ghosts.begin() + n_sorted || known->first != col) {
+        sorted_ghosts.emplace_back(col, tile_size + I_t(tile.ghost.size()));
+        tile.ghost.push_back(col);
+      }
+    }
+    std::inplace_merge(sorted_ghosts.begin(),
+                       sorted_ghosts.begin() + n_sorted, sorted_ghosts.end());
+
+    level_begin           = tile.level_end[j];
+    tile.level_end[j - 1] = tile_size + I_t(tile.ghost.size());
+
+  }
+
+  // Local copy in slices of C rows, padded with zeros (and the last column
+  // index of the row, such that no additional elements of x are read)
+  const int C    = _slice_rows;
+  auto n_compute = tile.level_end[1];
+  auto n_slices  = (n_compute + C - 1) / C;
+  auto local_of  = [&](I_t col) {
+    if (col >= tile.begin && col < tile.end) return col - tile.begin;
+    return std::lower_bound(sorted_ghosts.begin(), sorted_ghosts.end(), col,
+                            before)->second;
+  };
+
+  tile.start.resize(n_slices + 1);
+  tile.start[0] = 0;
+  for (I_t slice = 0; slice < n_slices; ++slice) {
+    I_t width = 0;
+    for (auto local = slice * C; local < std::min(slice * C + C, n_compute);
+         ++local) {
+      auto row = global_of(local);
+      width = std::max(width, edges[row + 1] - edges[row]);
+    }
+    tile.start[slice + 1] = tile.start[slice] + width * C;
+  }
+
+  tile.indices.assign(tile.start[n_slices], 0);
+  tile.values.assign(tile.start[n_slices], cast<T>(0.0));
+  for (I_t slice = 0; slice < n_slices; ++slice) {
+    for (auto local = slice * C; local < std::min(slice * C + C, n_compute);
+         ++local) {
+      auto row    = global_of(local);
+      auto target = tile.start[slice] + local - slice * C;
+      I_t  col    = 0;
+      for (auto index = edges[row] - first_index;
+           index < edges[row + 1] - first_index; ++index, target += C) {
+        col = local_of(indices[index] - first_index);
+        tile.indices[target] = col;
+        tile.values[target]  = values[index];
+      }
+      for (; target < tile.start[slice + 1]; target += C) {
+        tile.indices[target] = col;
+      }
+    }
+  }
+
+}
+#endif /* DOXYGEN_SKIP */
+
+/** \brief            Build the tiles for the powers of a matrix
+ *
+ *  \param[in]        A
+ *                    Square matrix in Format::CSR, in main memory. A shallow
+ *                    copy of A is stored, its values are copied into the
+ *                    tiles (changing them requires another setup()).
+ *
+ *  \param[in]        s
+ *                    Highest power to compute.
+ */
+template <typename T>
+void MatrixPowers<T>::setup(const Sparse<T>& A, I_t s) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  Utilities::check_format(Format::CSR, A, "MatrixPowers.setup(A, s), A");
+  Utilities::check_input_transposed(A, "MatrixPowers.setup(A, s), A");
+  if (s < 0 || tile_rows < 1) {
+    throw excBadArgument("MatrixPowers.setup(A, s): s must be non-negative "
+                         "and tile_rows positive");
+  }
+  if (A._location != Location::host) {
+    throw excUnimplemented("MatrixPowers.setup(A, s): only matrices in main "
+                           "memory are supported");
+  }
+#endif
+
+  _A.clone_from(A);
+  _s         = s;
+  _max_local = 0;
+  _tiles.clear();
+
+  auto n = A._size;
+
+  // Nothing to reuse, apply() uses plain SpMVs
+  if (s <= 1 || n == 0) return;
+
+  auto n_tiles = (n + tile_rows - 1) / tile_rows;
+  _tiles.resize(n_tiles);
+
+  Threads::parallel_for(n_tiles, [&](I_t first_tile, I_t last_tile) {
+    for (auto t = first_tile; t < last_tile; ++t) {
+      _tiles[t].begin = t * tile_rows;
+      _tiles[t].end   = std::min(_tiles[t].begin + tile_rows, n);
+      _setup_tile(_tiles[t]);
+    }
+  }, n_threads);
+
+  for (auto& tile : _tiles) {
+    auto n_slices = I_t(tile.start.size()) - 1;
+    _max_local = std::max(_max_local, std::max(tile.level_end[0],
+                                                n_slices * _slice_rows));
+  }
+
+}
+
+/** \brief            Compute the powers of the matrix passed to setup()
+ *
+ *  V <- [x, A * x, A^2 * x, ..., A^s * x]
+ *
+ *  \param[in]        x
+ *                    Start vector, A.rows() x 1, Format::ColMajor.
+ *
+ *  \param[in,out]    V
+ *                    Output multi-vector, A.rows() x (s + 1),
+ *                    Format::ColMajor. If empty, it is allocated.
+ */
+template <typename T>
+void MatrixPowers<T>::apply(const Dense<T>& x, Dense<T>& V) const {
+
+  PROFILING_FUNCTION_HEADER
+
+  auto n = _A._size;
+
+#ifndef LINALG_NO_CHECKS
+  if (_s < 0) {
+    throw excUserError("MatrixPowers.apply(x, V): call setup() first");
+  }
+#endif
+
+  if (V.is_empty()) V.reallocate(n, _s + 1);
+
+#ifndef LINALG_NO_CHECKS
+  Utilities::check_format(Format::ColMajor, x, "MatrixPowers.apply(x, V), x");
+  Utilities::check_format(Format::ColMajor, V, "MatrixPowers.apply(x, V), V");
+  Utilities::check_input_transposed(x, "MatrixPowers.apply(x, V), x");
+  Utilities::check_output_transposed(V, "MatrixPowers.apply(x, V), V");
+  Utilities::check_dimensions(n, 1, x, "MatrixPowers.apply(x, V), x");
+  Utilities::check_dimensions(n, _s + 1, V, "MatrixPowers.apply(x, V), V");
+  if (x._location != Location::host || V._location != Location::host) {
+    throw excUnimplemented("MatrixPowers.apply(x, V): only vectors in main "
+                           "memory are supported");
+  }
+#endif
+
+  auto x_ptr = x._begin();
+  auto V_ptr = V._begin();
+  auto ldv   = V._leading_dimension;
+
+  if (_s <= 1) {
+    for (I_t row = 0; row < n; ++row) V_ptr[row] = x_ptr[row];
+    if (_s == 1 && n > 0) {
+      Dense<T> Ax(V_ptr + ldv, ldv, n, 1);
+      BLAS::NATIVE::xCSRMM(cast<T>(1.0), _A, x, cast<T>(0.0), Ax, n_threads);
+    }
+    return;
+  }
+
+  auto s = _s;
+
+  Threads::parallel_for(I_t(_tiles.size()), [&](I_t first_tile,
+                                                I_t last_tile) {
+
+    // Two local vectors suffice: power j only depends on power j - 1
+    std::vector<T> local_V(2 * _max_local);
+
+    for (auto t = first_tile; t < last_tile; ++t) {
+
+      auto& tile     = _tiles[t];
+      auto tile_size = tile.end - tile.begin;
+      auto n_local   = tile.level_end[0];
+      auto start     = tile.start.data();
+      auto indices   = tile.indices.data();
+      auto values    = tile.values.data();
+      auto previous  = local_V.data();
+      auto current   = previous + n_local;
+
+      for (I_t local = 0; local < tile_size; ++local) {
+        previous[local] = V_ptr[tile.begin + local] = x_ptr[tile.begin + local];
+      }
+      for (I_t local = tile_size; local < n_local; ++local) {
+        previous[local] = x_ptr[tile.ghost[local - tile_size]];
+      }
+
+      for (I_t j = 1; j <= s; ++j) {
+
+        auto v_j = V_ptr + j * ldv + tile.begin;
+
+        // Rows beyond level_end[j] in the last slice are computed from
+        // incomplete inputs but never used
+        auto n_slices = (tile.level_end[j] + _slice_rows - 1) / _slice_rows;
+        MatrixPowersSlices<T, _slice_rows>::multiply(n_slices, start, indices,
+                                                     values, previous,
+                                                     current);
+
+        // The tile's rows are the first ones in the local numbering
+        for (I_t local = 0; local < tile_size; ++local) {
+          v_j[local] = current[local];
+        }
+
+        std::swap(previous, current);
+
+      }
+
+    }
+
+  }, n_threads);
+
+}
+
+/** \brief            Matrix powers kernel
+ *
+ *  V <- [x, A * x, A^2 * x, ..., A^s * x]
+ *
+ *  Convenience function for a single application of MatrixPowers (see there
+ *  for the algorithm). The setup costs in the order of ten multiplies with A,
+ *  use a MatrixPowers object to compute powers of the same matrix
+ *  repeatedly.
+ *
+ *  \param[in]        A
+ *                    Square matrix in Format::CSR, in main memory.
+ *
+ *  \param[in]        x
+ *                    Start vector, A.rows() x 1, Format::ColMajor.
+ *
+ *  \param[in]        s
+ *                    Highest power to compute.
+ *
+ *  \param[in,out]    V
+ *                    Output multi-vector, A.rows() x (s + 1),
+ *                    Format::ColMajor. If empty, it is allocated.
+ *
+ *  \param[in]        tile_rows
+ *                    OPTIONAL: number of rows per tile. Tiles should be small
+ *                    enough for the tile and its ghost zone to stay in cache.
+ *                    Default: 2048.
+ *
+ *  \param[in]        n_threads
+ *                    OPTIONAL: number of threads, <= 0 uses all hardware
+ *                    threads. Default: 0.
+ */
+template <typename T>
+inline void matrix_powers(const Sparse<T>& A, const Dense<T>& x, I_t s,
+                          Dense<T>& V, I_t tile_rows = 2048,
+                          int n_threads = 0) {
+
+  PROFILING_FUNCTION_HEADER
+
+  MatrixPowers<T> powers;
+  powers.tile_rows = tile_rows;
+  powers.n_threads = n_threads;
+  powers.setup(A, s);
+  powers.apply(x, V);
+
+}
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_ABSTRACT_MATRIX_POWERS_H_ */
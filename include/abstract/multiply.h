@@ -34,6 +34,9 @@
 #ifndef LINALG_ABSTRACT_MULTIPLY_H_
 #define LINALG_ABSTRACT_MULTIPLY_H_
 
+#include <algorithm>    // std::min, std::max
+#include <type_traits>  // std::is_same
+
 #include "../preprocessor.h"
 
 #include "../types.h"
@@ -43,6 +46,7 @@
 #include "../BLAS/blas.h"      // the bindings to the various BLAS libraries
 #include "../dense.h"
 #include "../sparse.h"
+#include "../dia.h"
 #include "add.h"
 
 namespace LinAlg {
@@ -57,10 +61,97 @@ namespace LinAlg {
 /////////////////
 // Multiplication
 
+#ifndef DOXYGEN_SKIP
+// Runs C <- alpha * A * B + beta * C with xGEMV(), xSYRK(), xSYMM() or xHEMM()
+// if the shapes or properties of the operands allow it. Returns false if the
+// product is left to xGEMM() (which also reports any invalid arguments).
+template <typename T>
+inline bool multiply_structured(const T alpha, const Dense<T>& A,
+                                const Dense<T>& B, const T beta,
+                                Dense<T>& C) {
+
+  if (A._format != Format::ColMajor || B._format != Format::ColMajor ||
+      C._format != Format::ColMajor || C._transposed) {
+    return false;
+  }
+  if (A._location != C._location || B._location != C._location ||
+      A._device_id != C._device_id || B._device_id != C._device_id) {
+    return false;
+  }
+  if (A.rows() != C.rows() || A.cols() != B.rows() || B.cols() != C.cols()) {
+    return false;
+  }
+
+  // Matrix times vector: a row vector result is computed as the transposed
+  // product C**T = B**T * A**T
+  if (C.cols() == 1) {
+    BLAS::xGEMV(alpha, A, B, beta, C);
+    return true;
+  } else if (C.rows() == 1) {
+    Dense<T> B_T(B);
+    B_T.transpose();
+    BLAS::xGEMV(alpha, B_T, A, beta, C);
+    return true;
+  }
+
+  // A * A**T: B is the transposed view of the storage of A. xSYRK() only
+  // updates one triangle which is then mirrored, so the result is only the
+  // general product if the triangle left out doesn't contribute
+  if (A._begin() == B._begin() && A._transposed != B._transposed &&
+      A._leading_dimension == B._leading_dimension &&
+      C._location == Location::host &&
+      (beta == cast<T>(0.0) || C.is(Property::symmetric))) {
+
+    BLAS::xSYRK(UPLO::lower, alpha, A, beta, C);
+
+    auto C_ptr = C._begin();
+    auto ldc   = C._leading_dimension;
+    for (I_t col = 1; col < C.cols(); ++col) {
+      for (I_t row = 0; row < col; ++row) {
+        C_ptr[row + col * ldc] = C_ptr[col + row * ldc];
+      }
+    }
+
+    return true;
+
+  }
+
+  // Symmetric operands are their own transpose, hermitian ones are only
+  // usable untransposed
+  if (!B._transposed) {
+    if (A.is(Property::symmetric)) {
+      BLAS::xSYMM(Side::left, UPLO::upper, alpha, A, B, beta, C);
+      return true;
+    } else if (A.is(Property::hermitian) && !A._transposed) {
+      BLAS::xHEMM(Side::left, UPLO::upper, alpha, A, B, beta, C);
+      return true;
+    }
+  }
+  if (!A._transposed) {
+    if (B.is(Property::symmetric)) {
+      BLAS::xSYMM(Side::right, UPLO::upper, alpha, B, A, beta, C);
+      return true;
+    } else if (B.is(Property::hermitian) && !B._transposed) {
+      BLAS::xHEMM(Side::right, UPLO::upper, alpha, B, A, beta, C);
+      return true;
+    }
+  }
+
+  return false;
+
+}
+#endif /* DOXYGEN_SKIP */
+
 /** \brief            Matrix-matrix multiply with prefactors
  *
  *  C <- alpha * A * B + beta * C
  *
+ *  Uses xGEMV() if C is a single column or row, xSYMM() or xHEMM() if A or
+ *  B is marked Property::symmetric or Property::hermitian and xSYRK() (half
+ *  the operations) if B is the transposed view of A in main memory and beta
+ *  is zero or C is marked Property::symmetric. All other products use
+ *  xGEMM().
+ *
  *  \param[in]        alpha
  *                    OPTIONAL: default = T(1)
  *
@@ -76,13 +167,14 @@ namespace LinAlg {
 template <typename T>
 inline void multiply(const T alpha, const Dense<T>& A, const Dense<T>& B,
                      const T beta, Dense<T>& C) {
+  if (multiply_structured(alpha, A, B, beta, C)) return;
   BLAS::xGEMM(alpha, A, B, beta, C);
 }
 /** \overload
  */
 template <typename T>
 inline void multiply(const Dense<T>& A, const Dense<T>& B, Dense<T>& C) {
-  BLAS::xGEMM(cast<T>(1.0), A, B, cast<T>(0.0), C);
+  multiply(cast<T>(1.0), A, B, cast<T>(0.0), C);
 }
 
 /** \brief           Mixed type matrix-matrix multiply
@@ -210,11 +302,13 @@ inline void multiply(const T alpha, const Dense<T>& A, const Dense<U>& B,
 
   PROFILING_FUNCTION_HEADER
 
-#ifdef HAVE_MKL
+#if defined(HAVE_MKL) || defined(USE_NATIVE_GEMM)
   if (C._location == Location::host) {
   
-    // We can 'upcast' alpha from real to complex and use MKL's dzgemm instead 
-    // of our awful hack
+    // We can 'upcast' alpha from real to complex and use MKL's dzgemm (or the 
+    // native implementation, which splits B while packing it) instead of our 
+    // awful hack. With a tuned BLAS library but without MKL the two real 
+    // products of the hack are faster than the portable native kernels.
     LinAlg::BLAS::xGEMM(cast<U>(alpha), A, B, beta, C);
 
   } else {
@@ -225,11 +319,10 @@ inline void multiply(const T alpha, const Dense<T>& A, const Dense<U>& B,
 
     multiply(alpha, A, B, beta, C, work_T);
 
-#ifdef HAVE_MKL
+#if defined(HAVE_MKL) || defined(USE_NATIVE_GEMM)
   }
 #endif
 
-
 }
 /** \overload
  */
@@ -345,10 +438,43 @@ inline void multiply(const T alpha, const Dense<U>& A, const Dense<T>& B,
 
   PROFILING_FUNCTION_HEADER
 
-  // Pass through to the hack, it will allocate as needed
-  Dense<T> work_T;
+  typedef typename RealType<U>::type R;
+
+  bool on_host = C._location == Location::host &&
+                 std::is_same<T, R>::value && A._format == Format::ColMajor &&
+                 C._format == Format::ColMajor && !C._transposed;
+
+  if (on_host && !A._transposed && imag(beta) == 0) {
 
-  multiply(alpha, A, B, beta, C, work_T);
+    // Viewed as real matrices with twice the rows, C = alpha * A * B + beta * 
+    // C is a real product (the real and imaginary parts of each element of A 
+    // and C are consecutive rows of the views), no copies are needed
+    auto A_ptr = reinterpret_cast<T*>(A._begin());
+    auto C_ptr = reinterpret_cast<T*>(C._begin());
+    Dense<T> A_view(A_ptr, 2 * A._leading_dimension, 2 * A.rows(), A.cols(),
+                    A._location, A._device_id);
+    Dense<T> C_view(C_ptr, 2 * C._leading_dimension, 2 * C.rows(), C.cols(),
+                    C._location, C._device_id);
+
+    multiply(alpha, A_view, B, cast<T>(real(beta)), C_view);
+
+  }
+#ifdef USE_NATIVE_GEMM
+  else if (on_host) {
+
+    // The native implementation splits A while packing it
+    BLAS::NATIVE::xGEMM_mixed(cast<U>(alpha), A, B, beta, C);
+
+  }
+#endif
+  else {
+
+    // Pass through to the hack, it will allocate as needed
+    Dense<T> work_T;
+
+    multiply(alpha, A, B, beta, C, work_T);
+
+  }
 
 }
 /** \overload
@@ -360,6 +486,153 @@ inline void multiply(const Dense<U>& A, const Dense<T>& B, Dense<U>& C) {
 
 }
 
+
+/** \brief            Sparse matrix times dense matrix multiply
+ *
+ *  Y <- alpha * A * X + beta * Y
+ *
+ *  \param[in]        alpha
+ *                    OPTIONAL: default = T(1)
+ *
+ *  \param[in]        A
+ *                    Format::CSR.
+ *
+ *  \param[in]        X
+ *
+ *  \param[in]        beta
+ *                    OPTIONAL: default = T(0)
+ *
+ *  \param[in,out]    Y
+ */
+template <typename T>
+inline void multiply(const T alpha, const Sparse<T>& A, const Dense<T>& X,
+                     const T beta, Dense<T>& Y) {
+
+  PROFILING_FUNCTION_HEADER
+
+  if (A._location == Location::host) {
+    BLAS::NATIVE::xCSRMM(alpha, A, X, beta, Y);
+  }
+#ifndef LINALG_NO_CHECKS
+  else {
+    throw excUnimplemented("multiply(alpha, A, X, beta, Y): sparse matrix "
+                           "multiplication not supported on selected "
+                           "location");
+  }
+#endif
+
+}
+/** \overload
+ */
+template <typename T>
+inline void multiply(const Sparse<T>& A, const Dense<T>& X, Dense<T>& Y) {
+  multiply(cast<T>(1.0), A, X, cast<T>(0.0), Y);
+}
+
+/** \brief            Sparse matrix-matrix multiply for matrices in diagonal
+ *                    (DIA) storage
+ *
+ *  Y <- alpha * A * X + beta * Y
+ *
+ *  The loops run along the diagonals of A such that all accesses to A, X and
+ *  Y are unit stride and the innermost loop is vectorized by the compiler.
+ *  Rows are processed in blocks to keep the block of Y in cache while all
+ *  diagonals are applied.
+ *
+ *  \param[in]        alpha
+ *                    OPTIONAL: default = T(1)
+ *
+ *  \param[in]        A
+ *
+ *  \param[in]        X
+ *                    Format::ColMajor, in main memory.
+ *
+ *  \param[in]        beta
+ *                    OPTIONAL: default = T(0)
+ *
+ *  \param[in,out]    Y
+ *                    Format::ColMajor, in main memory.
+ */
+template <typename T>
+inline void multiply(const T alpha, const DIA<T>& A, const Dense<T>& X,
+                     const T beta, Dense<T>& Y) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  Utilities::check_format(Format::ColMajor, X, "multiply(alpha, A, X, beta, "
+                          "Y), X");
+  Utilities::check_format(Format::ColMajor, Y, "multiply(alpha, A, X, beta, "
+                          "Y), Y");
+  Utilities::check_input_transposed(X, "multiply(alpha, A, X, beta, Y), X");
+  Utilities::check_output_transposed(Y, "multiply(alpha, A, X, beta, Y), Y");
+  Utilities::check_dimensions(A.cols(), Y.cols(), X, "multiply(alpha, A, X, "
+                              "beta, Y), X");
+  Utilities::check_dimensions(A.rows(), X.cols(), Y, "multiply(alpha, A, X, "
+                              "beta, Y), Y");
+  if (X._location != Location::host || Y._location != Location::host) {
+    throw excUnimplemented("multiply(alpha, A, X, beta, Y): DIA matrix "
+                           "multiplication only supported in main memory");
+  }
+#endif
+
+  // Rows per block, chosen such that a block of Y and the corresponding
+  // parts of the diagonals of A fit in L1/L2
+  const I_t block_size = 2048;
+
+  auto rows        = A.rows();
+  auto cols        = A.cols();
+  auto n_diagonals = A.n_diagonals();
+  auto offsets     = A._offsets._begin();
+  auto A_data      = A._values._begin();
+  auto lda         = A._values._leading_dimension;
+  auto X_data      = X._begin();
+  auto ldx         = X._leading_dimension;
+  auto Y_data      = Y._begin();
+  auto ldy         = Y._leading_dimension;
+
+  for (I_t col = 0; col < X.cols(); ++col) {
+
+    auto x = X_data + col * ldx;
+    auto y = Y_data + col * ldy;
+
+    for (I_t block_start = 0; block_start < rows; block_start += block_size) {
+
+      auto block_end = std::min(block_start + block_size, rows);
+
+      if (beta == cast<T>(0.0)) {
+        for (I_t i = block_start; i < block_end; ++i) y[i] = cast<T>(0.0);
+      } else if (beta != cast<T>(1.0)) {
+        for (I_t i = block_start; i < block_end; ++i) y[i] *= beta;
+      }
+
+      for (I_t d = 0; d < n_diagonals; ++d) {
+
+        auto offset = offsets[d];
+        auto a      = A_data + d * lda;
+
+        // Restrict to the rows for which column i + offset is in the matrix
+        auto start = std::max(block_start, -offset);
+        auto end   = std::min(block_end, cols - offset);
+
+        for (I_t i = start; i < end; ++i) {
+          y[i] += alpha * a[i] * x[i + offset];
+        }
+
+      }
+
+    }
+
+  }
+
+}
+/** \overload
+ */
+template <typename T>
+inline void multiply(const DIA<T>& A, const Dense<T>& X, Dense<T>& Y) {
+  multiply(cast<T>(1.0), A, X, cast<T>(0.0), Y);
+}
+
 } /* namespace LinAlg */
 
 #endif /* LINALG_ABSTRACT_MULTIPLY_H_ */
@@ -43,6 +43,7 @@
 #include "../LAPACK/lapack.h"  // same for LAPACK
 #include "../dense.h"
 #include "../sparse.h"
+#include "../banded.h"
 
 namespace LinAlg {
 
@@ -115,6 +116,29 @@ inline void solve(Dense<T>& A, Dense<I_t>& pivot, Dense<T>& B) {
 
 }
 
+/** \brief            Solve a linear system with a general banded matrix
+ *
+ *  A * X = B     (B is overwritten with X, A with its own LU decomposition)
+ *
+ *  \param[in,out]    A
+ *
+ *  \param[in,out]    B
+ *
+ *  \note             Like solve(Dense<T>& A, Dense<T>& B) this allocates the
+ *                    pivoting vector internally. Call xGBTRF() once and
+ *                    xGBTRS() multiple times to reuse the factorization.
+ */
+template <typename T>
+inline void solve(Banded<T>& A, Dense<T>& B) {
+
+  PROFILING_FUNCTION_HEADER
+
+  Dense<int> pivot(A.rows(), 1, Location::host, 0);
+  LAPACK::xGBTRF(A, pivot);
+  LAPACK::xGBTRS(A, pivot, B);
+
+}
+
 } /* namespace LinAlg */
 
 #endif /* LINALG_ABSTRACT_SOLVE_H_ */
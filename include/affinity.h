@@ -0,0 +1,258 @@
+/** \file
+ *
+ *  \brief            Thread placement policies (cores, core sets, NUMA nodes)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_AFFINITY_H_
+#define LINALG_AFFINITY_H_
+
+#include <string>     // std::string, std::to_string
+#include <vector>     // std::vector
+#include <fstream>    // std::ifstream
+#include <sstream>    // std::istringstream
+#include <algorithm>  // std::sort, std::unique
+#include <cstdlib>    // std::getenv
+
+#include "preprocessor.h"
+#include "types.h"
+#include "exceptions.h"
+
+namespace LinAlg {
+
+namespace Threads {
+
+/** \brief            Parse a Linux style CPU list (e.g. "0-3,8,10-11")
+ *
+ *  \param[in]        list
+ *                    The CPU list.
+ *
+ *  \returns          Sorted list of CPU ids without duplicates.
+ */
+inline std::vector<int> parse_cpu_list(const std::string& list) {
+
+  std::vector<int> cpus;
+  std::istringstream ranges(list);
+  std::string range;
+
+  while (std::getline(ranges, range, ',')) {
+
+    if (range.find_first_not_of(" \t\n") == std::string::npos) continue;
+
+    int first, last;
+    char dash;
+    std::istringstream parser(range);
+    if (!(parser >> first)) {
+#ifndef LINALG_NO_CHECKS
+      throw excBadArgument("parse_cpu_list(): invalid CPU list '%s'",
+                           list.c_str());
+#else
+      continue;
+#endif
+    }
+    last = first;
+    if (parser >> dash) {
+      if (dash != '-' || !(parser >> last) || last < first) {
+#ifndef LINALG_NO_CHECKS
+        throw excBadArgument("parse_cpu_list(): invalid CPU list '%s'",
+                             list.c_str());
+#else
+        continue;
+#endif
+      }
+    }
+
+    for (int cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+
+  }
+
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+
+  return cpus;
+
+}
+
+/** \brief            Format a list of CPU ids as a CPU list (inverse of
+ *                    parse_cpu_list())
+ */
+inline std::string format_cpu_list(const std::vector<int>& cpus) {
+
+  std::string list;
+
+  for (std::size_t i = 0; i < cpus.size(); ) {
+    auto j = i;
+    while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1) ++j;
+    if (!list.empty()) list += ",";
+    list += std::to_string(cpus[i]);
+    if (j > i) list += "-" + std::to_string(cpus[j]);
+    i = j + 1;
+  }
+
+  return list;
+
+}
+
+/** \brief            Where the workers executing a Stream may run
+ *
+ *  Policies are either constructed with the static member functions or
+ *  parsed from a string (see parse()), which is also how the default for
+ *  all streams is read from the environment variable LINALG_STREAM_AFFINITY.
+ *
+ *  \example
+ *    stream.set_affinity(Threads::Affinity::numa_node(1));
+ *    stream.set_affinity(Threads::Affinity::parse("cores:0-3,8"));
+ *
+ *    $ LINALG_STREAM_AFFINITY=numa:0 ./application
+ */
+struct Affinity {
+
+  enum class Kind { none, core, cores, numa_node };
+
+  Affinity() : kind(Kind::none), node(-1) {}
+
+  static inline Affinity none() { return Affinity(); }
+  static inline Affinity core(int cpu);
+  static inline Affinity cores(std::vector<int> cpus);
+  static inline Affinity numa_node(int node);
+  static inline Affinity parse(const std::string& policy);
+  static inline Affinity from_environment();
+
+  inline std::vector<int> cpus() const;
+  inline std::string      to_string() const;
+
+  Kind             kind;
+  std::vector<int> cpu_list;
+  int              node;
+
+};
+
+/** \brief            Pin to a single core
+ */
+inline Affinity Affinity::core(int cpu) {
+  Affinity affinity;
+  affinity.kind     = Kind::core;
+  affinity.cpu_list = {cpu};
+  return affinity;
+}
+
+/** \brief            Spread over a set of cores (one worker per core)
+ */
+inline Affinity Affinity::cores(std::vector<int> cpus) {
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+  Affinity affinity;
+  affinity.kind     = Kind::cores;
+  affinity.cpu_list = cpus;
+  return affinity;
+}
+
+/** \brief            Spread over the cores of a NUMA node (one worker per
+ *                    core)
+ */
+inline Affinity Affinity::numa_node(int node) {
+  Affinity affinity;
+  affinity.kind = Kind::numa_node;
+  affinity.node = node;
+  return affinity;
+}
+
+/** \brief            Parse a policy
+ *
+ *  \param[in]        policy
+ *                    One of "none" (or empty), "core:<cpu>",
+ *                    "cores:<cpu list>" (e.g. "cores:0-3,8") or
+ *                    "numa:<node>".
+ *
+ *  \note             Invalid policies throw excBadArgument, with
+ *                    LINALG_NO_CHECKS they are treated as "none".
+ */
+inline Affinity Affinity::parse(const std::string& policy) {
+
+  if (policy.empty() || policy == "none") return none();
+
+  auto colon = policy.find(':');
+  auto kind  = policy.substr(0, colon);
+  auto value = (colon == std::string::npos) ? std::string()
+                                            : policy.substr(colon + 1);
+
+  if (kind == "core" || kind == "cores") {
+    auto cpus = parse_cpu_list(value);
+    if (kind == "core" && cpus.size() == 1) return core(cpus[0]);
+    if (kind == "cores" && !cpus.empty())   return cores(cpus);
+  } else if (kind == "numa") {
+    std::istringstream parser(value);
+    int node;
+    if (parser >> node && node >= 0) return numa_node(node);
+  }
+
+#ifndef LINALG_NO_CHECKS
+  throw excBadArgument("Affinity::parse(): invalid affinity policy '%s' "
+                       "(expected none, core:<cpu>, cores:<cpu list> or "
+                       "numa:<node>)", policy.c_str());
+#else
+  return none();
+#endif
+
+}
+
+/** \brief            The policy given by LINALG_STREAM_AFFINITY (none if
+ *                    not set)
+ */
+inline Affinity Affinity::from_environment() {
+
+  static const Affinity environment_affinity = []() {
+    auto setting = std::getenv("LINALG_STREAM_AFFINITY");
+    return (setting != nullptr) ? parse(setting) : none();
+  }();
+
+  return environment_affinity;
+
+}
+
+/** \brief            The CPUs the policy allows (empty for none)
+ *
+ *  For NUMA nodes this reads the node's CPU list from sysfs.
+ */
+inline std::vector<int> Affinity::cpus() const {
+
+  if (kind != Kind::numa_node) return cpu_list;
+
+  auto path = "/sys/devices/system/node/node" + std::to_string(node) +
+              "/cpulist";
+  std::ifstream file(path);
+  std::string list;
+  if (!file || !std::getline(file, list)) {
+#ifndef LINALG_NO_CHECKS
+    throw excSystemError("Affinity::cpus(): unable to read %s (no NUMA node "
+                         "%d?)", path.c_str(), node);
+#else
+    return std::vector<int>();
+#endif
+  }
+
+  return parse_cpu_list(list);
+
+}
+
+/** \brief            The policy in the format accepted by parse()
+ */
+inline std::string Affinity::to_string() const {
+  switch (kind) {
+    case Kind::core:      return "core:" + std::to_string(cpu_list[0]);
+    case Kind::cores:     return "cores:" + format_cpu_list(cpu_list);
+    case Kind::numa_node: return "numa:" + std::to_string(node);
+    default:              return "none";
+  }
+}
+
+} /* namespace LinAlg::Threads */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_AFFINITY_H_ */
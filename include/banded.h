@@ -0,0 +1,107 @@
+/** \file
+ *
+ *  \brief            General banded matrix struct (Banded<T>)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_BANDED_H_
+#define LINALG_BANDED_H_
+
+#include "preprocessor.h"
+#include "types.h"
+#include "profiling.h"
+#include "exceptions.h"
+#include "dense.h"
+
+namespace LinAlg {
+
+/** \brief            General banded matrix in LAPACK GB storage
+ *
+ *  A square n x n matrix with kl sub- and ku superdiagonals is stored in a
+ *  column major Dense<T> with 2 * kl + ku + 1 rows and n columns. Element
+ *  A(i, j) is stored at _values(kl + ku + i - j, j). The first kl rows are
+ *  workspace for the fill-in created by xGBTRF and need not be set by the
+ *  user. This is exactly the layout expected by xGBTRF/xGBTRS (see
+ *  LAPACK/gbtrf.h and LAPACK/gbtrs.h), so no copies are required.
+ *
+ *  \note             Banded<T> matrices are always in main memory.
+ */
+template <typename T>
+struct Banded {
+
+  /// Construct empty
+  Banded() : _n(0), _kl(0), _ku(0) {}
+
+  /** \brief          Construct by allocating memory (the values are not
+   *                  initialized)
+   *
+   *  \param[in]      n
+   *                  Number of rows and columns of the matrix.
+   *
+   *  \param[in]      kl
+   *                  Number of subdiagonals.
+   *
+   *  \param[in]      ku
+   *                  Number of superdiagonals.
+   */
+  Banded(I_t n, I_t kl, I_t ku)
+    : _n(n),
+      _kl(kl),
+      _ku(ku),
+      _values(2 * kl + ku + 1, n) {}
+
+  /** \brief          Allocate new memory (no memory is copied)
+   *
+   *  \param[in]      n
+   *                  Number of rows and columns of the matrix.
+   *
+   *  \param[in]      kl
+   *                  Number of subdiagonals.
+   *
+   *  \param[in]      ku
+   *                  Number of superdiagonals.
+   */
+  inline void reallocate(I_t n, I_t kl, I_t ku) {
+    _n  = n;
+    _kl = kl;
+    _ku = ku;
+    _values.reallocate(2 * kl + ku + 1, n);
+  }
+
+  /// Return the number of rows in the matrix
+  inline I_t rows() const { return _n; }
+  /// Return the number of columns in the matrix
+  inline I_t cols() const { return _n; }
+  /// Return the number of subdiagonals
+  inline I_t kl() const { return _kl; }
+  /// Return the number of superdiagonals
+  inline I_t ku() const { return _ku; }
+  /// Returns true if matrix is empty
+  inline bool is_empty() const { return (_n == 0); }
+
+  /// Return a pointer to the storage of element A(i, j) (C-style indexing,
+  /// no check whether (i, j) is within the band)
+  inline T* _element(I_t i, I_t j) const {
+    return _values._begin() + j * _values._leading_dimension +
+           (_kl + _ku + i - j);
+  }
+
+#ifndef DOXYGEN_SKIP
+  I_t      _n;
+  I_t      _kl;
+  I_t      _ku;
+
+  // LAPACK GB storage including the kl rows required for the fill-in
+  Dense<T> _values;
+#endif /* DOXYGEN_SKIP */
+
+};
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_BANDED_H_ */
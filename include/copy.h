@@ -14,6 +14,7 @@
 
 #include <tuple>
 #include <cassert>
+#include <utility>      // std::move
 
 #include "preprocessor.h"
 
@@ -624,7 +625,7 @@ I_t copy_async(const Sparse<T>& source, Dense<T>& destination,
         // modify the arguments anymore
         auto task = [=]() mutable { copy(source, destination); };
 
-        ticket = stream.add(task);
+        ticket = stream.add(std::move(task));
 
       }
 
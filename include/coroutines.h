@@ -0,0 +1,357 @@
+/** \file
+ *
+ *  \brief            C++20 coroutine support for Streams (awaiting tickets,
+ *                    events and futures, coroutines on the executor)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_COROUTINES_H_
+#define LINALG_COROUTINES_H_
+
+#include "preprocessor.h"
+
+// Only available when compiling as C++20 (or later) with coroutine support
+#if __cplusplus >= 202002L && defined(__cpp_impl_coroutine)
+
+#include <coroutine>  // std::coroutine_handle, std::suspend_always
+#include <atomic>     // std::atomic
+#include <cstdint>    // std::uintptr_t
+#include <exception>  // std::exception_ptr
+#include <utility>    // std::move, std::exchange
+#include <optional>   // std::optional
+
+#include "types.h"
+#include "profiling.h"
+#include "threads.h"
+#include "executor.h"
+#include "streams.h"
+
+namespace LinAlg {
+
+namespace Coroutines {
+
+#ifndef DOXYGEN_SKIP
+// Executor job that resumes a coroutine
+inline void resume_job(void* address) {
+  std::coroutine_handle<>::from_address(address).resume();
+}
+#endif
+
+/** \brief            Awaiter for an Event: suspends the coroutine until the
+ *                    event completed and resumes it on the executor of the
+ *                    event's stream
+ *
+ *  While suspended, the coroutine doesn't occupy a thread. It is resumed 
+ *  with the priority of the event's stream. Events of streams that are not 
+ *  attached to the executor (and ticket 0, which refers to the CUDA/MPI sub 
+ *  streams) are synchronized with in the awaiting thread.
+ */
+struct EventAwaiter {
+
+  Event event;
+
+  bool await_ready() {
+    if (event.stream == nullptr) return true;
+    auto& stream = *event.stream;
+    if (event.ticket == 0 || stream.synchronous || !stream.thread_alive) {
+      stream.sync(event.ticket);
+      return true;
+    }
+    return event.done();
+  }
+
+  void await_suspend(std::coroutine_handle<> coroutine) {
+    auto& stream = *event.stream;
+    stream.notify_when_done(event.ticket, *stream.executor,
+                            {&resume_job, coroutine.address()},
+                            stream.priority);
+  }
+
+  void await_resume() {}
+
+};
+
+/** \brief            Awaiter for a Future, co_await yields the result
+ */
+template <typename R>
+struct FutureAwaiter {
+
+  Future<R>    future;
+  EventAwaiter waiting;
+
+  bool await_ready() { return waiting.await_ready(); }
+  void await_suspend(std::coroutine_handle<> coroutine) {
+    waiting.await_suspend(coroutine);
+  }
+  R    await_resume() { return future.get(); }
+
+};
+
+/** \brief            Await a ticket of a stream
+ *
+ *  \param[in]        stream
+ *                    Stream the ticket belongs to.
+ *
+ *  \param[in]        ticket
+ *                    Ticket as returned by the _async() routines or
+ *                    Stream::add().
+ *
+ *  \example
+ *    co_await on(stream, BLAS::xGEMM_async(1.0, A, B, 0.0, C, stream));
+ */
+inline EventAwaiter on(Stream& stream, I_t ticket) {
+  return EventAwaiter{Event(stream, ticket)};
+}
+
+/** \brief            Awaiter that moves the coroutine onto an executor
+ *
+ *  \example
+ *    co_await schedule(Threads::Executor::global());
+ */
+struct ScheduleAwaiter {
+
+  Threads::Executor& executor;
+
+  bool await_ready() { return executor.current_worker() >= 0; }
+  void await_suspend(std::coroutine_handle<> coroutine) {
+    executor.submit({&resume_job, coroutine.address()});
+  }
+  void await_resume() {}
+
+};
+
+/** \brief            Continue the coroutine on a worker of the executor
+ *                    (no-op if already running on one)
+ */
+inline ScheduleAwaiter schedule(Threads::Executor& executor =
+                                            Threads::Executor::global()) {
+  return ScheduleAwaiter{executor};
+}
+
+/** \brief            Coroutine type for asynchronous LinAlg code
+ *
+ *  Coroutines start suspended. They are started either with spawn() (runs
+ *  on the executor), get() (runs in the calling thread until the first
+ *  suspension) or by co_await-ing them from another coroutine (which then
+ *  continues once the awaited one completed). Dropping a started Coroutine
+ *  waits for its completion.
+ *
+ *  \example
+ *    Coroutines::Coroutine<D_t> step(Stream& s, Dense<D_t>& A, ...) {
+ *      co_await Coroutines::on(s, BLAS::xGEMM_async(1.0, A, B, 0.0, C, s));
+ *      auto info = co_await s.async([&]() { return factorize(C); });
+ *      co_return residual(C);
+ *    }
+ *
+ *    auto first  = step(stream_a, ...);
+ *    auto second = step(stream_b, ...);
+ *    first.spawn(); second.spawn();
+ *    auto r = first.get() + second.get();
+ */
+template <typename R = void>
+struct Coroutine;
+
+#ifndef DOXYGEN_SKIP
+// State shared by all promise types
+struct PromiseBase {
+
+  // 0: running, 1: completed, otherwise the address of the coroutine to
+  // resume on completion
+  std::atomic<std::uintptr_t> state{0};
+  Threads::EventCount         completed;
+  std::exception_ptr          exception;
+  // Set by the final suspension once it doesn't touch the frame anymore 
+  // (after notifying 'completed'), the frame may be destroyed only then
+  std::atomic<bool>           finalized{false};
+
+  std::suspend_always initial_suspend() noexcept { return {}; }
+
+  struct FinalAwaiter {
+    bool await_ready() noexcept { return false; }
+    template <typename P>
+    std::coroutine_handle<>
+    await_suspend(std::coroutine_handle<P> coroutine) noexcept {
+      auto& promise = coroutine.promise();
+      auto previous = promise.state.exchange(1);
+      promise.completed.notify_all();
+      promise.finalized.store(true);
+      if (previous > 1) {
+        return std::coroutine_handle<>::from_address(
+                                        reinterpret_cast<void*>(previous));
+      }
+      return std::noop_coroutine();
+    }
+    void await_resume() noexcept {}
+  };
+  FinalAwaiter final_suspend() noexcept { return {}; }
+
+  void unhandled_exception() { exception = std::current_exception(); }
+
+  bool done() const { return state.load() == 1; }
+
+  // Block the calling thread until the coroutine completed and its frame 
+  // may be destroyed
+  void wait() {
+    auto is_done = [this]() { return done(); };
+    if (!Threads::SyncPolicy::adaptive().wait_briefly(is_done)) {
+      // On a worker, a spare thread takes over while we sleep (the 
+      // coroutine might need the worker). Executing jobs here instead could 
+      // nest waits that deadlock.
+      Threads::BlockingRegion blocking;
+      while (!done()) {
+        auto key = completed.prepare_wait();
+        if (done()) {
+          completed.cancel_wait();
+          break;
+        }
+        completed.wait(key);
+      }
+    }
+    // The completing thread is at most a notification away from finishing
+    while (!finalized.load()) Threads::yield();
+  }
+
+};
+
+template <typename R>
+struct Promise : PromiseBase {
+  std::optional<R> value;
+  Coroutine<R> get_return_object();
+  template <typename U>
+  void return_value(U&& result) { value.emplace(std::forward<U>(result)); }
+  R take() {
+    if (exception) std::rethrow_exception(exception);
+    return std::move(*value);
+  }
+};
+
+template <>
+struct Promise<void> : PromiseBase {
+  Coroutine<void> get_return_object();
+  void return_void() {}
+  void take() {
+    if (exception) std::rethrow_exception(exception);
+  }
+};
+#endif
+
+template <typename R>
+struct Coroutine {
+
+  typedef Promise<R> promise_type;
+
+  Coroutine() = default;
+  explicit Coroutine(std::coroutine_handle<promise_type> handle_)
+    : handle(handle_), started(false) {}
+  Coroutine(Coroutine&& other) noexcept
+    : handle(std::exchange(other.handle, nullptr)), started(other.started) {}
+  Coroutine& operator=(Coroutine&& other) noexcept {
+    if (this != &other) {
+      release();
+      handle  = std::exchange(other.handle, nullptr);
+      started = other.started;
+    }
+    return *this;
+  }
+  ~Coroutine() { release(); }
+
+  /// Start the coroutine on a worker of the executor
+  void spawn(Threads::Executor& executor = Threads::Executor::global()) {
+    if (started) return;
+    started = true;
+    executor.submit({&resume_job, handle.address()});
+  }
+
+  /// Whether the coroutine completed
+  bool is_done() const { return handle && handle.promise().done(); }
+
+  /// Wait for completion (starting the coroutine in the calling thread if
+  /// it hasn't been started) and return the result
+  R get() {
+    if (!started) {
+      started = true;
+      handle.resume();
+    }
+    handle.promise().wait();
+    return handle.promise().take();
+  }
+
+  // Awaiting a coroutine from another coroutine
+  struct Awaiter {
+    Coroutine& awaited;
+    bool await_ready() { return awaited.is_done(); }
+    std::coroutine_handle<>
+    await_suspend(std::coroutine_handle<> awaiting) {
+      auto& promise = awaited.handle.promise();
+      auto address  = reinterpret_cast<std::uintptr_t>(awaiting.address());
+      if (!awaited.started) {
+        // Run it right away in this thread, it resumes us when done
+        awaited.started = true;
+        promise.state.store(address);
+        return awaited.handle;
+      }
+      // Already running elsewhere: it resumes us unless it completed
+      // meanwhile
+      std::uintptr_t expected = 0;
+      if (promise.state.compare_exchange_strong(expected, address)) {
+        return std::noop_coroutine();
+      }
+      return awaiting;
+    }
+    R await_resume() { return awaited.handle.promise().take(); }
+  };
+  Awaiter operator co_await() & { return Awaiter{*this}; }
+  Awaiter operator co_await() && { return Awaiter{*this}; }
+
+#ifndef DOXYGEN_SKIP
+  std::coroutine_handle<promise_type> handle;
+  bool                                started = false;
+
+  void release() {
+    if (!handle) return;
+    if (started) handle.promise().wait();
+    handle.destroy();
+    handle = nullptr;
+  }
+#endif
+
+};
+
+#ifndef DOXYGEN_SKIP
+template <typename R>
+inline Coroutine<R> Promise<R>::get_return_object() {
+  return Coroutine<R>(std::coroutine_handle<Promise<R>>::from_promise(*this));
+}
+inline Coroutine<void> Promise<void>::get_return_object() {
+  return Coroutine<void>(
+                  std::coroutine_handle<Promise<void>>::from_promise(*this));
+}
+#endif
+
+} /* namespace LinAlg::Coroutines */
+
+/** \brief            co_await on an event waits for it to complete
+ */
+inline Coroutines::EventAwaiter operator co_await(Event event) {
+  return Coroutines::EventAwaiter{event};
+}
+
+/** \brief            co_await on a future waits for the task and yields its
+ *                    result
+ */
+template <typename R>
+inline Coroutines::FutureAwaiter<R> operator co_await(Future<R> future) {
+  return Coroutines::FutureAwaiter<R>{future,
+                                      Coroutines::EventAwaiter{future.event}};
+}
+
+} /* namespace LinAlg */
+
+#endif /* C++20 coroutines */
+
+#endif /* LINALG_COROUTINES_H_ */
@@ -16,6 +16,7 @@
 #include <iostream>   // std::cout
 #include <iomanip>    // std::setw
 #include <tuple>      // std::tie
+#include <utility>    // std::swap
 #include <cassert>    // assert
 
 #include "preprocessor.h"
@@ -56,7 +57,7 @@ struct Dense : Matrix {
   // neccessary to have a copy in the lambda function and thus we need a copy 
   // constructor ...
   // good thing.
-  Dense(Dense<T>&& other);
+  Dense(Dense<T>&& other) noexcept;
   Dense(Dense<T>& other);
   Dense(const Dense<T>& other);
 #ifndef DOXYGEN_SKIP
@@ -146,6 +147,9 @@ struct Dense : Matrix {
   /// Mark the matrix as transposed
   inline void transpose() { _transposed = !_transposed; }
 
+  // Transpose the memory in place (toggles the transposed flag)
+  inline void transpose_in_place();
+
   /// Return the number of rows in the matrix
   inline I_t rows() const { return (_transposed ? _cols : _rows); }
   /// Return the number of columns in the matrix
@@ -261,7 +265,7 @@ Dense<T>::~Dense() {
 /** \brief              Move constructor
  */
 template <typename T>
-Dense<T>::Dense(Dense<T>&& other) : Dense() {
+Dense<T>::Dense(Dense<T>&& other) noexcept : Dense() {
 
   PROFILING_FUNCTION_HEADER
 
@@ -1205,6 +1209,65 @@ inline void Dense<T>::format(Format new_format) {
 
 }
 
+/** \brief            Transpose the matrix in memory (in-place)
+ *
+ *  Replaces the stored array by its transpose and toggles the transposed
+ *  flag, such that the matrix itself doesn't change. For a matrix marked as
+ *  transposed this turns a view into the physically transposed matrix, which
+ *  all operations accept, without allocating a second matrix.
+ *
+ *  Square matrices are transposed in tiles, rectangular matrices by
+ *  following the cycles of the permutation (m * n bits of additional
+ *  memory).
+ *
+ *  \note             Only supported in main memory and for matrices that
+ *                    don't share their memory with other matrices (clones,
+ *                    submatrices or the matrix they are a submatrix of),
+ *                    which would be left with the dimensions of the array
+ *                    before the transposition. Use a deep copy for those.
+ *                    Rectangular matrices must not be submatrices (the
+ *                    leading dimension must equal the number of rows for
+ *                    ColMajor matrices or columns for RowMajor ones).
+ */
+template <typename T>
+inline void Dense<T>::transpose_in_place() {
+
+  PROFILING_FUNCTION_HEADER
+
+  if (is_empty()) return;
+
+  // Column major view of the array
+  auto m = (_format == Format::ColMajor) ? _rows : _cols;
+  auto n = (_format == Format::ColMajor) ? _cols : _rows;
+
+#ifndef LINALG_NO_CHECKS
+  if (_location != Location::host) {
+    throw excUnimplemented("Dense.transpose_in_place(): only supported for "
+                           "matrices in main memory");
+  }
+  if (_format != Format::ColMajor && _format != Format::RowMajor) {
+    throw excBadArgument("Dense.transpose_in_place(): format must be one of "
+                         "Format::ColMajor and Format::RowMajor");
+  }
+  if (_memory.use_count() > 1) {
+    throw excBadArgument("Dense.transpose_in_place(): can't transpose "
+                         "matrices sharing their memory with other matrices "
+                         "in place");
+  }
+  if (m != n && _leading_dimension != m) {
+    throw excBadArgument("Dense.transpose_in_place(): can't transpose "
+                         "rectangular submatrices in place");
+  }
+#endif
+
+  Utilities::transpose_2Darray_in_place(m, n, _begin(), _leading_dimension);
+
+  if (m != n) _leading_dimension = n;
+  std::swap(_rows, _cols);
+  _transposed = !_transposed;
+
+}
+
 /** \brief            Prints the contents of the matrix to std::cout
  */
 template <typename T>
@@ -0,0 +1,102 @@
+/** \file
+ *
+ *  \brief            Diagonal storage matrix struct (DIA<T>)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_DIA_H_
+#define LINALG_DIA_H_
+
+#include "preprocessor.h"
+#include "types.h"
+#include "profiling.h"
+#include "exceptions.h"
+#include "dense.h"
+
+namespace LinAlg {
+
+/** \brief            Diagonal (DIA) storage for sparse matrices with few
+ *                    occupied diagonals
+ *
+ *  Matrices stemming from finite difference stencils on structured grids
+ *  typically have a handful of (nearly) fully occupied diagonals. DIA stores
+ *  only the offset of each diagonal and its values, no index per element.
+ *
+ *  The values are stored in a column major Dense<T> of size rows x
+ *  n_diagonals. Column d holds the diagonal with offset offsets[d] (0 is the
+ *  main diagonal, positive offsets are above it), element A(i, i + offsets[d])
+ *  is stored in row i. Positions outside of the matrix are padding and are
+ *  ignored.
+ *
+ *  \note             DIA<T> matrices are always in main memory.
+ */
+template <typename T>
+struct DIA {
+
+  /// Construct empty
+  DIA() : _rows(0), _cols(0) {}
+
+  /** \brief          Construct by allocating memory (the values are not
+   *                  initialized)
+   *
+   *  \param[in]      rows
+   *                  Number of rows of the matrix.
+   *
+   *  \param[in]      cols
+   *                  Number of columns of the matrix.
+   *
+   *  \param[in]      n_diagonals
+   *                  Number of stored diagonals.
+   */
+  DIA(I_t rows, I_t cols, I_t n_diagonals)
+    : _rows(rows),
+      _cols(cols),
+      _values(rows, n_diagonals),
+      _offsets(n_diagonals, 1) {}
+
+  /** \brief          Allocate new memory (no memory is copied)
+   *
+   *  \param[in]      rows
+   *                  Number of rows of the matrix.
+   *
+   *  \param[in]      cols
+   *                  Number of columns of the matrix.
+   *
+   *  \param[in]      n_diagonals
+   *                  Number of stored diagonals.
+   */
+  inline void reallocate(I_t rows, I_t cols, I_t n_diagonals) {
+    _rows = rows;
+    _cols = cols;
+    _values.reallocate(rows, n_diagonals);
+    _offsets.reallocate(n_diagonals, 1);
+  }
+
+  /// Return the number of rows in the matrix
+  inline I_t rows() const { return _rows; }
+  /// Return the number of columns in the matrix
+  inline I_t cols() const { return _cols; }
+  /// Return the number of stored diagonals
+  inline I_t n_diagonals() const { return _offsets._rows; }
+  /// Returns true if matrix is empty
+  inline bool is_empty() const { return (_rows == 0 || _cols == 0); }
+
+#ifndef DOXYGEN_SKIP
+  I_t      _rows;
+  I_t      _cols;
+
+  // Diagonal d is _values(:, d), its offset is _offsets(d, 0)
+  Dense<T>   _values;
+  Dense<I_t> _offsets;
+#endif /* DOXYGEN_SKIP */
+
+};
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_DIA_H_ */
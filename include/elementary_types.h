@@ -40,10 +40,11 @@ namespace LinAlg {
  *
  * For either case the following functions are provided:
  *
- *  real() and imag()
+ *  real(), imag() and conj()
  *  operator==()
  *  operator!=()
  *  cast<X>(Y)
+ *  RealType<X>::type, ComplexType<X>::type
  *
  * in the LinAlg namespace (if neccessary).
  */
@@ -161,6 +162,33 @@ namespace LinAlg {
   /** \overload */
   inline I_t imag(I_t z) { return 0; }
 
+  /** \brief          Return the complex conjugate of a number
+   *
+   *  \param          z
+   *                  Number.
+   *
+   *  \returns        Complex conjugate (z itself for real numbers).
+   */
+#ifdef MAGMA_TYPES_H
+  inline S_t conj(S_t z) { return z; }
+  /** \overload */
+  inline D_t conj(D_t z) { return z; }
+  /** \overload */
+  inline C_t conj(C_t z) { return LINALG_MAKE_Ct(real(z), -imag(z)); }
+  /** \overload */
+  inline Z_t conj(Z_t z) { return LINALG_MAKE_Zt(real(z), -imag(z)); }
+#else
+  inline S_t conj(S_t z) { return z; }
+  /** \overload */
+  inline D_t conj(D_t z) { return z; }
+  /** \overload */
+  inline C_t conj(C_t z) { return std::conj(z); }
+  /** \overload */
+  inline Z_t conj(Z_t z) { return std::conj(z); }
+#endif
+  /** \overload */
+  inline I_t conj(I_t z) { return z; }
+
 
 /////////////
 // == and != 
@@ -341,6 +369,32 @@ template <> inline Z_t cast<Z_t>(Z_t v) { return v; }
 #endif
 
 
+//////////////////////////////////
+// Associated real and complex types
+
+/** \brief            Real type of the same precision (e.g. for eigenvalues
+ *                    and norms): RealType<Z_t>::type is D_t
+ */
+template <typename T> struct RealType;
+#ifndef DOXYGEN_SKIP
+template <> struct RealType<S_t> { typedef S_t type; };
+template <> struct RealType<D_t> { typedef D_t type; };
+template <> struct RealType<C_t> { typedef S_t type; };
+template <> struct RealType<Z_t> { typedef D_t type; };
+#endif
+
+/** \brief            Complex type of the same precision: ComplexType<D_t>::type
+ *                    is Z_t
+ */
+template <typename T> struct ComplexType;
+#ifndef DOXYGEN_SKIP
+template <> struct ComplexType<S_t> { typedef C_t type; };
+template <> struct ComplexType<D_t> { typedef Z_t type; };
+template <> struct ComplexType<C_t> { typedef C_t type; };
+template <> struct ComplexType<Z_t> { typedef Z_t type; };
+#endif
+
+
 } /* namespace LinAlg */
 
 #ifdef HAVE_MKL
@@ -0,0 +1,825 @@
+/** \file
+ *
+ *  \brief            Work-stealing thread pool shared by the Streams
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_EXECUTOR_H_
+#define LINALG_EXECUTOR_H_
+
+#include <deque>      // std::deque
+#include <vector>     // std::vector
+#include <memory>     // std::unique_ptr
+#include <atomic>     // std::atomic
+#include <cstdlib>    // std::getenv, std::atoi
+#include <map>        // std::map
+#include <string>     // std::string
+#include <functional> // std::function
+#include <exception>  // std::exception_ptr, std::current_exception
+#include <algorithm>  // std::min
+
+#include "preprocessor.h"
+#include "types.h"
+#include "profiling.h"
+#include "exceptions.h"
+#include "threads.h"
+#include "affinity.h"
+
+#ifdef __linux__
+# include <pthread.h> // pthread_setaffinity_np, pthread_getaffinity_np
+# include <sched.h>   // cpu_set_t
+#endif
+
+namespace LinAlg {
+
+namespace Threads {
+
+/** \brief            Unit of work for the Executor
+ *
+ *  Jobs are a plain function pointer and its argument such that moving them
+ *  between the queues is cheap. Streams submit one job per scheduling of
+ *  their queue, the actual tasks stay in the Stream.
+ */
+struct Job {
+  void (*function)(void*);
+  void* argument;
+};
+
+/** \brief            Priority levels of executor jobs
+ *
+ *  Workers always take the highest priority job available, be it in their 
+ *  own deque or in another worker's. Jobs are never interrupted: a job 
+ *  submitted with high priority starts as soon as a worker finished its 
+ *  current job.
+ */
+enum class Priority { low = 0, normal = 1, high = 2 };
+
+/** \brief            Work-stealing thread pool
+ *
+ *  The executor owns one worker per hardware thread (or as many as requested
+ *  through the environment variable LINALG_EXECUTOR_THREADS for the global
+ *  executor). Each worker has its own job deque: jobs submitted from a worker
+ *  go to its own deque, jobs submitted from other threads are distributed
+ *  round robin. Workers process their own deque in FIFO order and steal from
+ *  the back of the other workers' deques when they run out of work. Idle
+ *  workers park on an EventCount, submitting a job wakes exactly one of them
+ *  and costs no system call if none is parked.
+ *
+ *  Each worker has one deque per Priority. Workers look for work priority 
+ *  by priority, highest first: a worker steals a high priority job from 
+ *  another worker before it runs a normal priority job of its own.
+ *
+ *  Executors can be pinned to a set of CPUs, with one worker per CPU (Linux 
+ *  only, elsewhere the workers are not pinned). Streams with an Affinity 
+ *  policy run on the pinned executor for their CPU set, see 
+ *  for_affinity().
+ *
+ *  Workers that have to wait for other jobs (e.g. a task synchronizing with 
+ *  a stream) announce it with a BlockingRegion: a spare thread processes 
+ *  their deque meanwhile, so waits nested to any depth can't starve the 
+ *  executor.
+ */
+struct Executor {
+
+  Executor(int n_workers_ = 0);
+  Executor(const std::vector<int>& cpus);
+  ~Executor();
+
+  inline void submit(Job job, Priority priority = Priority::normal);
+  inline bool run_one();
+  struct Spare;
+  inline Spare* begin_blocking();
+  inline void end_blocking(Spare* spare);
+  inline bool has_jobs_above(Priority priority) const;
+  inline int  n_workers() const { return int(workers.size()); }
+  inline int  current_worker() const;
+
+  static inline Executor& global();
+  static inline Executor& for_affinity(const Affinity& affinity);
+
+  inline std::string placement() const;
+
+#ifndef DOXYGEN_SKIP
+  static const int n_priorities = 3;
+
+  struct Worker {
+    Mutex           lock;
+    std::deque<Job> jobs[n_priorities];
+    Executor*       executor;
+    int             id;
+    int             cpu;
+# ifdef USE_POSIX_THREADS
+    pthread_t       thread;
+# else
+    std::thread     thread;
+# endif
+  };
+
+  std::vector<std::unique_ptr<Worker>> workers;
+
+  // Number of jobs in all deques, in total and per priority
+  std::atomic<I_t>                     queued;
+  std::atomic<I_t>                     queued_at[n_priorities];
+  std::atomic<unsigned>                next_victim;
+  std::atomic<bool>                    terminate;
+
+  EventCount                           parked;
+
+  // Threads taking over the deque of a worker while it is blocked (see 
+  // begin_blocking()). Idle spares wait for their next assignment.
+  struct Spare {
+    Executor*         executor;
+    int               stand_in_for;
+    std::atomic<bool> standing_in;
+# ifdef USE_POSIX_THREADS
+    pthread_t         thread;
+# else
+    std::thread       thread;
+# endif
+  };
+  Mutex                                spare_lock;
+  ConditionVariable                    spare_assigned;
+  std::vector<std::unique_ptr<Spare>>  spares;
+  std::vector<Spare*>                  idle_spares;
+
+  inline void spawn(const std::vector<int>& cpus, int n_workers_);
+  inline bool pop(int id, Job& job);
+  inline bool pop(int id, int level, Job& job);
+  inline void work(int id, const std::atomic<bool>* standing_in);
+  inline void stand_in(Spare& spare);
+  static void* work_wrapper(void* worker) {
+    auto me = static_cast<Worker*>(worker);
+    this_executor() = me->executor;
+    this_worker()   = me->id;
+    me->executor->work(me->id, nullptr);
+    return nullptr;
+  }
+  static void* stand_in_wrapper(void* spare) {
+    auto me = static_cast<Spare*>(spare);
+    me->executor->stand_in(*me);
+    return nullptr;
+  }
+
+  // The executor and worker id of the calling thread (nullptr, -1 for
+  // threads that are not workers)
+  static inline Executor*& this_executor() {
+    static thread_local Executor* executor = nullptr;
+    return executor;
+  }
+  static inline int& this_worker() {
+    static thread_local int id = -1;
+    return id;
+  }
+#endif
+
+};
+
+/** \brief            Constructor, spawns the workers
+ *
+ *  \param[in]        n_workers_
+ *                    OPTIONAL: number of worker threads, <= 0 uses all
+ *                    hardware threads. Default: 0.
+ */
+inline Executor::Executor(int n_workers_)
+  : queued(0), next_victim(0), terminate(false) {
+
+  PROFILING_FUNCTION_HEADER
+
+  for (auto& count : queued_at) count = 0;
+
+  if (n_workers_ <= 0) n_workers_ = hardware_threads();
+
+  spawn(std::vector<int>(), n_workers_);
+
+}
+
+/** \brief            Constructor for an executor pinned to a set of CPUs
+ *
+ *  \param[in]        cpus
+ *                    CPUs to spawn a worker on (each one pinned to its CPU).
+ */
+inline Executor::Executor(const std::vector<int>& cpus)
+  : queued(0), next_victim(0), terminate(false) {
+
+  PROFILING_FUNCTION_HEADER
+
+  for (auto& count : queued_at) count = 0;
+
+#ifndef LINALG_NO_CHECKS
+  if (cpus.empty()) {
+    throw excBadArgument("Executor(cpus): empty CPU set");
+  }
+# ifdef __linux__
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+    for (auto cpu : cpus) {
+      if (cpu < 0 || cpu >= CPU_SETSIZE || !CPU_ISSET(cpu, &allowed)) {
+        throw excBadArgument("Executor(cpus): CPU %d is not available to "
+                             "this process", cpu);
+      }
+    }
+  }
+# endif
+#endif
+
+  spawn(cpus, int(cpus.size()));
+
+}
+
+#ifndef DOXYGEN_SKIP
+inline void Executor::spawn(const std::vector<int>& cpus, int n_workers_) {
+
+  for (int id = 0; id < n_workers_; ++id) {
+    workers.emplace_back(new Worker());
+    workers.back()->executor = this;
+    workers.back()->id       = id;
+    workers.back()->cpu      = cpus.empty() ? -1 : cpus[id];
+  }
+
+  // The destructor doesn't run if a constructor throws: if a thread can't be 
+  // created, the workers started so far are stopped and joined here
+  std::size_t started = 0;
+
+  try {
+
+    for (auto& worker : workers) {
+#ifdef USE_POSIX_THREADS
+      auto error = pthread_create(&worker->thread, NULL,
+                                  &Executor::work_wrapper, worker.get());
+# ifndef LINALG_NO_CHECKS
+      if (error != 0) {
+        throw excSystemError("Executor(): unable to spawn worker thread, "
+                             "error = %d", error);
+      }
+# endif
+      auto handle = worker->thread;
+#else
+      worker->thread = std::thread(&Executor::work_wrapper, worker.get());
+      auto handle = worker->thread.native_handle();
+#endif
+      ++started;
+
+#ifdef __linux__
+      if (worker->cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(worker->cpu, &set);
+        // The CPUs have been checked in the constructor, failing to pin 
+        // only costs locality
+        pthread_setaffinity_np(handle, sizeof(set), &set);
+      }
+#else
+      (void)handle;
+#endif
+    }
+
+  } catch (...) {
+
+    terminate = true;
+    parked.notify_all();
+
+    for (std::size_t i = 0; i < started; ++i) {
+#ifdef USE_POSIX_THREADS
+      pthread_join(workers[i]->thread, NULL);
+#else
+      workers[i]->thread.join();
+#endif
+    }
+
+    throw;
+
+  }
+
+}
+#endif /* DOXYGEN_SKIP */
+
+/** \brief            Destructor, lets the workers finish all queued jobs and
+ *                    joins them
+ */
+inline Executor::~Executor() {
+
+  terminate = true;
+  parked.notify_all();
+  {
+    MutexLock spare_registry_lock(spare_lock);
+    spare_assigned.notify_all();
+  }
+
+  for (auto& worker : workers) {
+#ifdef USE_POSIX_THREADS
+    pthread_join(worker->thread, NULL);
+#else
+    worker->thread.join();
+#endif
+  }
+  for (auto& spare : spares) {
+#ifdef USE_POSIX_THREADS
+    pthread_join(spare->thread, NULL);
+#else
+    spare->thread.join();
+#endif
+  }
+
+}
+
+/** \brief            The executor shared by all Streams
+ *
+ *  Created on first use with LINALG_EXECUTOR_THREADS workers if that
+ *  environment variable is set, one per hardware thread otherwise.
+ */
+inline Executor& Executor::global() {
+
+  static Executor executor([]() {
+    auto setting = std::getenv("LINALG_EXECUTOR_THREADS");
+    return (setting != nullptr) ? std::atoi(setting) : 0;
+  }());
+
+  return executor;
+
+}
+
+/** \brief            The executor for an affinity policy
+ *
+ *  Streams with the same CPU set share one pinned executor, created on first 
+ *  use. Streams without policy use the global executor.
+ */
+inline Executor& Executor::for_affinity(const Affinity& affinity) {
+
+  if (affinity.kind == Affinity::Kind::none) return global();
+
+  static Mutex                                            registry_lock;
+  static std::map<std::vector<int>, std::unique_ptr<Executor>> registry;
+
+  auto cpus = affinity.cpus();
+
+  MutexLock lookup_lock(registry_lock);
+
+  auto& executor = registry[cpus];
+  if (!executor) executor.reset(new Executor(cpus));
+
+  return *executor;
+
+}
+
+/** \brief            Where the workers actually run
+ *
+ *  \returns          One entry per worker with the CPUs it may run on as 
+ *                    reported by the operating system, e.g. 
+ *                    "0:cpus=2 1:cpus=3", or "unpinned" entries where that 
+ *                    information is not available.
+ */
+inline std::string Executor::placement() const {
+
+  std::string description;
+
+  for (auto& worker : workers) {
+
+    if (!description.empty()) description += " ";
+    description += std::to_string(worker->id) + ":";
+
+#ifdef __linux__
+# ifdef USE_POSIX_THREADS
+    auto handle = worker->thread;
+# else
+    auto handle = const_cast<Worker&>(*worker).thread.native_handle();
+# endif
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (pthread_getaffinity_np(handle, sizeof(set), &set) == 0) {
+      std::vector<int> cpus;
+      for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+      }
+      description += "cpus=" + format_cpu_list(cpus);
+      continue;
+    }
+#endif
+    description += "unpinned";
+
+  }
+
+  return description;
+
+}
+
+/** \brief            Index of the calling worker thread
+ *
+ *  \returns          Index of the worker or -1 if the calling thread is not
+ *                    a worker of this executor.
+ */
+inline int Executor::current_worker() const {
+  return (this_executor() == this) ? this_worker() : -1;
+}
+
+/** \brief            Submit a job
+ *
+ *  \param[in]        job
+ *                    Job to execute on one of the workers.
+ *
+ *  \param[in]        priority
+ *                    OPTIONAL: priority of the job. Default: 
+ *                    Priority::normal.
+ */
+inline void Executor::submit(Job job, Priority priority) {
+
+  auto id    = current_worker();
+  auto level = int(priority);
+  if (id < 0) id = int(next_victim++ % workers.size());
+
+  {
+    MutexLock worker_lock(workers[id]->lock);
+    workers[id]->jobs[level].push_back(job);
+  }
+  ++queued_at[level];
+  ++queued;
+
+  parked.notify_one();
+
+}
+
+/** \brief            Whether jobs with a higher priority than the given one 
+ *                    are waiting
+ *
+ *  Long running jobs can use this to yield their worker at a convenient 
+ *  point.
+ */
+inline bool Executor::has_jobs_above(Priority priority) const {
+
+  for (auto level = int(priority) + 1; level < n_priorities; ++level) {
+    if (queued_at[level] > 0) return true;
+  }
+
+  return false;
+
+}
+
+#ifndef DOXYGEN_SKIP
+// Get the highest priority job available
+inline bool Executor::pop(int id, Job& job) {
+
+  for (auto level = n_priorities - 1; level >= 0; --level) {
+    if (queued_at[level] > 0 && pop(id, level, job)) return true;
+  }
+
+  return false;
+
+}
+
+// Get a job of the given priority from the own deque (front) or steal one 
+// from another worker (back)
+inline bool Executor::pop(int id, int level, Job& job) {
+
+  auto n = int(workers.size());
+
+  {
+    auto& own = workers[id]->jobs[level];
+    MutexLock own_lock(workers[id]->lock);
+    if (!own.empty()) {
+      job = own.front();
+      own.pop_front();
+      --queued_at[level];
+      --queued;
+      return true;
+    }
+  }
+
+  for (int k = 1; k < n; ++k) {
+    auto& victim = *workers[(id + k) % n];
+    MutexLock victim_lock(victim.lock);
+    if (!victim.jobs[level].empty()) {
+      job = victim.jobs[level].back();
+      victim.jobs[level].pop_back();
+      --queued_at[level];
+      --queued;
+      return true;
+    }
+  }
+
+  return false;
+
+}
+
+// Process the jobs of worker id, for spares only as long as standing_in is 
+// set
+inline void Executor::work(int id, const std::atomic<bool>* standing_in) {
+
+  Job job;
+
+  while (standing_in == nullptr || *standing_in) {
+
+    if (pop(id, job)) {
+      job.function(job.argument);
+      continue;
+    }
+
+    // Give producers a chance to submit more before paying for parking (and
+    // them for waking us up)
+    if (!terminate) {
+      for (int round = 0; round < 16 && queued <= 0; ++round) yield();
+      if (queued > 0) continue;
+    }
+
+    auto key = parked.prepare_wait();
+    if (queued > 0 || terminate ||
+        (standing_in != nullptr && !*standing_in)) {
+      parked.cancel_wait();
+      if (terminate && queued <= 0) return;
+      continue;
+    }
+    parked.wait(key);
+
+  }
+
+  // The wake up that ended our shift may have been meant for a job
+  if (queued > 0) parked.notify_one();
+
+}
+
+// Main loop of a spare: wait for an assignment, work in place of the 
+// blocked worker until it returns, repeat
+inline void Executor::stand_in(Spare& spare) {
+
+  this_executor() = this;
+
+  while (true) {
+
+    int id;
+    {
+      MutexLock spare_registry_lock(spare_lock);
+      spare_assigned.wait(spare_registry_lock, [this, &spare]() {
+                            return spare.stand_in_for >= 0 || terminate;
+                          });
+      if (spare.stand_in_for < 0) return;
+      id = spare.stand_in_for;
+    }
+
+# ifdef __linux__
+    // Take over the CPU of the worker, it sleeps while we are around
+    if (workers[id]->cpu >= 0) {
+      cpu_set_t set;
+      CPU_ZERO(&set);
+      CPU_SET(workers[id]->cpu, &set);
+      pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+# endif
+
+    this_worker() = id;
+    work(id, &spare.standing_in);
+    this_worker() = -1;
+
+    MutexLock spare_registry_lock(spare_lock);
+    spare.stand_in_for = -1;
+    idle_spares.push_back(&spare);
+
+  }
+
+}
+#endif /* DOXYGEN_SKIP */
+
+/** \brief            Execute one queued job in the calling thread
+ *
+ *  Only safe for callers that don't hold anything the job might wait for. 
+ *  Workers that need to wait should block inside a BlockingRegion instead of 
+ *  executing jobs in a loop: a job that waits itself nests the wait and can 
+ *  deadlock.
+ *
+ *  \returns          True if a job was executed.
+ */
+inline bool Executor::run_one() {
+
+  auto id = current_worker();
+  if (id < 0) id = 0;
+
+  Job job;
+  if (!pop(id, job)) return false;
+
+  job.function(job.argument);
+
+  return true;
+
+}
+
+/** \brief            Announce that the calling worker is about to block
+ *
+ *  A spare thread takes over the worker's deque until end_blocking() such 
+ *  that the executor keeps n_workers() threads executing jobs (the job the 
+ *  worker waits for might be queued behind it). Spares are created on 
+ *  demand and reused.
+ *
+ *  \returns          The spare to pass to end_blocking(), nullptr if the 
+ *                    calling thread is not a worker of this executor or no 
+ *                    spare could be started (the worker then just blocks).
+ */
+inline Executor::Spare* Executor::begin_blocking() {
+
+  auto id = current_worker();
+  if (id < 0 || terminate) return nullptr;
+
+  MutexLock spare_registry_lock(spare_lock);
+
+  Spare* spare;
+
+  if (!idle_spares.empty()) {
+
+    spare = idle_spares.back();
+    idle_spares.pop_back();
+
+  } else {
+
+    try {
+      spares.emplace_back(new Spare());
+    } catch (...) {
+      return nullptr;
+    }
+    spare = spares.back().get();
+    spare->executor     = this;
+    spare->stand_in_for = -1;
+    spare->standing_in  = false;
+
+#ifdef USE_POSIX_THREADS
+    if (pthread_create(&spare->thread, NULL, &Executor::stand_in_wrapper,
+                       spare) != 0) {
+      spares.pop_back();
+      return nullptr;
+    }
+#else
+    try {
+      spare->thread = std::thread(&Executor::stand_in_wrapper, spare);
+    } catch (...) {
+      spares.pop_back();
+      return nullptr;
+    }
+#endif
+
+  }
+
+  spare->standing_in  = true;
+  spare->stand_in_for = id;
+  spare_assigned.notify_all();
+
+  return spare;
+
+}
+
+/** \brief            Announce that the worker that called begin_blocking() 
+ *                    continues
+ *
+ *  The spare finishes the job it is executing and goes idle.
+ *
+ *  \param[in]        spare
+ *                    Return value of begin_blocking().
+ */
+inline void Executor::end_blocking(Spare* spare) {
+
+  if (spare == nullptr) return;
+
+  spare->standing_in = false;
+  parked.notify_all();
+
+}
+
+/** \brief            RAII wrapper for Executor::begin_blocking() and 
+ *                    end_blocking() on the executor of the calling thread
+ *
+ *  Does nothing for threads that are not executor workers.
+ *
+ *  \example
+ *    Threads::BlockingRegion blocking;
+ *    condition_variable.wait(lock, predicate);
+ */
+struct BlockingRegion {
+
+  Executor*        executor;
+  Executor::Spare* spare;
+
+  BlockingRegion() : executor(Executor::this_executor()), spare(nullptr) {
+    if (executor != nullptr) spare = executor->begin_blocking();
+  }
+
+  ~BlockingRegion() {
+    if (executor != nullptr) executor->end_blocking(spare);
+  }
+
+  BlockingRegion(const BlockingRegion&) = delete;
+  BlockingRegion& operator=(const BlockingRegion&) = delete;
+
+};
+
+#ifndef DOXYGEN_SKIP
+// Shared state of a parallel_for(): the ranges are claimed through next by
+// the caller and the executor jobs alike. The jobs hold a reference such
+// that jobs starting after all ranges are done find nothing left to do.
+struct ParallelFor {
+  std::function<void(I_t, I_t)>* body;
+  I_t                            n;
+  int                            n_ranges;
+  std::atomic<int>               next;
+  std::atomic<int>               remaining;
+  EventCount                     finished;
+  Mutex                          lock;
+  std::exception_ptr             exception;
+
+  // Process ranges until none are left to claim
+  inline void run() {
+    for (int range = next++; range < n_ranges; range = next++) {
+      try {
+        (*body)((n * range) / n_ranges, (n * (range + 1)) / n_ranges);
+      } catch (...) {
+        MutexLock exception_lock(lock);
+        if (!exception) exception = std::current_exception();
+      }
+      if (--remaining == 0) finished.notify_all();
+    }
+  }
+
+  static void job(void* state) {
+    std::unique_ptr<std::shared_ptr<ParallelFor>> reference(
+                              static_cast<std::shared_ptr<ParallelFor>*>(state));
+    (*reference)->run();
+  }
+};
+#endif
+
+/** \brief            Fork-join loop over [0, n) with contiguous ranges
+ *
+ *  The ranges are processed by the workers of the global executor and by the
+ *  calling thread, which claims ranges itself instead of waiting for them to
+ *  be picked up. No threads are created, calls from executor jobs (nested
+ *  parallelism) don't oversubscribe the machine and can't deadlock on busy
+ *  workers. If submitting to the executor fails the calling thread processes
+ *  the remaining ranges. Exceptions thrown by the body are rethrown in the
+ *  calling thread after all ranges finished.
+ *
+ *  \param[in]        n
+ *                    Number of loop iterations.
+ *
+ *  \param[in]        body
+ *                    Function called as body(begin, end) for each range.
+ *
+ *  \param[in]        n_threads
+ *                    OPTIONAL: number of ranges (threads working on the
+ *                    loop), <= 0 uses one per worker of the global executor.
+ *                    Default: 0.
+ */
+inline void parallel_for(I_t n, std::function<void(I_t, I_t)> body,
+                         int n_threads = 0) {
+
+  if (n <= 0) return;
+
+  if (n_threads <= 0) n_threads = Executor::global().n_workers();
+  n_threads = int(std::min(I_t(n_threads), n));
+
+  if (n_threads == 1) {
+    body(0, n);
+    return;
+  }
+
+  auto state = std::make_shared<ParallelFor>();
+  state->body      = &body;
+  state->n         = n;
+  state->n_ranges  = n_threads;
+  state->next      = 0;
+  state->remaining = n_threads;
+
+  auto& executor = Executor::global();
+  try {
+    for (int t = 1; t < n_threads; ++t) {
+      std::unique_ptr<std::shared_ptr<ParallelFor>> reference(
+                                     new std::shared_ptr<ParallelFor>(state));
+      executor.submit(Job{ &ParallelFor::job, reference.get() });
+      reference.release();
+    }
+  } catch (...) {
+    // Out of memory: the ranges not picked up by a job are processed below
+  }
+
+  state->run();
+
+  // All ranges are claimed, wait for the ones still running on workers
+  auto done = [&state]() { return state->remaining.load() == 0; };
+  if (!SyncPolicy::adaptive().wait_briefly(done)) {
+    while (!done()) {
+      auto key = state->finished.prepare_wait();
+      if (done()) {
+        state->finished.cancel_wait();
+        break;
+      }
+      state->finished.wait(key);
+    }
+  }
+
+  if (state->exception) std::rethrow_exception(state->exception);
+
+}
+
+} /* namespace LinAlg::Threads */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_EXECUTOR_H_ */
@@ -18,9 +18,12 @@
 #include "profiling.h"
 #include "exceptions.h"
 #include "streams.h"
+#include "coroutines.h"
 #include "matrix.h"
 #include "dense.h"
 #include "sparse.h"
+#include "dia.h"
+#include "banded.h"
 #include "copy.h"
 #include "abstract/abstract.h"
 #include "metadata.h"
@@ -38,5 +41,6 @@
 #include "fills.h"
 #include "BLAS/blas.h"
 #include "LAPACK/lapack.h"
+#include "solvers/solvers.h"
 
 #endif /* LINALG_LINALG_H_ */
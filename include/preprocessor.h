@@ -48,6 +48,50 @@
 //
 //    Enable support for intel MKL
 
+// USE_NATIVE_GEMM
+//
+//    Use LinAlg's own packed, cache blocked GEMM (BLAS/native/gemm.h) for 
+//    xGEMM() in main memory instead of the BLAS library's ?gemm (for systems 
+//    where only the reference BLAS is available). Compile with -march=native 
+//    (or at least -mavx2 -mfma) to enable its vectorized micro-kernels. 
+//    Without MKL, real x complex products (multiply() and BLAS::xGEMM()) then 
+//    also use the native kernels (BLAS/native/gemm_mixed.h) instead of 
+//    splitting the complex operand into a work space for two real products 
+//    of the BLAS library.
+
+// LINALG_FIXED_GEMM_MAX
+//
+//    Largest size for which xGEMM() in main memory computes products with 
+//    m, n, k <= LINALG_FIXED_GEMM_MAX with the fully unrolled kernels of 
+//    BLAS/native/gemm_fixed.h instead of calling the BLAS library (at most 
+//    8, 0 disables them). There is one kernel per combination of sizes, so 
+//    the compile time grows with the cube of the limit. Above 3 the kernels 
+//    only beat a tuned BLAS when compiled with -march=native.
+#ifndef LINALG_FIXED_GEMM_MAX
+# define LINALG_FIXED_GEMM_MAX 3
+#endif
+
+// LINALG_UNROLL
+//
+//    Placed before a loop, asks the compiler to unroll it completely (for 
+//    trip counts up to 16). Expands to nothing for compilers without such a 
+//    pragma.
+#if defined(__clang__)
+# define LINALG_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__) && __GNUC__ >= 8
+# define LINALG_UNROLL _Pragma("GCC unroll 16")
+#else
+# define LINALG_UNROLL
+#endif
+
+// LINALG_GEMM3M_THRESHOLD
+//
+//    If defined, xGEMM() in main memory computes C_t and Z_t products whose 
+//    dimensions m, n and k are all at least this large with the 3M method 
+//    (BLAS::xGEMM3M(): MKL's ?gemm3m or BLAS/native/gemm3m.h), which needs 
+//    25% fewer floating point operations but has a larger error in the 
+//    imaginary part. Not defined by default.
+
 // HAVE_MPI
 //
 //    Enable support for Message Passing Interface (MPI)
@@ -63,7 +107,30 @@
 // USE_POSIX_THREADS
 //
 //    Use pthreads instead of C++11 threads (which are faster) for the general 
-//    Stream class
+//    Stream class (i.e. the workers of Threads::Executor)
+
+// LINALG_STREAM_QUEUE_SIZE
+//
+//    Number of tasks that can be queued in a Stream (rounded up to a power of 
+//    two). Adding to a full stream blocks until the stream made progress, 
+//    the queues of streams not attached to the executor grow instead.
+#ifndef LINALG_STREAM_QUEUE_SIZE
+# define LINALG_STREAM_QUEUE_SIZE 1024
+#endif
+
+// LINALG_TASK_INLINE_SIZE
+//
+//    Size in bytes of the inline storage of Threads::Task (the tasks of a 
+//    Stream). Callables with larger captures are stored on the heap.
+#ifndef LINALG_TASK_INLINE_SIZE
+# define LINALG_TASK_INLINE_SIZE 192
+#endif
+
+// Environment variables (read at run time)
+//
+//    LINALG_EXECUTOR_THREADS   number of workers of the global executor
+//    LINALG_STREAM_AFFINITY    default placement of streams: none, 
+//                              core:<cpu>, cores:<cpu list> or numa:<node>
 
 // USE_LOCAL_STREAMS
 //
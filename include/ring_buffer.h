@@ -0,0 +1,308 @@
+/** \file
+ *
+ *  \brief            Bounded lock-free multi-producer single-consumer queue
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_RING_BUFFER_H_
+#define LINALG_RING_BUFFER_H_
+
+#include <vector>     // std::vector
+#include <atomic>     // std::atomic
+#include <cstddef>    // std::size_t
+#include <utility>    // std::move
+
+#include "preprocessor.h"
+#include "types.h"
+
+namespace LinAlg {
+
+namespace Threads {
+
+/** \brief            Bounded lock-free FIFO for many producers and one
+ *                    consumer
+ *
+ *  Each slot carries a sequence number that tells whether it is free for the
+ *  producer claiming position p (sequence == p) or holds the element for
+ *  the consumer at position p (sequence == p + 1). Producers claim positions
+ *  with a compare-and-swap on the tail, the consumer advances the head
+ *  without atomic read-modify-write operations. Positions are never reused,
+ *  so they double as sequence numbers of the pushed elements (Stream uses
+ *  them for its tickets).
+ *
+ *  An element is visible to the consumer only once its producer finished
+ *  writing it: a consumer may see the queue as empty while a push is in
+ *  progress. Producers that need the consumer to pick up their element must
+ *  therefore signal it after push() returns.
+ *
+ *  The slots are allocated by the first reserve(), which also grows the 
+ *  queue. reserve() must not run concurrently with any other member 
+ *  function. Until then the queue is both empty and full.
+ */
+template <typename T>
+struct RingBuffer {
+
+  RingBuffer(std::size_t capacity_);
+
+  inline bool push(T&& element, std::size_t& position);
+  inline bool push(const T& element, std::size_t& position);
+  template <typename Fill>
+  inline bool push_n(std::size_t n, Fill&& fill, std::size_t& position);
+  inline bool pop(T& element, std::size_t& position);
+  inline bool empty() const;
+  inline void reserve(std::size_t n);
+
+  /// Number of positions claimed by producers so far
+  inline std::size_t claimed() const { return tail.load(); }
+  /// Number of elements taken by the consumer so far
+  inline std::size_t consumed() const { return head.load(); }
+  /// Number of elements the queue holds (once allocated)
+  inline std::size_t capacity() const { return mask + 1; }
+
+#ifndef DOXYGEN_SKIP
+  struct Slot {
+    std::atomic<std::size_t> sequence;
+    T                        element;
+  };
+
+  std::vector<Slot>        slots;
+  std::size_t              mask;
+
+  // Keep producers and the consumer on separate cache lines
+  alignas(64) std::atomic<std::size_t> tail;
+  alignas(64) std::atomic<std::size_t> head;
+
+  template <typename U>
+  inline bool push_generic(U&& element, std::size_t& position);
+#endif
+
+};
+
+/** \brief            Constructor, doesn't allocate (see reserve())
+ *
+ *  \param[in]        capacity_
+ *                    Minimal number of elements the queue can hold, rounded
+ *                    up to a power of two.
+ */
+template <typename T>
+RingBuffer<T>::RingBuffer(std::size_t capacity_) : tail(0), head(0) {
+
+  std::size_t size = 2;
+  while (size < capacity_) size *= 2;
+
+  mask = size - 1;
+
+}
+
+/** \brief            Allocate the slots or grow the queue such that n more
+ *                    elements fit
+ *
+ *  Grows by powers of two, the elements keep their positions. Must not run 
+ *  concurrently with any other member function.
+ *
+ *  \param[in]        n
+ *                    Number of elements to make room for, 0 only allocates.
+ */
+template <typename T>
+inline void RingBuffer<T>::reserve(std::size_t n) {
+
+  auto first = head.load();
+  auto last  = tail.load();
+
+  auto size = capacity();
+  while (size < last - first + n) size *= 2;
+
+  if (!slots.empty() && size == capacity()) return;
+
+  // Slots of elements hold their position + 1, free slots the position they 
+  // are claimed for next
+  std::vector<Slot> grown(size);
+  for (auto position = first; position < first + size; ++position) {
+    auto& slot = grown[position & (size - 1)];
+    if (position < last) {
+      slot.element = std::move(slots[position & mask].element);
+      slot.sequence.store(position + 1);
+    } else {
+      slot.sequence.store(position);
+    }
+  }
+
+  slots.swap(grown);
+  mask = size - 1;
+
+}
+
+#ifndef DOXYGEN_SKIP
+template <typename T>
+template <typename U>
+inline bool RingBuffer<T>::push_generic(U&& element, std::size_t& position) {
+
+  if (slots.empty()) return false;
+
+  auto current = tail.load(std::memory_order_relaxed);
+
+  while (true) {
+
+    auto& slot     = slots[current & mask];
+    auto sequence  = slot.sequence.load(std::memory_order_acquire);
+    auto lag       = std::ptrdiff_t(sequence) - std::ptrdiff_t(current);
+
+    if (lag == 0) {
+      if (tail.compare_exchange_weak(current, current + 1,
+                                     std::memory_order_relaxed)) {
+        slot.element = std::forward<U>(element);
+        slot.sequence.store(current + 1, std::memory_order_release);
+        position = current;
+        return true;
+      }
+    } else if (lag < 0) {
+      // The slot still holds the element from one lap ago: full
+      return false;
+    } else {
+      current = tail.load(std::memory_order_relaxed);
+    }
+
+  }
+
+}
+#endif
+
+/** \brief            Append an element
+ *
+ *  \param[in]        element
+ *                    Element to append.
+ *
+ *  \param[out]       position
+ *                    Position of the element in the sequence of all elements
+ *                    pushed (starting from 0).
+ *
+ *  \returns          False if the queue is full (the element is not
+ *                    appended in that case).
+ */
+template <typename T>
+inline bool RingBuffer<T>::push(T&& element, std::size_t& position) {
+  return push_generic(std::move(element), position);
+}
+/** \overload
+ */
+template <typename T>
+inline bool RingBuffer<T>::push(const T& element, std::size_t& position) {
+  return push_generic(element, position);
+}
+
+/** \brief            Append n elements at consecutive positions
+ *
+ *  All n positions are claimed with a single compare-and-swap, so no other 
+ *  producer's element ends up in between. The consumer may start taking the 
+ *  first elements while the later ones are still being written.
+ *
+ *  \param[in]        n
+ *                    Number of elements, at least 1 and at most capacity().
+ *
+ *  \param[in]        fill
+ *                    Callable fill(T& slot, std::size_t i) that writes the 
+ *                    i-th element into its slot.
+ *
+ *  \param[out]       position
+ *                    Position of the first element.
+ *
+ *  \returns          False if there is no space for all n elements (none is 
+ *                    appended in that case).
+ */
+template <typename T>
+template <typename Fill>
+inline bool RingBuffer<T>::push_n(std::size_t n, Fill&& fill,
+                                  std::size_t& position) {
+
+  if (slots.empty()) return false;
+
+  auto current = tail.load(std::memory_order_relaxed);
+
+  while (true) {
+
+    // The consumer frees slots in order: if the slot for the last position 
+    // is free, so are all before it
+    auto last      = current + n - 1;
+    auto& slot     = slots[last & mask];
+    auto sequence  = slot.sequence.load(std::memory_order_acquire);
+    auto lag       = std::ptrdiff_t(sequence) - std::ptrdiff_t(last);
+
+    if (lag == 0) {
+      if (tail.compare_exchange_weak(current, current + n,
+                                     std::memory_order_relaxed)) {
+        for (std::size_t i = 0; i < n; ++i) {
+          auto& target = slots[(current + i) & mask];
+          fill(target.element, i);
+          target.sequence.store(current + i + 1, std::memory_order_release);
+        }
+        position = current;
+        return true;
+      }
+    } else if (lag < 0) {
+      return false;
+    } else {
+      current = tail.load(std::memory_order_relaxed);
+    }
+
+  }
+
+}
+
+/** \brief            Remove the oldest element (only one thread may call
+ *                    this at any time)
+ *
+ *  \param[out]       element
+ *                    The element.
+ *
+ *  \param[out]       position
+ *                    Position of the element in the sequence of all elements
+ *                    pushed.
+ *
+ *  \returns          False if no element is available.
+ */
+template <typename T>
+inline bool RingBuffer<T>::pop(T& element, std::size_t& position) {
+
+  if (slots.empty()) return false;
+
+  auto current  = head.load(std::memory_order_relaxed);
+  auto& slot    = slots[current & mask];
+
+  if (slot.sequence.load(std::memory_order_acquire) != current + 1) {
+    return false;
+  }
+
+  element = std::move(slot.element);
+  slot.element = T();
+  head.store(current + 1, std::memory_order_relaxed);
+  slot.sequence.store(current + mask + 1, std::memory_order_release);
+  position = current;
+
+  return true;
+
+}
+
+/** \brief            Whether the consumer would find no element
+ */
+template <typename T>
+inline bool RingBuffer<T>::empty() const {
+
+  if (slots.empty()) return true;
+
+  auto current = head.load(std::memory_order_relaxed);
+
+  return slots[current & mask].sequence.load(std::memory_order_acquire) !=
+         current + 1;
+
+}
+
+} /* namespace LinAlg::Threads */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_RING_BUFFER_H_ */
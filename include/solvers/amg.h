@@ -0,0 +1,707 @@
+/** \file
+ *
+ *  \brief            Smoothed aggregation algebraic multigrid (AMG)
+ *
+ *  Organization of the namespace:
+ *
+ *    LinAlg::Solvers
+ *        iterative solvers and preconditioners built on the LinAlg types
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_SOLVERS_AMG_H_
+#define LINALG_SOLVERS_AMG_H_
+
+#include <vector>     // std::vector
+#include <algorithm>  // std::copy, std::min
+#include <cmath>      // std::sqrt
+#include <functional> // std::function
+
+#include "../preprocessor.h"
+#include "../types.h"
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../executor.h"
+#include "../dense.h"
+#include "../sparse.h"
+#include "../fills.h"
+#include "../utilities/checks.h"
+#include "../utilities/format_convert.h"
+#include "../BLAS/native/csrmm.h"
+#include "../BLAS/native/csrgemm.h"
+#include "../LAPACK/getrf.h"
+#include "../LAPACK/getrs.h"
+
+namespace LinAlg {
+
+namespace Solvers {
+
+/** \brief            Smoothers available for the AMG V-cycle
+ */
+enum class AMGSmoother { Jacobi, Chebyshev };
+
+/** \brief            Smoothed aggregation AMG hierarchy for Hermitian
+ *                    positive definite matrices in main memory
+ *
+ *  Setup: strength graph (|a_ij| >= theta * sqrt(|a_ii * a_jj|)), greedy
+ *  aggregation, tentative prolongator for the constant near null space,
+ *  prolongator smoothing P = (I - omega * D^-1 * A) * P_tentative and
+ *  Galerkin coarse operators A_c = P^H * A * P. The sparse products use the
+ *  split symbolic/numeric CSRGEMM. The coarsest level is factorized once with
+ *  a dense LAPACK::xGETRF and solved with LAPACK::xGETRS in each cycle.
+ *
+ *  If only the values of the matrix change (same pattern), update() reuses
+ *  the aggregates and the patterns of all operators and only redoes the
+ *  numeric phases.
+ *
+ *  Example:
+ *
+ *    Solvers::AMG<D_t> amg;
+ *    amg.setup(A);
+ *    amg.apply(b, x);       // x <- one V-cycle applied to b (preconditioner)
+ *    ...
+ *    amg.update(A_new);     // same pattern, new values
+ */
+template <typename T>
+struct AMG {
+
+  /// Strength of connection threshold theta. Default: 0.08
+  double      strength_threshold;
+  /// Maximal number of levels (including the finest). Default: 10
+  I_t         max_levels;
+  /// Coarsen until the matrix has at most this many rows. Default: 256
+  I_t         max_coarse_size;
+  /// Smoother to use in the V-cycle. Default: AMGSmoother::Jacobi
+  AMGSmoother smoother;
+  /// Smoothing sweeps before and after the coarse grid correction.
+  /// Default: 1, 1
+  I_t         pre_sweeps;
+  I_t         post_sweeps;
+  /// Weight of the damped Jacobi smoother. Default: 2/3
+  double      jacobi_weight;
+  /// Degree of the Chebyshev smoother. Default: 3
+  I_t         chebyshev_degree;
+  /// Number of threads for the smoothers, <= 0 uses all hardware threads.
+  /// Default: 0
+  int         n_threads;
+
+  AMG();
+
+  // Build the hierarchy
+  void setup(const Sparse<T>& A);
+
+  // Recompute the hierarchy for a matrix with the same pattern
+  void update(const Sparse<T>& A);
+
+  // x <- V-cycle(b) starting from x = 0
+  void apply(const Dense<T>& b, Dense<T>& x);
+
+  // One V-cycle using x as initial guess
+  void cycle(const Dense<T>& b, Dense<T>& x);
+
+  /// Number of levels in the hierarchy
+  inline I_t n_levels() const { return I_t(_levels.size()); }
+
+#ifndef DOXYGEN_SKIP
+  struct Level {
+
+    // Operator on this level and its diagonal
+    Sparse<T>        A;
+    I_t              n;
+    std::vector<I_t> diagonal_position;
+    Dense<T>         inverse_diagonal;
+    // Estimate of the spectral radius of D^-1 * A
+    double           rho;
+
+    // Transfer to the next coarser level
+    I_t              n_aggregates;
+    Sparse<T>        P_tentative;
+    Sparse<T>        S;                    // I - omega * D^-1 * A
+    Sparse<T>        P;
+    Sparse<T>        R;                    // P^H
+    std::vector<I_t> R_source;
+    Sparse<T>        AP;
+
+    // Vectors: right hand side and solution when used as coarse level,
+    // residual and work space
+    Dense<T>         b;
+    Dense<T>         x;
+    Dense<T>         r;
+    Dense<T>         d;
+
+    Level() : n(0), rho(0), n_aggregates(0) {}
+
+  };
+
+  std::vector<Level> _levels;
+
+  // Coarsest level: LU factorization of the dense operator
+  Dense<T>           _coarse_factor;
+  Dense<int>         _coarse_pivot;
+
+  void _setup_diagonal(Level& level);
+  I_t  _aggregate(const Level& level, std::vector<I_t>& aggregate_of) const;
+  void _setup_transfer_numeric(I_t l);
+  void _setup_coarse();
+  void _smooth(Level& level, const Dense<T>& b, Dense<T>& x, I_t sweeps);
+  void _residual(Level& level, const Dense<T>& b, const Dense<T>& x,
+                 Dense<T>& r);
+  void _cycle(I_t l, const Dense<T>& b, Dense<T>& x);
+  void _for_rows(I_t n, std::function<void(I_t, I_t)> body) const;
+#endif /* DOXYGEN_SKIP */
+
+};
+
+/** \brief            Constructor, sets the default parameters
+ */
+template <typename T>
+AMG<T>::AMG()
+  : strength_threshold(0.08),
+    max_levels(10),
+    max_coarse_size(256),
+    smoother(AMGSmoother::Jacobi),
+    pre_sweeps(1),
+    post_sweeps(1),
+    jacobi_weight(2.0 / 3.0),
+    chebyshev_degree(3),
+    n_threads(0) {}
+
+#ifndef DOXYGEN_SKIP
+// Parallel loop over rows, only threaded if there is enough work
+template <typename T>
+inline void AMG<T>::_for_rows(I_t n, std::function<void(I_t, I_t)> body)
+                              const {
+  const I_t min_rows_per_thread = 8192;
+  auto threads = (n_threads <= 0) ? Threads::hardware_threads() : n_threads;
+  threads = int(std::min(I_t(threads), n / min_rows_per_thread + 1));
+  Threads::parallel_for(n, body, threads);
+}
+
+// Locate the diagonal, invert it and estimate the spectral radius of D^-1 * A
+// with a few steps of power iteration
+template <typename T>
+inline void AMG<T>::_setup_diagonal(Level& level) {
+
+  auto& A          = level.A;
+  auto n           = A._size;
+  auto first_index = A._first_index;
+  auto edges       = A._edges.get();
+  auto indices     = A._indices.get();
+  auto values      = A._values.get();
+
+  level.n = n;
+  level.diagonal_position.assign(n, -1);
+  if (level.inverse_diagonal.is_empty()) {
+    level.inverse_diagonal.reallocate(n, 1);
+    level.r.reallocate(n, 1);
+    level.d.reallocate(n, 1);
+  }
+  auto inverse_diagonal = level.inverse_diagonal._begin();
+
+  for (I_t row = 0; row < n; ++row) {
+    for (auto index = edges[row] - first_index;
+         index < edges[row + 1] - first_index; ++index) {
+      if (indices[index] - first_index == row) {
+        level.diagonal_position[row] = index;
+      }
+    }
+#ifndef LINALG_NO_CHECKS
+    if (level.diagonal_position[row] < 0 ||
+        values[level.diagonal_position[row]] == cast<T>(0.0)) {
+      throw excBadArgument("AMG.setup(): matrix has a zero diagonal element "
+                           "in row %d (on level %d)", row,
+                           I_t(&level - _levels.data()));
+    }
+#endif
+    inverse_diagonal[row] = cast<T>(1.0) / values[level.diagonal_position[row]];
+  }
+
+  // Power iteration, using r and d as work space. The start vector is
+  // pseudo random such that the oscillatory modes are well represented
+  const int iterations = 20;
+  auto x = level.r._begin();
+  auto y = level.d._begin();
+  for (I_t row = 0; row < n; ++row) {
+    auto hash = (unsigned(row) * 2654435761u) >> 22;
+    x[row] = cast<T>(double(hash) / 1024.0 - 0.5);
+  }
+
+  double rho = 0;
+  for (int iteration = 0; iteration < iterations; ++iteration) {
+
+    BLAS::NATIVE::xCSRMM(cast<T>(1.0), A, level.r, cast<T>(0.0), level.d,
+                         n_threads);
+
+    double x_norm2 = 0, y_norm2 = 0;
+    for (I_t row = 0; row < n; ++row) {
+      y[row] *= inverse_diagonal[row];
+      x_norm2 += real(x[row] * conj(x[row]));
+      y_norm2 += real(y[row] * conj(y[row]));
+    }
+    rho = std::sqrt(y_norm2 / x_norm2);
+
+    auto scale = cast<T>(1.0 / std::sqrt(y_norm2));
+    for (I_t row = 0; row < n; ++row) x[row] = y[row] * scale;
+
+  }
+
+  level.rho = rho;
+
+}
+
+// Strength graph and greedy aggregation (three passes: root nodes with their
+// strong neighborhoods, attaching remaining nodes to neighboring aggregates,
+// aggregating the rest). Returns the number of aggregates.
+template <typename T>
+inline I_t AMG<T>::_aggregate(const Level& level,
+                              std::vector<I_t>& aggregate_of) const {
+
+  auto& A          = level.A;
+  auto n           = level.n;
+  auto first_index = A._first_index;
+  auto edges       = A._edges.get();
+  auto indices     = A._indices.get();
+  auto values      = A._values.get();
+  auto theta2      = strength_threshold * strength_threshold;
+
+  auto magnitude2 = [](T z) { return double(real(z) * real(z) +
+                                            imag(z) * imag(z)); };
+
+  std::vector<I_t> strong_edges(n + 1, 0);
+  std::vector<I_t> strong_indices;
+  strong_indices.reserve(A._n_nonzeros);
+
+  for (I_t row = 0; row < n; ++row) {
+    auto a_ii = magnitude2(values[level.diagonal_position[row]]);
+    for (auto index = edges[row] - first_index;
+         index < edges[row + 1] - first_index; ++index) {
+      auto col = indices[index] - first_index;
+      if (col == row) continue;
+      auto a_jj = magnitude2(values[level.diagonal_position[col]]);
+      if (magnitude2(values[index]) >= theta2 * std::sqrt(a_ii * a_jj)) {
+        strong_indices.push_back(col);
+      }
+    }
+    strong_edges[row + 1] = I_t(strong_indices.size());
+  }
+
+  aggregate_of.assign(n, -1);
+  I_t n_aggregates = 0;
+
+  // Pass 1: nodes whose strong neighborhood is entirely free become roots
+  for (I_t row = 0; row < n; ++row) {
+    if (aggregate_of[row] >= 0) continue;
+    bool free = true;
+    for (auto s = strong_edges[row]; s < strong_edges[row + 1]; ++s) {
+      if (aggregate_of[strong_indices[s]] >= 0) { free = false; break; }
+    }
+    if (!free) continue;
+    aggregate_of[row] = n_aggregates;
+    for (auto s = strong_edges[row]; s < strong_edges[row + 1]; ++s) {
+      aggregate_of[strong_indices[s]] = n_aggregates;
+    }
+    ++n_aggregates;
+  }
+
+  // Pass 2: attach remaining nodes to an aggregate from pass 1
+  auto pass1 = aggregate_of;
+  for (I_t row = 0; row < n; ++row) {
+    if (aggregate_of[row] >= 0) continue;
+    for (auto s = strong_edges[row]; s < strong_edges[row + 1]; ++s) {
+      if (pass1[strong_indices[s]] >= 0) {
+        aggregate_of[row] = pass1[strong_indices[s]];
+        break;
+      }
+    }
+  }
+
+  // Pass 3: aggregate what is left with its free strong neighbors
+  for (I_t row = 0; row < n; ++row) {
+    if (aggregate_of[row] >= 0) continue;
+    aggregate_of[row] = n_aggregates;
+    for (auto s = strong_edges[row]; s < strong_edges[row + 1]; ++s) {
+      if (aggregate_of[strong_indices[s]] < 0) {
+        aggregate_of[strong_indices[s]] = n_aggregates;
+      }
+    }
+    ++n_aggregates;
+  }
+
+  return n_aggregates;
+
+}
+
+// Numeric part of the setup of the transfer operators from level l to l + 1
+// and of the Galerkin operator on level l + 1. All patterns must exist.
+template <typename T>
+inline void AMG<T>::_setup_transfer_numeric(I_t l) {
+
+  auto& level      = _levels[l];
+  auto& coarse     = _levels[l + 1];
+  auto& A          = level.A;
+  auto n           = level.n;
+  auto first_index = A._first_index;
+  auto edges       = A._edges.get();
+  auto values      = A._values.get();
+  auto S_values    = level.S._values.get();
+  auto inverse_diagonal = level.inverse_diagonal._begin();
+
+  // S = I - omega * D^-1 * A with omega = 4 / (3 * rho(D^-1 * A))
+  auto omega = cast<T>(4.0 / (3.0 * level.rho));
+  for (I_t row = 0; row < n; ++row) {
+    for (auto index = edges[row] - first_index;
+         index < edges[row + 1] - first_index; ++index) {
+      S_values[index] = -omega * inverse_diagonal[row] * values[index];
+    }
+    S_values[level.diagonal_position[row]] += cast<T>(1.0);
+  }
+
+  BLAS::NATIVE::xCSRGEMM_numeric(level.S, level.P_tentative,
+                                 level.n_aggregates, level.P, n_threads);
+
+  auto P_values = level.P._values.get();
+  auto R_values = level.R._values.get();
+  for (I_t k = 0; k < level.R._n_nonzeros; ++k) {
+    R_values[k] = conj(P_values[level.R_source[k]]);
+  }
+
+  BLAS::NATIVE::xCSRGEMM_numeric(A, level.P, level.n_aggregates, level.AP,
+                                 n_threads);
+  BLAS::NATIVE::xCSRGEMM_numeric(level.R, level.AP, level.n_aggregates,
+                                 coarse.A, n_threads);
+
+}
+
+// Dense LU factorization of the coarsest operator
+template <typename T>
+inline void AMG<T>::_setup_coarse() {
+
+  auto& coarsest = _levels.back();
+  auto n         = coarsest.n;
+
+  _coarse_factor.unlink();
+  Utilities::sparse2dense_host(coarsest.A, 0, n, 0, n, _coarse_factor);
+  _coarse_pivot.reallocate(n, 1);
+  LAPACK::xGETRF(_coarse_factor, _coarse_pivot);
+
+  if (coarsest.b.is_empty()) {
+    coarsest.b.reallocate(n, 1);
+    coarsest.x.reallocate(n, 1);
+  }
+
+}
+#endif /* DOXYGEN_SKIP */
+
+/** \brief            Build the AMG hierarchy
+ *
+ *  \param[in]        A
+ *                    Hermitian positive definite matrix in Format::CSR, in
+ *                    main memory, with non-zero diagonal elements. A copy of
+ *                    A is stored.
+ */
+template <typename T>
+void AMG<T>::setup(const Sparse<T>& A) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  Utilities::check_format(Format::CSR, A, "AMG.setup(A), A");
+  Utilities::check_input_transposed(A, "AMG.setup(A), A");
+  if (A._location != Location::host) {
+    throw excUnimplemented("AMG.setup(A): only matrices in main memory are "
+                           "supported");
+  }
+  if (max_levels < 1) {
+    throw excBadArgument("AMG.setup(A): max_levels must be at least 1");
+  }
+#endif
+
+  _levels.clear();
+  _levels.reserve(max_levels);
+  _levels.emplace_back();
+  _levels[0].A.clone_from(A);
+  _levels[0].n = A._size;
+
+  for (I_t l = 0; ; ++l) {
+
+    auto& level = _levels[l];
+
+    if (level.n <= max_coarse_size || l + 1 == max_levels) break;
+
+    _setup_diagonal(level);
+
+    std::vector<I_t> aggregate_of;
+    auto n_aggregates = _aggregate(level, aggregate_of);
+
+    // No progress: treat this level as the coarsest
+    if (n_aggregates >= level.n) break;
+
+    auto n = level.n;
+    level.n_aggregates = n_aggregates;
+
+    // Tentative prolongator (piecewise constant, orthonormal columns)
+    std::vector<I_t> aggregate_size(n_aggregates, 0);
+    for (auto aggregate : aggregate_of) ++aggregate_size[aggregate];
+
+    Sparse<T> P_tentative(n, n, 0);
+    auto P_edges   = P_tentative._edges.get();
+    auto P_indices = P_tentative._indices.get();
+    auto P_values  = P_tentative._values.get();
+    for (I_t row = 0; row < n; ++row) {
+      P_edges[row]   = row;
+      P_indices[row] = aggregate_of[row];
+      P_values[row]  = cast<T>(1.0 /
+                               std::sqrt(double(aggregate_size[
+                                                aggregate_of[row]])));
+    }
+    P_edges[n] = n;
+    swap(P_tentative, level.P_tentative);
+
+    // Smoothing operator S has the pattern of A
+    auto& A = level.A;
+    Sparse<T> S(n, A._n_nonzeros, A._first_index);
+    std::copy(A._edges.get(), A._edges.get() + n + 1, S._edges.get());
+    std::copy(A._indices.get(), A._indices.get() + A._n_nonzeros,
+              S._indices.get());
+    swap(S, level.S);
+
+    // Symbolic phases
+    BLAS::NATIVE::xCSRGEMM_symbolic(level.S, level.P_tentative, n_aggregates,
+                                    level.P, n_threads);
+    Utilities::csr_transpose_host(level.P, n_aggregates, level.R, true,
+                                  &level.R_source);
+    BLAS::NATIVE::xCSRGEMM_symbolic(A, level.P, n_aggregates, level.AP,
+                                    n_threads);
+
+    _levels.emplace_back();
+    auto& coarse = _levels[l + 1];
+    BLAS::NATIVE::xCSRGEMM_symbolic(_levels[l].R, _levels[l].AP,
+                                    n_aggregates, coarse.A, n_threads);
+    coarse.n = n_aggregates;
+    coarse.b.reallocate(n_aggregates, 1);
+    coarse.x.reallocate(n_aggregates, 1);
+
+    _setup_transfer_numeric(l);
+
+  }
+
+  _setup_coarse();
+
+}
+
+/** \brief            Recompute the hierarchy for a matrix with the same
+ *                    sparsity pattern as the one passed to setup()
+ *
+ *  The aggregates and all patterns are reused, only the numeric phases are
+ *  recomputed.
+ *
+ *  \param[in]        A
+ *                    Matrix with the same pattern as used in setup().
+ */
+template <typename T>
+void AMG<T>::update(const Sparse<T>& A) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  if (_levels.empty()) {
+    throw excUserError("AMG.update(A): call setup() first");
+  }
+  if (A._size != _levels[0].A._size ||
+      A._n_nonzeros != _levels[0].A._n_nonzeros ||
+      A._location != Location::host) {
+    throw excBadArgument("AMG.update(A), A: matrix must have the same pattern "
+                         "as the one used in setup()");
+  }
+#endif
+
+  std::copy(A._values.get(), A._values.get() + A._n_nonzeros,
+            _levels[0].A._values.get());
+
+  for (I_t l = 0; l + 1 < n_levels(); ++l) {
+    _setup_diagonal(_levels[l]);
+    _setup_transfer_numeric(l);
+  }
+
+  _setup_coarse();
+
+}
+
+#ifndef DOXYGEN_SKIP
+// r <- b - A * x
+template <typename T>
+inline void AMG<T>::_residual(Level& level, const Dense<T>& b,
+                              const Dense<T>& x, Dense<T>& r) {
+  auto b_ptr = b._begin();
+  auto r_ptr = r._begin();
+  _for_rows(level.n, [&](I_t begin, I_t end) {
+    for (auto row = begin; row < end; ++row) r_ptr[row] = b_ptr[row];
+  });
+  BLAS::NATIVE::xCSRMM(cast<T>(-1.0), level.A, x, cast<T>(1.0), r, n_threads);
+}
+
+// Damped Jacobi or Chebyshev smoothing of A * x = b
+template <typename T>
+inline void AMG<T>::_smooth(Level& level, const Dense<T>& b, Dense<T>& x,
+                            I_t sweeps) {
+
+  auto n                = level.n;
+  auto x_ptr            = x._begin();
+  auto r_ptr            = level.r._begin();
+  auto d_ptr            = level.d._begin();
+  auto inverse_diagonal = level.inverse_diagonal._begin();
+
+  for (I_t sweep = 0; sweep < sweeps; ++sweep) {
+
+    if (smoother == AMGSmoother::Jacobi) {
+
+      auto omega = cast<T>(jacobi_weight);
+      _residual(level, b, x, level.r);
+      _for_rows(n, [&](I_t begin, I_t end) {
+        for (auto row = begin; row < end; ++row) {
+          x_ptr[row] += omega * inverse_diagonal[row] * r_ptr[row];
+        }
+      });
+
+    } else {
+
+      // Chebyshev iteration for D^-1 * A on [rho / 30, 1.1 * rho]
+      auto upper = 1.1 * level.rho;
+      auto lower = level.rho / 30.0;
+      auto theta = (upper + lower) / 2.0;
+      auto delta = (upper - lower) / 2.0;
+      auto sigma = theta / delta;
+      auto rho   = 1.0 / sigma;
+
+      // r = D^-1 * (b - A * x), d = r / theta
+      _residual(level, b, x, level.r);
+      _for_rows(n, [&](I_t begin, I_t end) {
+        for (auto row = begin; row < end; ++row) {
+          r_ptr[row] *= inverse_diagonal[row];
+          d_ptr[row]  = r_ptr[row] * cast<T>(1.0 / theta);
+        }
+      });
+
+      for (I_t k = 0; k < chebyshev_degree; ++k) {
+
+        _for_rows(n, [&](I_t begin, I_t end) {
+          for (auto row = begin; row < end; ++row) x_ptr[row] += d_ptr[row];
+        });
+
+        if (k + 1 == chebyshev_degree) break;
+
+        // r = b - A * x (cheaper to recompute than to keep A * d around)
+        _residual(level, b, x, level.r);
+
+        auto rho_new = 1.0 / (2.0 * sigma - rho);
+        auto c_d     = cast<T>(rho_new * rho);
+        auto c_r     = cast<T>(2.0 * rho_new / delta);
+        _for_rows(n, [&](I_t begin, I_t end) {
+          for (auto row = begin; row < end; ++row) {
+            d_ptr[row] = c_d * d_ptr[row] +
+                         c_r * inverse_diagonal[row] * r_ptr[row];
+          }
+        });
+        rho = rho_new;
+
+      }
+
+    }
+
+  }
+
+}
+
+template <typename T>
+inline void AMG<T>::_cycle(I_t l, const Dense<T>& b, Dense<T>& x) {
+
+  auto& level = _levels[l];
+
+  if (l + 1 == n_levels()) {
+    x.copy_from(b);
+    LAPACK::xGETRS(_coarse_factor, _coarse_pivot, x);
+    return;
+  }
+
+  auto& coarse = _levels[l + 1];
+
+  _smooth(level, b, x, pre_sweeps);
+
+  _residual(level, b, x, level.r);
+  BLAS::NATIVE::xCSRMM(cast<T>(1.0), level.R, level.r, cast<T>(0.0), coarse.b,
+                       n_threads);
+  Fills::zero(coarse.x);
+
+  _cycle(l + 1, coarse.b, coarse.x);
+
+  BLAS::NATIVE::xCSRMM(cast<T>(1.0), level.P, coarse.x, cast<T>(1.0), x,
+                       n_threads);
+
+  _smooth(level, b, x, post_sweeps);
+
+}
+#endif /* DOXYGEN_SKIP */
+
+/** \brief            Apply one V-cycle, using x as initial guess
+ *
+ *  \param[in]        b
+ *                    Right hand side, n x 1.
+ *
+ *  \param[in,out]    x
+ *                    Initial guess on input, improved solution on output,
+ *                    n x 1.
+ */
+template <typename T>
+void AMG<T>::cycle(const Dense<T>& b, Dense<T>& x) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  if (_levels.empty()) {
+    throw excUserError("AMG.cycle(b, x): call setup() first");
+  }
+  Utilities::check_dimensions(_levels[0].n, 1, b, "AMG.cycle(b, x), b");
+  Utilities::check_dimensions(_levels[0].n, 1, x, "AMG.cycle(b, x), x");
+  Utilities::check_input_transposed(b, "AMG.cycle(b, x), b");
+  Utilities::check_output_transposed(x, "AMG.cycle(b, x), x");
+  if (b._location != Location::host || x._location != Location::host) {
+    throw excUnimplemented("AMG.cycle(b, x): only vectors in main memory are "
+                           "supported");
+  }
+#endif
+
+  _cycle(0, b, x);
+
+}
+
+/** \brief            Apply the AMG preconditioner
+ *
+ *  x <- M^-1 * b     (one V-cycle with zero initial guess)
+ *
+ *  \param[in]        b
+ *                    Right hand side, n x 1.
+ *
+ *  \param[out]       x
+ *                    Result, n x 1.
+ */
+template <typename T>
+void AMG<T>::apply(const Dense<T>& b, Dense<T>& x) {
+
+  PROFILING_FUNCTION_HEADER
+
+  if (x.is_empty() && !_levels.empty()) x.reallocate(_levels[0].n, 1);
+  Fills::zero(x);
+  cycle(b, x);
+
+}
+
+} /* namespace LinAlg::Solvers */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_SOLVERS_AMG_H_ */
@@ -0,0 +1,794 @@
+/** \file
+ *
+ *  \brief            Contour integral (FEAST) eigensolver
+ *
+ *  Organization of the namespace:
+ *
+ *    LinAlg::Solvers
+ *        iterative solvers and preconditioners built on the LinAlg types
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_SOLVERS_FEAST_H_
+#define LINALG_SOLVERS_FEAST_H_
+
+#include <vector>     // std::vector
+#include <algorithm>  // std::min, std::max
+#include <cmath>      // std::cos, std::sin, std::sqrt, std::abs, M_PI
+#include <functional> // std::function
+#include <limits>     // std::numeric_limits
+
+#include "../preprocessor.h"
+#include "../types.h"
+#include "../profiling.h"
+#include "../exceptions.h"
+#include "../threads.h"
+#include "../streams.h"
+#include "../dense.h"
+#include "../sparse.h"
+#include "../banded.h"
+#include "../fills.h"
+#include "../utilities/checks.h"
+#include "../BLAS/gemm.h"
+#include "../BLAS/native/csrmm.h"
+#include "../LAPACK/gbtrf.h"
+#include "../LAPACK/gbtrs.h"
+#include "../LAPACK/getrf.h"
+#include "../LAPACK/getrs.h"
+#include "../LAPACK/heev.h"
+
+namespace LinAlg {
+
+namespace Solvers {
+
+/** \brief            Gauss-Legendre quadrature on [-1, 1]
+ *
+ *  \param[in]        n
+ *                    Number of points.
+ *
+ *  \param[out]       nodes
+ *                    Quadrature nodes in ascending order.
+ *
+ *  \param[out]       weights
+ *                    Quadrature weights.
+ */
+inline void gauss_legendre(I_t n, std::vector<double>& nodes,
+                           std::vector<double>& weights) {
+
+  nodes.resize(n);
+  weights.resize(n);
+
+  for (I_t i = 0; i < (n + 1) / 2; ++i) {
+
+    // Newton iteration on P_n starting from the Chebyshev approximation
+    auto x  = std::cos(M_PI * (i + 0.75) / (n + 0.5));
+    double dp = 0;
+    for (int iteration = 0; iteration < 100; ++iteration) {
+      double p0 = 1, p1 = x;
+      for (I_t k = 2; k <= n; ++k) {
+        auto p2 = ((2 * k - 1) * x * p1 - (k - 1) * p0) / k;
+        p0 = p1;
+        p1 = p2;
+      }
+      dp = n * (x * p1 - p0) / (x * x - 1);
+      auto dx = p1 / dp;
+      x -= dx;
+      if (std::abs(dx) < 1e-15) break;
+    }
+
+    nodes[i]             = -x;
+    nodes[n - 1 - i]     = x;
+    weights[i]           = 2 / ((1 - x * x) * dp * dp);
+    weights[n - 1 - i]   = weights[i];
+
+  }
+
+}
+
+/** \brief            FEAST eigensolver for sparse Hermitian (generalized)
+ *                    eigenproblems in main memory
+ *
+ *  Computes the eigenpairs of H * x = lambda * S * x with eigenvalues in
+ *  [e_min, e_max] by subspace iteration with the contour integral filter
+ *
+ *    Q = 1 / (2 pi i) * oint (z S - H)^-1 * S * Y dz
+ *
+ *  over a circle enclosing the interval, followed by a Rayleigh-Ritz step in
+ *  the subspace spanned by Q (projections through BLAS::xGEMM).
+ *
+ *  If m0 exceeds the number of eigenvalues in the interval, the filter maps
+ *  the surplus directions of Y to (numerically) nothing and Q is rank
+ *  deficient. The Rayleigh-Ritz step therefore doesn't factorize
+ *  Q^H * S * Q but S-orthonormalizes Q: two passes that diagonalize the
+ *  Gram matrix (LAPACK::xHEEV), drop the directions with eigenvalues below
+ *  m0 * epsilon of the largest one and rescale the others. The reduced
+ *  problem is then a standard one in that basis. The search subspace of
+ *  the next iteration shrinks to the remaining directions, m0 is an upper
+ *  bound of its size.
+ *
+ *  The shifted solves for the quadrature points are independent and are
+ *  dispatched concurrently over a pool of Streams. Each quadrature point is
+ *  factorized once and the factorization is reused in all subspace
+ *  iterations: as a banded LU if the bandwidth of H and S is small
+ *  compared to n, as a dense LU (n^2 complex elements per point) otherwise.
+ *  Other solvers (sparse direct, iterative) can be plugged in through
+ *  shifted_factorize and shifted_solve. For Hermitian H and S the points on
+ *  the lower half of the contour reuse the factorization of their mirror
+ *  point (conjugate transposed solve, or just the complex conjugate for
+ *  real matrices).
+ *
+ *  Example:
+ *
+ *    Solvers::FEAST<D_t> feast;
+ *    Dense<D_t> lambda, X;
+ *    auto n_found = feast.solve(H, -1.0, 1.0, 40, lambda, X);
+ */
+template <typename T>
+struct FEAST {
+
+  typedef typename RealType<T>::type    real_type;
+  typedef typename ComplexType<T>::type complex_type;
+
+  /// Number of quadrature points on the upper half of the contour.
+  /// Default: 8
+  I_t    n_points;
+  /// Maximal number of subspace iterations. Default: 20
+  I_t    max_iterations;
+  /// Convergence criterion: relative residual of all eigenpairs in the
+  /// interval. Default: 1e-10
+  double tolerance;
+  /// Number of streams for the shifted solves, <= 0 uses
+  /// min(n_points, hardware threads). Default: 0
+  int    n_streams;
+
+  /// Optional replacement of the built-in LU for the shifted solves.
+  /// shifted_factorize(k, z) is called once per quadrature point k = 0 ..
+  /// n_points - 1 before its first solve (if set), shifted_solve(k, trans,
+  /// X) overwrites X with (z_k S - H)^-1 * X for trans = 'N' and with
+  /// (z_k S - H)^-H * X for trans = 'C' (only used for complex T). Both are
+  /// called concurrently for different k and must throw on failure. Default:
+  /// empty (built-in banded or dense LU)
+  std::function<void(I_t, complex_type)>               shifted_factorize;
+  std::function<void(I_t, char, Dense<complex_type>&)> shifted_solve;
+
+  /// Statistics of the last call to solve(): number of iterations, largest
+  /// relative residual of the eigenpairs in the interval and whether the
+  /// residuals reached the tolerance
+  I_t    iterations;
+  double max_residual;
+  bool   converged;
+
+  FEAST();
+
+  // Standard problem H * x = lambda * x
+  I_t solve(const Sparse<T>& H, real_type e_min, real_type e_max, I_t m0,
+            Dense<real_type>& eigenvalues, Dense<T>& eigenvectors);
+
+  // Generalized problem H * x = lambda * S * x
+  I_t solve(const Sparse<T>& H, const Sparse<T>& S, real_type e_min,
+            real_type e_max, I_t m0, Dense<real_type>& eigenvalues,
+            Dense<T>& eigenvectors);
+
+#ifndef DOXYGEN_SKIP
+  // Per quadrature point: LU factorization of z_k * S - H (banded if
+  // _banded_lu, dense otherwise), pivots and the contribution to Q
+  bool                              _banded_lu;
+  I_t                               _kl;
+  I_t                               _ku;
+  std::vector<Banded<complex_type>> _banded;
+  std::vector<Dense<complex_type>>  _factors;
+  std::vector<Dense<int>>           _pivots;
+  std::vector<Dense<T>>             _contributions;
+
+  I_t _solve(const Sparse<T>& H, const Sparse<T>* S, real_type e_min,
+             real_type e_max, I_t m0, Dense<real_type>& eigenvalues,
+             Dense<T>& eigenvectors);
+  void _factorize(I_t k, complex_type z, const Sparse<T>& H,
+                  const Sparse<T>* S);
+  void _shifted_solve(I_t k, char trans, Dense<complex_type>& X);
+  void _quadrature_point(I_t k, complex_type z, complex_type weight,
+                         bool factorize, const Sparse<T>& H,
+                         const Sparse<T>* S, const Dense<T>& SY);
+#endif
+
+};
+
+/** \brief            Constructor, sets the default parameters
+ */
+template <typename T>
+FEAST<T>::FEAST()
+  : n_points(8),
+    max_iterations(20),
+    tolerance(1e-10),
+    n_streams(0),
+    iterations(0),
+    max_residual(0),
+    converged(false),
+    _banded_lu(false),
+    _kl(0),
+    _ku(0) {}
+
+#ifndef DOXYGEN_SKIP
+// Adds alpha * A to element (row, col) of the storage of the built-in LU
+// for z_k * S - H (for all non zeros of A)
+template <typename T, typename U, typename F>
+inline void feast_scatter(const Sparse<T>& A, U alpha, F element) {
+  auto first = A._first_index;
+  auto edges = A._edges.get();
+  for (I_t row = 0; row < A._size; ++row) {
+    for (auto index = edges[row] - first; index < edges[row + 1] - first;
+         ++index) {
+      auto col = A._indices.get()[index] - first;
+      *element(row, col) += alpha * cast<U>(A._values.get()[index]);
+    }
+  }
+}
+
+// LU factorization of z * S - H for quadrature point k
+template <typename T>
+void FEAST<T>::_factorize(I_t k, complex_type z, const Sparse<T>& H,
+                          const Sparse<T>* S) {
+
+  auto n    = H._size;
+  auto& piv = _pivots[k];
+  int  info = 0;
+  piv.reallocate(n, 1);
+
+  if (_banded_lu) {
+
+    auto& F = _banded[k];
+    F.reallocate(n, _kl, _ku);
+    Fills::zero(F._values);
+    auto element = [&F](I_t row, I_t col) { return F._element(row, col); };
+    feast_scatter(H, cast<complex_type>(-1.0), element);
+    if (S == nullptr) {
+      for (I_t row = 0; row < n; ++row) *F._element(row, row) += z;
+    } else {
+      feast_scatter(*S, z, element);
+    }
+    LAPACK::FORTRAN::xGBTRF(n, n, _kl, _ku, F._values._begin(),
+                            F._values._leading_dimension, piv._begin(),
+                            &info);
+
+  } else {
+
+    auto& F = _factors[k];
+    F.reallocate(n, n);
+    Fills::zero(F);
+    auto F_ptr   = F._begin();
+    auto ldf     = F._leading_dimension;
+    auto element = [F_ptr, ldf](I_t row, I_t col) {
+      return F_ptr + col * ldf + row;
+    };
+    feast_scatter(H, cast<complex_type>(-1.0), element);
+    if (S == nullptr) {
+      for (I_t row = 0; row < n; ++row) F_ptr[row * ldf + row] += z;
+    } else {
+      feast_scatter(*S, z, element);
+    }
+    LAPACK::FORTRAN::xGETRF(n, n, F_ptr, ldf, piv._begin(), &info);
+
+  }
+
+  if (info != 0) {
+    throw excMath("FEAST.solve(): factorization of the shifted matrix at "
+                  "z = (%e, %e) failed (info = %d)", real(z), imag(z), info);
+  }
+
+}
+
+// X = (z_k S - H)^-1 * X (trans = 'N') or (z_k S - H)^-H * X (trans = 'C')
+// with the built-in LU of quadrature point k
+template <typename T>
+void FEAST<T>::_shifted_solve(I_t k, char trans, Dense<complex_type>& X) {
+
+  auto n    = X.rows();
+  int  info = 0;
+
+  if (_banded_lu) {
+    auto& F = _banded[k];
+    LAPACK::FORTRAN::xGBTRS(trans, n, _kl, _ku, X.cols(), F._values._begin(),
+                            F._values._leading_dimension, _pivots[k]._begin(),
+                            X._begin(), X._leading_dimension, &info);
+  } else {
+    auto& F = _factors[k];
+    LAPACK::FORTRAN::xGETRS(trans, n, X.cols(), F._begin(),
+                            F._leading_dimension, _pivots[k]._begin(),
+                            X._begin(), X._leading_dimension, &info);
+  }
+
+  if (info != 0) {
+    throw excMath("FEAST.solve(): shifted solve failed (info = %d)", info);
+  }
+
+}
+
+// Task for one quadrature point: (factorize and) solve, then fold the
+// solution into the point's contribution to Q. Runs on a stream's worker,
+// exceptions are rethrown from the task's Future.
+template <typename T>
+void FEAST<T>::_quadrature_point(I_t k, complex_type z, complex_type weight,
+                                 bool factorize, const Sparse<T>& H,
+                                 const Sparse<T>* S, const Dense<T>& SY) {
+
+  auto n  = H._size;
+  auto m  = SY.cols();
+
+  if (factorize) {
+    if (!shifted_solve) {
+      _factorize(k, z, H, S);
+    } else if (shifted_factorize) {
+      shifted_factorize(k, z);
+    }
+  }
+  auto solve = [this, k](char trans, Dense<complex_type>& X) {
+    if (shifted_solve) {
+      shifted_solve(k, trans, X);
+    } else {
+      _shifted_solve(k, trans, X);
+    }
+  };
+
+  // X = (z S - H)^-1 * S * Y
+  Dense<complex_type> X(n, m);
+  auto SY_ptr = SY._begin();
+  auto ldsy   = SY._leading_dimension;
+  auto X_ptr  = X._begin();
+  auto ldx    = X._leading_dimension;
+  for (I_t j = 0; j < m; ++j) {
+    for (I_t i = 0; i < n; ++i) {
+      X_ptr[j * ldx + i] = cast<complex_type>(SY_ptr[j * ldsy + i]);
+    }
+  }
+  solve('N', X);
+
+  auto& Q_k  = _contributions[k];
+  auto Q_ptr = Q_k._begin();
+  auto ldq   = Q_k._leading_dimension;
+
+  if (!SY._is_complex()) {
+
+    // Real matrices: the mirror point contributes the complex conjugate
+    for (I_t j = 0; j < m; ++j) {
+      for (I_t i = 0; i < n; ++i) {
+        Q_ptr[j * ldq + i] = cast<T>(real(weight * X_ptr[j * ldx + i]) * 2);
+      }
+    }
+
+  } else {
+
+    // Mirror point conj(z): (conj(z) S - H) = (z S - H)^H
+    Dense<complex_type> X_mirror(n, m);
+    auto Xm_ptr = X_mirror._begin();
+    auto ldxm   = X_mirror._leading_dimension;
+    for (I_t j = 0; j < m; ++j) {
+      for (I_t i = 0; i < n; ++i) {
+        Xm_ptr[j * ldxm + i] = cast<complex_type>(SY_ptr[j * ldsy + i]);
+      }
+    }
+    solve('C', X_mirror);
+
+    auto weight_mirror = conj(weight);
+    for (I_t j = 0; j < m; ++j) {
+      for (I_t i = 0; i < n; ++i) {
+        Q_ptr[j * ldq + i] = cast<T>(weight * X_ptr[j * ldx + i] +
+                                     weight_mirror * Xm_ptr[j * ldxm + i]);
+      }
+    }
+
+  }
+
+}
+
+template <typename T>
+I_t FEAST<T>::_solve(const Sparse<T>& H, const Sparse<T>* S, real_type e_min,
+                     real_type e_max, I_t m0, Dense<real_type>& eigenvalues,
+                     Dense<T>& eigenvectors) {
+
+  auto n = H._size;
+
+#ifndef LINALG_NO_CHECKS
+  Utilities::check_format(Format::CSR, H, "FEAST.solve(), H");
+  Utilities::check_input_transposed(H, "FEAST.solve(), H");
+  if (H._location != Location::host) {
+    throw excUnimplemented("FEAST.solve(): only matrices in main memory are "
+                           "supported");
+  }
+  if (S != nullptr) {
+    Utilities::check_format(Format::CSR, *S, "FEAST.solve(), S");
+    Utilities::check_input_transposed(*S, "FEAST.solve(), S");
+    if (S->_size != n || S->_location != Location::host) {
+      throw excBadArgument("FEAST.solve(), S: must be in main memory and have "
+                           "the same size as H");
+    }
+  }
+  if (!(e_min < e_max)) {
+    throw excBadArgument("FEAST.solve(): e_min must be smaller than e_max");
+  }
+  if (m0 < 1 || m0 > n) {
+    throw excBadArgument("FEAST.solve(): m0 = %d must be in [1, %d]", m0, n);
+  }
+  if (n_points < 1) {
+    throw excBadArgument("FEAST.solve(): n_points must be positive");
+  }
+#endif
+
+  // Contour: circle through e_min and e_max, Gauss-Legendre on the upper
+  // half. With z = c + r exp(i theta) and theta = pi / 2 * (1 - x_k) the
+  // point's weight (including the 1 / (2 pi i) and dz) is
+  // w_k / 4 * r * exp(i theta_k), the mirror point gets the conjugate
+  std::vector<double> x, w;
+  gauss_legendre(n_points, x, w);
+
+  auto center = (double(e_min) + double(e_max)) / 2;
+  auto radius = (double(e_max) - double(e_min)) / 2;
+  std::vector<complex_type> z(n_points), weight(n_points);
+  for (I_t k = 0; k < n_points; ++k) {
+    auto theta = M_PI / 2 * (1 - x[k]);
+    z[k]      = cast<complex_type>(center + radius * std::cos(theta),
+                                   radius * std::sin(theta));
+    weight[k] = cast<complex_type>(w[k] / 4 * radius * std::cos(theta),
+                                   w[k] / 4 * radius * std::sin(theta));
+  }
+
+  // Built-in shifted solves: banded LU if the band (including the fill-in)
+  // takes at most half the storage of the dense matrix
+  _kl = 0;
+  _ku = 0;
+  auto bandwidth = [this](const Sparse<T>& A) {
+    auto first = A._first_index;
+    auto edges = A._edges.get();
+    for (I_t row = 0; row < A._size; ++row) {
+      for (auto index = edges[row] - first; index < edges[row + 1] - first;
+           ++index) {
+        auto col = A._indices.get()[index] - first;
+        _kl = std::max(_kl, row - col);
+        _ku = std::max(_ku, col - row);
+      }
+    }
+  };
+  if (!shifted_solve) {
+    bandwidth(H);
+    if (S != nullptr) bandwidth(*S);
+  }
+  _banded_lu = (2 * (2 * _kl + _ku + 1) <= n);
+
+  auto threads = (n_streams <= 0) ? Threads::hardware_threads() : n_streams;
+  threads = int(std::min(I_t(threads), n_points));
+  std::vector<Stream>       streams(threads);
+  std::vector<Future<void>> done(n_points);
+  for (auto& stream : streams) stream.start_thread();
+
+  _banded.clear();
+  _banded.resize(n_points);
+  _factors.clear();
+  _factors.resize(n_points);
+  _pivots.clear();
+  _pivots.resize(n_points);
+  _contributions.clear();
+  for (I_t k = 0; k < n_points; ++k) _contributions.emplace_back(n, m0);
+
+  // Subspace: Y and S * Y, Q, H * Q, S * Q and the Ritz vectors
+  Dense<T> Y(n, m0), SY(n, m0), Q(n, m0), HQ(n, m0), SQ(n, m0), Q_conj(n, m0);
+  Dense<T> X(n, m0), HX(n, m0), SX(n, m0), YV(n, m0), SYV(n, m0);
+
+  // Reduced problems (projections and their eigenvectors), the
+  // coefficients C of the orthonormalized basis in terms of Q, the
+  // coefficients W of one orthonormalization pass and the eigenvalues
+  Dense<T> reduced(m0, m0), C(m0, m0), C_next(m0, m0), W(m0, m0);
+  Dense<real_type> sigma(m0, 1), lambda(m0, 1);
+
+  // Number of columns of the search subspace
+  I_t m = m0;
+
+  // result = A^H * B
+  auto project = [&Q_conj](const Dense<T>& A, const Dense<T>& B,
+                           Dense<T>& result) {
+    Dense<T> A_conj(Q_conj, 0, A.rows(), 0, A.cols());
+    for (I_t j = 0; j < A.cols(); ++j) {
+      auto a_j  = A._begin() + j * A._leading_dimension;
+      auto ac_j = A_conj._begin() + j * A_conj._leading_dimension;
+      for (I_t i = 0; i < A.rows(); ++i) ac_j[i] = conj(a_j[i]);
+    }
+    A_conj.transpose();
+    BLAS::xGEMM(cast<T>(1.0), A_conj, B, cast<T>(0.0), result);
+  };
+
+  // One orthonormalization pass on the first rank_in columns of B_in:
+  // with B_in^H * S * B_in = U * diag(sigma) * U^H, the first rank_out
+  // columns of B_out = B_in * U_r * diag(sigma_r)^-1/2 are S-orthonormal.
+  // Directions with sigma below m0 * epsilon of the largest one are dropped
+  // (the filter annihilated them, they are noise). Updates C, returns
+  // rank_out.
+  auto orthonormalize = [&](const Dense<T>& B_in, I_t rank_in,
+                            Dense<T>& B_out) -> I_t {
+    if (rank_in == 0) return 0;
+    Dense<T> B(B_in, 0, n, 0, rank_in), SB(SQ, 0, n, 0, rank_in);
+    Dense<T> G(reduced, 0, rank_in, 0, rank_in);
+    Dense<real_type> sigma_r(sigma, 0, rank_in, 0, 1);
+    if (S == nullptr) {
+      SB.copy_from(B);
+    } else {
+      BLAS::NATIVE::xCSRMM(cast<T>(1.0), *S, B, cast<T>(0.0), SB);
+    }
+    project(B, SB, G);
+    LAPACK::xHEEV(G, sigma_r);
+
+    // Ascending order: the kept directions are the last ones
+    auto sigma_ptr = sigma._begin();
+    auto threshold = sigma_ptr[rank_in - 1] * m0 *
+                     std::numeric_limits<real_type>::epsilon();
+    I_t rank_out = 0;
+    for (I_t j = 0; j < rank_in; ++j) {
+      if (sigma_ptr[j] > threshold) ++rank_out;
+    }
+    if (rank_out == 0) return 0;
+    auto first = rank_in - rank_out;
+    for (I_t j = 0; j < rank_out; ++j) {
+      auto scaling = cast<T>(1 / std::sqrt(double(sigma_ptr[first + j])));
+      auto u_j     = G._begin() + (first + j) * G._leading_dimension;
+      auto w_j     = W._begin() + j * W._leading_dimension;
+      for (I_t i = 0; i < rank_in; ++i) w_j[i] = scaling * u_j[i];
+    }
+
+    Dense<T> W_r(W, 0, rank_in, 0, rank_out);
+    Dense<T> B_new(B_out, 0, n, 0, rank_out);
+    Dense<T> C_r(C, 0, m, 0, rank_in), C_new(C_next, 0, m, 0, rank_out);
+    BLAS::xGEMM(cast<T>(1.0), B, W_r, cast<T>(0.0), B_new);
+    BLAS::xGEMM(cast<T>(1.0), C_r, W_r, cast<T>(0.0), C_new);
+    swap(C, C_next);
+    return rank_out;
+  };
+
+  I_t seed[] = { 17, 1031, 2459, 3 };
+  Fills::lapack_rand(Y, 2, seed);
+  if (S == nullptr) {
+    SY.copy_from(Y);
+  } else {
+    BLAS::NATIVE::xCSRMM(cast<T>(1.0), *S, Y, cast<T>(0.0), SY);
+  }
+
+  auto scale = std::max(std::max(std::abs(double(e_min)),
+                                 std::abs(double(e_max))), 2 * radius);
+  std::vector<I_t> inside;
+  I_t rank = 0, empty_iterations = 0;
+  max_residual = 0;
+  converged    = false;
+
+  for (iterations = 1; iterations <= max_iterations; ++iterations) {
+
+    // Filter: shifted solves, concurrently over the streams
+    Dense<T> Y_m(Y, 0, n, 0, m), SY_m(SY, 0, n, 0, m);
+    for (I_t k = 0; k < n_points; ++k) {
+      auto factorize = (iterations == 1);
+      auto z_k       = z[k];
+      auto weight_k  = weight[k];
+      done[k] = streams[k % threads].async([this, k, z_k, weight_k,
+                                            factorize, &H, S, &SY_m]() {
+        _quadrature_point(k, z_k, weight_k, factorize, H, S, SY_m);
+      });
+    }
+    for (auto& task : done) task.wait();
+    for (auto& task : done) task.get();
+
+    Fills::zero(Q);
+    auto Q_ptr = Q._begin();
+    for (I_t k = 0; k < n_points; ++k) {
+      auto Q_k = _contributions[k]._begin();
+      for (I_t i = 0; i < n * m; ++i) Q_ptr[i] += Q_k[i];
+    }
+
+    // Basis of the filtered subspace: two passes of S-orthonormalization
+    // (B = Q * C, rank columns), then Rayleigh-Ritz in that basis
+    Fills::zero(C);
+    for (I_t j = 0; j < m; ++j) C._begin()[j * C._leading_dimension + j] = 1;
+    rank = orthonormalize(Q, m, X);
+    rank = orthonormalize(X, rank, Q);
+
+    inside.clear();
+    max_residual = 0;
+    if (rank > 0) {
+
+      // Reduced standard problem B^H * H * B, Ritz vectors X = B * V and
+      // their coefficients C * V in terms of Q
+      Dense<T> B(Q, 0, n, 0, rank), HB(HQ, 0, n, 0, rank);
+      Dense<T> SB(SQ, 0, n, 0, rank), H_reduced(reduced, 0, rank, 0, rank);
+      Dense<T> C_r(C, 0, m, 0, rank), CV(W, 0, m, 0, rank);
+      Dense<real_type> lambda_r(lambda, 0, rank, 0, 1);
+      BLAS::NATIVE::xCSRMM(cast<T>(1.0), H, B, cast<T>(0.0), HB);
+      if (S == nullptr) {
+        SB.copy_from(B);
+      } else {
+        BLAS::NATIVE::xCSRMM(cast<T>(1.0), *S, B, cast<T>(0.0), SB);
+      }
+      project(B, HB, H_reduced);
+      LAPACK::xHEEV(H_reduced, lambda_r);
+      BLAS::xGEMM(cast<T>(1.0), C_r, H_reduced, cast<T>(0.0), CV);
+
+      Dense<T> X_r(X, 0, n, 0, rank), HX_r(HX, 0, n, 0, rank);
+      Dense<T> SX_r(SX, 0, n, 0, rank), YV_r(YV, 0, n, 0, rank);
+      Dense<T> SYV_r(SYV, 0, n, 0, rank);
+      BLAS::xGEMM(cast<T>(1.0), B, H_reduced, cast<T>(0.0), X_r);
+      BLAS::xGEMM(cast<T>(1.0), HB, H_reduced, cast<T>(0.0), HX_r);
+      BLAS::xGEMM(cast<T>(1.0), SB, H_reduced, cast<T>(0.0), SX_r);
+
+      // Preimages of the Ritz vectors under the filter, Y * C * V and
+      // S * Y * C * V
+      BLAS::xGEMM(cast<T>(1.0), Y_m, CV, cast<T>(0.0), YV_r);
+      BLAS::xGEMM(cast<T>(1.0), SY_m, CV, cast<T>(0.0), SYV_r);
+
+    }
+
+    // Residuals of the Ritz pairs in the interval. Pairs whose filter value
+    // |Q * v|_S / |Y * v|_S is small are spurious (they stem from directions
+    // the filter annihilated, the filter is >= 1/2 inside the interval) and
+    // are ignored
+    auto lambda_ptr = lambda._begin();
+    for (I_t j = 0; j < rank; ++j) {
+      if (lambda_ptr[j] < e_min || lambda_ptr[j] > e_max) continue;
+      auto yv_j  = YV._begin() + j * YV._leading_dimension;
+      auto syv_j = SYV._begin() + j * SYV._leading_dimension;
+      double preimage2 = 0;
+      for (I_t i = 0; i < n; ++i) preimage2 += real(conj(yv_j[i]) * syv_j[i]);
+      if (preimage2 > 16) continue;
+      inside.push_back(j);
+      auto x_j  = X._begin() + j * X._leading_dimension;
+      auto hx_j = HX._begin() + j * HX._leading_dimension;
+      auto sx_j = SX._begin() + j * SX._leading_dimension;
+      double r2 = 0, x2 = 0;
+      for (I_t i = 0; i < n; ++i) {
+        auto r = hx_j[i] - cast<T>(lambda_ptr[j]) * sx_j[i];
+        r2 += real(r * conj(r));
+        x2 += real(x_j[i] * conj(x_j[i]));
+      }
+      max_residual = std::max(max_residual, std::sqrt(r2 / x2) / scale);
+    }
+
+    // Converged if the residuals reached the tolerance, or if the interval
+    // stayed empty in two consecutive iterations (or the filter annihilated
+    // the whole subspace)
+    empty_iterations = inside.empty() ? empty_iterations + 1 : 0;
+    if ((!inside.empty() && max_residual < tolerance) ||
+        empty_iterations == 2 || rank == 0) {
+      converged = true;
+      break;
+    }
+
+    // Next iteration filters the Ritz vectors, the dropped directions are
+    // not refilled (random vectors would reintroduce directions the filter
+    // can only resolve to rounding error)
+    m = rank;
+    Dense<T>(Y, 0, n, 0, m).copy_from(Dense<T>(X, 0, n, 0, m));
+    Dense<T>(SY, 0, n, 0, m).copy_from(Dense<T>(SX, 0, n, 0, m));
+
+  }
+  if (iterations > max_iterations) iterations = max_iterations;
+
+  auto n_found = I_t(inside.size());
+  if (n_found == 0) {
+    eigenvalues.unlink();
+    eigenvectors.unlink();
+  } else {
+    eigenvalues.reallocate(n_found, 1);
+    eigenvectors.reallocate(n, n_found);
+  }
+  for (I_t j = 0; j < n_found; ++j) {
+    eigenvalues._begin()[j] = lambda._begin()[inside[j]];
+    auto source      = X._begin() + inside[j] * X._leading_dimension;
+    auto destination = eigenvectors._begin() +
+                       j * eigenvectors._leading_dimension;
+    std::copy(source, source + n, destination);
+  }
+
+#ifndef LINALG_NO_CHECKS
+  if (!converged) {
+    throw excMath("FEAST.solve(): no convergence after %d iterations "
+                  "(largest relative residual %e)", iterations, max_residual);
+  }
+#endif
+
+  return n_found;
+
+}
+#endif /* DOXYGEN_SKIP */
+
+/** \brief            Compute the eigenpairs of a Hermitian matrix in an
+ *                    interval
+ *
+ *  H * x = lambda * x, lambda in [e_min, e_max]
+ *
+ *  \param[in]        H
+ *                    Hermitian matrix, Format::CSR, in main memory.
+ *
+ *  \param[in]        e_min
+ *                    Lower end of the search interval.
+ *
+ *  \param[in]        e_max
+ *                    Upper end of the search interval.
+ *
+ *  \param[in]        m0
+ *                    Size of the search subspace, must be larger than the
+ *                    number of eigenvalues in the interval (typically by a
+ *                    factor of 1.5 to 2).
+ *
+ *  \param[out]       eigenvalues
+ *                    Eigenvalues found in the interval, ascending.
+ *                    Reallocated.
+ *
+ *  \param[out]       eigenvectors
+ *                    Corresponding eigenvectors, n x n_found. Reallocated.
+ *
+ *  \returns          Number of eigenpairs found in the interval.
+ *
+ *  Throws excMath if the residuals don't reach the tolerance within
+ *  max_iterations (eigenvalues and eigenvectors then hold the Ritz pairs in
+ *  the interval of the last iteration, see also converged).
+ */
+template <typename T>
+I_t FEAST<T>::solve(const Sparse<T>& H, real_type e_min, real_type e_max,
+                    I_t m0, Dense<real_type>& eigenvalues,
+                    Dense<T>& eigenvectors) {
+
+  PROFILING_FUNCTION_HEADER
+
+  return _solve(H, nullptr, e_min, e_max, m0, eigenvalues, eigenvectors);
+
+}
+
+/** \brief            Compute the eigenpairs of a Hermitian-definite pencil in
+ *                    an interval
+ *
+ *  H * x = lambda * S * x, lambda in [e_min, e_max]
+ *
+ *  \param[in]        H
+ *                    Hermitian matrix, Format::CSR, in main memory.
+ *
+ *  \param[in]        S
+ *                    Hermitian positive definite matrix, Format::CSR, in main
+ *                    memory.
+ *
+ *  \param[in]        e_min
+ *                    Lower end of the search interval.
+ *
+ *  \param[in]        e_max
+ *                    Upper end of the search interval.
+ *
+ *  \param[in]        m0
+ *                    Size of the search subspace, must be larger than the
+ *                    number of eigenvalues in the interval.
+ *
+ *  \param[out]       eigenvalues
+ *                    Eigenvalues found in the interval, ascending.
+ *                    Reallocated.
+ *
+ *  \param[out]       eigenvectors
+ *                    Corresponding eigenvectors (S-orthonormal), n x n_found.
+ *                    Reallocated.
+ *
+ *  \returns          Number of eigenpairs found in the interval.
+ *
+ *  Throws excMath if the residuals don't reach the tolerance within
+ *  max_iterations (eigenvalues and eigenvectors then hold the Ritz pairs in
+ *  the interval of the last iteration, see also converged).
+ */
+template <typename T>
+I_t FEAST<T>::solve(const Sparse<T>& H, const Sparse<T>& S, real_type e_min,
+                    real_type e_max, I_t m0, Dense<real_type>& eigenvalues,
+                    Dense<T>& eigenvectors) {
+
+  PROFILING_FUNCTION_HEADER
+
+  return _solve(H, &S, e_min, e_max, m0, eigenvalues, eigenvectors);
+
+}
+
+} /* namespace LinAlg::Solvers */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_SOLVERS_FEAST_H_ */
@@ -0,0 +1,25 @@
+/** \file
+ *
+ *  \brief            Iterative solvers and preconditioners
+ *
+ *  Organization of the namespace:
+ *
+ *    LinAlg::Solvers
+ *        iterative solvers and preconditioners built on the LinAlg types
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_SOLVERS_SOLVERS_H_
+#define LINALG_SOLVERS_SOLVERS_H_
+
+// Keep this in alphabetical order
+
+#include "amg.h"
+#include "feast.h"
+
+#endif /* LINALG_SOLVERS_SOLVERS_H_ */
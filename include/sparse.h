@@ -49,7 +49,7 @@ struct Sparse : Matrix {
 
   // See dense.h for an argument on why we provide the constructors and 
   // operators we do
-  Sparse(Sparse&& other);
+  Sparse(Sparse&& other) noexcept;
   Sparse(Sparse& other);
   Sparse(const Sparse& other);
 #ifndef DOXYGEN_SKIP
@@ -264,7 +264,7 @@ Sparse<T>::~Sparse() {
 /** \brief              Move constructor
  */
 template <typename T>
-Sparse<T>::Sparse(Sparse&& other) : Sparse() {
+Sparse<T>::Sparse(Sparse&& other) noexcept : Sparse() {
 
   PROFILING_FUNCTION_HEADER
 
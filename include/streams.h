@@ -28,13 +28,23 @@
 # include <mpi.h>
 #endif
 
-#include <functional> // std::function
-#include <queue>      // std::deque
 #include <atomic>     // std::atomic
+#include <limits>     // std::numeric_limits
+#include <cstddef>    // std::size_t
+#include <vector>     // std::vector
+#include <utility>    // std::move
+#include <memory>     // std::shared_ptr
+#include <exception>  // std::exception_ptr, std::rethrow_exception
+#include <type_traits> // std::result_of, std::decay
+#include <string>     // std::string
 
 #include "types.h"
 #include "profiling.h"
 #include "threads.h"
+#include "executor.h"
+#include "affinity.h"
+#include "ring_buffer.h"
+#include "task.h"
 #include "exceptions.h"
 #include "dense.h"
 #include "sparse.h"
@@ -44,6 +54,109 @@ namespace LinAlg {
 // Makes the constructor for synchronous streams a bit more explicit
 enum class Streams { Synchronous };
 
+struct Stream;
+
+/** \brief            A position in a Stream that other streams can wait for
+ *
+ *  Events are obtained from Stream::record() or constructed from a ticket 
+ *  and are passed to Stream::wait() or as dependencies to Stream::add().
+ *
+ *  \example
+ *    auto inverted = stream_a.add(invert_task);
+ *    stream_b.add(gemm_task, { Event(stream_a, inverted) });
+ */
+struct Event {
+
+  Event() : stream(nullptr), ticket(0) {}
+  Event(Stream& stream_, I_t ticket_) : stream(&stream_), ticket(ticket_) {}
+
+  inline bool done() const;
+  inline void sync() const;
+
+  Stream* stream;
+  I_t     ticket;
+
+};
+
+/** \brief            Contiguous range of tickets (as returned by 
+ *                    Stream::add_batch())
+ */
+struct TicketRange {
+
+  /// Number of tickets in the range
+  inline I_t size() const { return last - first + 1; }
+
+  I_t first;
+  I_t last;
+
+};
+
+#ifndef DOXYGEN_SKIP
+// Result (or exception) of a task started with Stream::async()
+template <typename R>
+struct FutureState {
+  R                  value;
+  std::exception_ptr exception;
+  template <typename F>
+  inline void run(F& function) {
+    try { value = function(); }
+    catch (...) { exception = std::current_exception(); }
+  }
+  inline R take() {
+    if (exception) std::rethrow_exception(exception);
+    return std::move(value);
+  }
+};
+
+template <>
+struct FutureState<void> {
+  std::exception_ptr exception;
+  template <typename F>
+  inline void run(F& function) {
+    try { function(); }
+    catch (...) { exception = std::current_exception(); }
+  }
+  inline void take() {
+    if (exception) std::rethrow_exception(exception);
+  }
+};
+
+// The task put on the stream by Stream::async()
+template <typename R, typename F>
+struct FutureTask {
+  std::shared_ptr<FutureState<R>> state;
+  F                               function;
+  inline void operator()() { state->run(function); }
+};
+#endif
+
+/** \brief            Typed handle for the result of a task started with 
+ *                    Stream::async()
+ *
+ *  The result type must be default constructible. Exceptions thrown by the 
+ *  task are rethrown by get().
+ *
+ *  \example
+ *    auto info = stream.async([=]() mutable { return factorize(A); });
+ *    while (!info.is_done()) poll_mpi();
+ *    if (info.get() != 0) ...
+ */
+template <typename R>
+struct Future {
+
+  Future() {}
+
+  inline bool  valid() const { return state != nullptr; }
+  inline bool  is_done() const { return event.done(); }
+  inline void  wait() const { event.sync(); }
+  inline R     get();
+
+  /// The task's position in its stream, for use as a dependency
+  Event                           event;
+  std::shared_ptr<FutureState<R>> state;
+
+};
+
 /** \brief            Base class to handle mechanisms for asynchronous 
  *                    execution
  *
@@ -63,6 +176,57 @@ enum class Streams { Synchronous };
  *                       added to the stream)
  *    - Synchronization: arbitrary queue positions (incl. global 
  *                       synchronization)
+ *    - Notes:
+ *
+ *      Streams don't own threads. A stream is an ordered queue of tasks that 
+ *      is multiplexed onto a shared work-stealing thread pool 
+ *      (Threads::Executor::global() unless set otherwise). Whenever a stream 
+ *      has work, exactly one job for it is scheduled on the executor. That 
+ *      job executes the next task and reschedules itself while there are 
+ *      tasks left, so the tasks of one stream never run concurrently while 
+ *      idle workers can pick up the work of any stream.
+ *
+ *      Streams with an affinity policy (set_affinity(), or for all streams 
+ *      the environment variable LINALG_STREAM_AFFINITY, see 
+ *      Threads::Affinity) run on an executor whose workers are pinned to the 
+ *      given core, core set or NUMA node. Streams with the same CPU set 
+ *      share that executor. placement() reports where the workers actually 
+ *      run.
+ *
+ *      The queue of a stream is a bounded lock-free ring buffer 
+ *      (LINALG_STREAM_QUEUE_SIZE entries, allocated on first use) with the 
+ *      executor job as its only consumer: adding a task takes no lock. 
+ *      Streams that aren't started yet queue under a lock and grow their 
+ *      queue as needed, sync() then executes the tasks in one calling 
+ *      thread at a time. Threads waiting in sync() 
+ *      sleep on an EventCount and are only woken once the ticket they wait 
+ *      for (or an earlier one waited for by another thread) completed. 
+ *      Before going to sleep they spin and yield as set by sync_policy.
+ *
+ *      Tasks can depend on the tickets of other streams (see Event, wait() 
+ *      and add() with dependencies). A dependency occupies a queue position 
+ *      of its own and holds back all later tasks of the stream. When the 
+ *      runner reaches an unmet dependency it doesn't block its worker: the 
+ *      stream registers itself with the other stream and is rescheduled as 
+ *      soon as the awaited ticket completes.
+ *
+ *      Tasks are Threads::Task objects: move-only callables that store 
+ *      typical captures inline. Pass temporaries or std::move() a named 
+ *      lambda into add() to avoid copying its captures.
+ *
+ *      Many small tasks are best added with add_batch(), which claims all 
+ *      their queue positions at once and schedules the runner only once. 
+ *      Setting coalesce > 1 lets the runner execute up to that many tasks 
+ *      per executor job instead of rescheduling after every task, which 
+ *      trades fairness towards other streams on the same executor for less 
+ *      scheduling overhead.
+ *
+ *      Latency critical streams (e.g. ones packing MPI messages) can be given 
+ *      a higher priority: the executor runs the jobs of high priority 
+ *      streams before those of normal or low priority ones. As tasks aren't 
+ *      interrupted, a high priority task waits at most for the tasks 
+ *      currently running on the workers (coalescing runners stop early when 
+ *      more urgent work is waiting).
  *
  *  CUDA based sub stream
  *  ---------------------
@@ -102,9 +266,41 @@ struct Stream {
   // General facilities
   inline void sync(I_t ticket);
   inline void sync();
+  inline bool is_done(I_t ticket);
+  inline bool is_done();
+  inline bool try_sync(I_t ticket);
+  inline bool try_sync();
   inline void clear();
   inline void set(int device_id_, bool asynchronous_);
 
+  // How sync() waits for tasks of the thread based stream (default: 
+  // Threads::SyncPolicy::adaptive())
+  Threads::SyncPolicy sync_policy;
+
+  // Maximal number of tasks the thread based stream executes per executor 
+  // job (default: 1). Only change while no tasks are running.
+  int                 coalesce;
+
+  // Priority of the thread based stream on its executor (default: 
+  // Threads::Priority::normal). Only change while no tasks are running.
+  Threads::Priority   priority;
+
+  // Placement of the thread based stream
+  inline void        set_affinity(const Threads::Affinity& affinity_);
+  inline std::string placement() const;
+
+  // Dependencies between streams
+  inline Event record();
+  inline I_t   wait(const Event& event);
+
+  // Tasks with results
+  template <typename F>
+  inline Future<typename std::result_of<typename std::decay<F>::type&()>::type>
+  async(F&& function);
+  template <typename F>
+  inline Future<typename std::result_of<typename std::decay<F>::type&()>::type>
+  async(F&& function, const std::vector<Event>& dependencies);
+
 #ifndef DOXYGEN_SKIP
   inline void load_defaults();
 
@@ -122,40 +318,95 @@ struct Stream {
 
   /////////////////////////////////////////
   // Facilities for the thread based stream
+
+  // Only used for the handshake between stop_thread() and the runner
   Threads::Mutex                    lock;
   Threads::ConditionVariable        cv;
 
-# ifdef USE_POSIX_THREADS
-  pthread_t                         worker_thread;
-  // Pthreads expect a C-style pointer to a void* function and support passing 
-  // void* arguments to it. Thus unlike in the C++11 thread case below passing 
-  // a std::function object doesn't work. So we create a static wrapper that 
-  // expects a pointer to the class instance as argument, internally casts it 
-  // to a Stream* pointer and then calls the corresponding worker function.  
-  // This is neither elegant nor type safe but seems to be the idiomatic way 
-  // of dealing with this situation in C++
-  static void* worker_wrapper(void* instance) {
-    ((Stream*)instance)->worker();
-    return nullptr;
-  }
-# else /* use C++11 threads */
-  std::thread                       worker_thread;
-# endif /* USE_POSIX_THREADS */
-
-  std::deque<std::function<void()>> queue;
+  // Thread pool the tasks are executed on (determined by the affinity, 
+  // nullptr until the stream is first attached such that streams that are 
+  // never started don't create executors)
+  Threads::Executor*                executor;
+  Threads::Affinity                 affinity;
+
+  // An entry is either a task or a dependency on another stream (if 
+  // after_stream is set). The entry at position p in the queue has ticket 
+  // p + 1.
+  struct Entry {
+    Threads::Task task;
+    Stream*       after_stream;
+    I_t           after_ticket;
+  };
+  Threads::RingBuffer<Entry>        queue;
   std::atomic<I_t>                  next_in_queue;
+  // Streams not attached to the executor push and pop under this lock and 
+  // grow the queue instead of waiting for a consumer
+  Threads::Mutex                    queue_lock;
+  // Thread consuming the queue of a stream not attached to the executor 
+  // (see this_thread_tag())
+  std::atomic<const void*>          drainer;
+  static const void* this_thread_tag() {
+    static thread_local char tag;
+    return &tag;
+  }
+  // Tasks with tickets up to this one are dropped instead of executed
+  std::atomic<I_t>                  discard_until;
 
   inline void                       start_thread();
   inline void                       stop_thread();
-  bool                              terminate_thread;
+  std::atomic<bool>                 terminate_thread;
   bool                              thread_alive;
-  inline void                       worker();
 
-  inline I_t                        add(std::function<void()> task);
-  I_t                               next_ticket;
-  // next_ticket == next_in_queue => no work;
+  // Whether a job for this stream is queued or running on the executor.  
+  // Jobs get the stream as argument through the static wrapper.
+  std::atomic<bool>                 runner_scheduled;
+  inline void                       runner();
+  static void runner_wrapper(void* instance) {
+    static_cast<Stream*>(instance)->runner();
+  }
+  // Entry taken from the queue whose dependency is not met yet
+  Entry                             held;
+  std::size_t                       held_position;
+  bool                              holding;
+
+  enum class Progress { empty, executed, blocked };
+  inline Progress                   run_next(bool may_block);
+  inline bool                       has_work() const {
+    return holding || !queue.empty();
+  }
+
+  inline I_t                        add(Threads::Task task);
+  inline I_t                        add(Threads::Task task,
+                                        const std::vector<Event>& dependencies);
+  inline TicketRange                add_batch(std::vector<Threads::Task> tasks);
+  inline I_t                        push(Entry&& entry);
+  inline void                       make_room(std::size_t n);
+  inline void                       schedule_runner();
   inline void                       sync_generic(I_t ticket);
-  bool                              generic_synchronized;
+  inline void                       sleep_until(I_t ticket,
+                                                bool or_drainer_leaves);
+
+  // Waiters sleep on 'completed', which is only notified once next_in_queue 
+  // passes wake_at (the smallest ticket any thread waits for)
+  Threads::EventCount               completed;
+  std::atomic<I_t>                  wake_at;
+
+  // Jobs to submit once a ticket completed
+  struct Continuation {
+    I_t                ticket;
+    Threads::Executor* executor;
+    Threads::Job       job;
+    Threads::Priority  priority;
+  };
+  Threads::Mutex                    continuation_lock;
+  std::vector<Continuation>         continuations;
+  std::atomic<int>                  n_continuations;
+  inline void                       notify_when_done(I_t ticket, 
+                                      Threads::Executor& target,
+                                      Threads::Job job,
+                                      Threads::Priority job_priority =
+                                        Threads::Priority::normal);
+  inline void                       fire_continuations();
 
 # ifdef HAVE_CUDA
   //////////////////////////////
@@ -190,9 +441,9 @@ struct Stream {
 
 /** \brief            Constructor
  *
- *  Generic stream: The constructor doesn't spawn a thread to avoid having 
- *  lingering threads for classes with streams as members. Use start_thread() 
- *  to create the worker thread and 'activate' the generic stream.
+ *  Generic stream: The constructor doesn't attach the stream to the executor 
+ *  (tasks added are only queued). Use start_thread() to 'activate' the 
+ *  generic stream.
  *
  *  CUDA stream: The constructor creates a stream and handles for the current 
  *  device. To create a stream for a specific device, use the corresponding 
@@ -200,7 +451,7 @@ struct Stream {
  *
  *  MPI stream: standard handler for asynchronous MPI calls.
  */
-inline Stream::Stream() {
+inline Stream::Stream() : queue(LINALG_STREAM_QUEUE_SIZE) {
 
   PROFILING_FUNCTION_HEADER
 
@@ -219,7 +470,7 @@ inline Stream::Stream() {
  *  \example
  *    Stream mystream(Streams::Synchronous);
  */
-inline Stream::Stream(Streams ignored) {
+inline Stream::Stream(Streams ignored) : queue(LINALG_STREAM_QUEUE_SIZE) {
 
   PROFILING_FUNCTION_HEADER
 
@@ -244,7 +495,7 @@ inline Stream::Stream(Streams ignored) {
  *                    all sub streams that support devices as there is 
  *                    typically only one sort of accelerator in one system.
  */
-inline Stream::Stream(int device_id_) {
+inline Stream::Stream(int device_id_) : queue(LINALG_STREAM_QUEUE_SIZE) {
 
   PROFILING_FUNCTION_HEADER
 
@@ -267,7 +518,8 @@ inline Stream::Stream(int device_id_) {
  *
  *  \param[in]        ignored
  */
-inline Stream::Stream(int device_id_, Streams ignored) {
+inline Stream::Stream(int device_id_, Streams ignored)
+  : queue(LINALG_STREAM_QUEUE_SIZE) {
 
   PROFILING_FUNCTION_HEADER
 
@@ -326,37 +578,88 @@ inline void Stream::sync(I_t ticket) {
  */
 inline void Stream::sync() { sync(0); }
 
-
-/** \brief            Remove all tasks from the stream
+/** \brief            Check whether a task completed without blocking
  *
- *  For streams not supporting clearing, synchronization is performed.
+ *  Never executes tasks, tasks of a stream that is not attached to the 
+ *  executor only make progress in sync().
+ *
+ *  \param[in]        ticket
+ *                    OPTIONAL: 'Ticket' number of the task. A ticket number 
+ *                    of 0 checks all tasks (including those in the CUDA and 
+ *                    MPI sub streams). DEFAULT: 0
+ *
+ *  \returns          True if the task completed.
  */
-inline void Stream::clear() {
+inline bool Stream::is_done(I_t ticket) {
 
   PROFILING_FUNCTION_HEADER
 
-  // Generic stream operations
+  auto generic_ticket = (ticket == 0) ? I_t(queue.claimed()) : ticket;
+  if (next_in_queue <= generic_ticket) return false;
 
-  // Locking blocks if there's another thread
-  if (!synchronous && thread_alive) {
+#ifdef HAVE_CUDA
+  if (!cuda_synchronized) {
+    auto status = cudaStreamQuery(cuda_stream);
+    if (status == cudaErrorNotReady) return false;
+    checkCUDA(status);
+  }
+#endif
+#ifdef HAVE_MPI
+  if (!mpi_synchronized) {
+    int done;
+    MPI_Testall(int(mpi_requests.size()), mpi_requests.data(), &done,
+                MPI_STATUSES_IGNORE);
+    if (!done) return false;
+  }
+#endif
 
-    Threads::MutexLock clear_lock(lock);
+  return true;
 
-    // Remove all tasks from the queue
-    queue.clear();
+}
+/** \overload
+ */
+inline bool Stream::is_done() { return is_done(0); }
 
-    // This signals that no work is available
-    next_ticket = next_in_queue;
+/** \brief            Synchronize with a task if it completed, return 
+ *                    immediately otherwise
+ *
+ *  \param[in]        ticket
+ *                    OPTIONAL: 'Ticket' number of the task. A ticket number 
+ *                    of 0 indicates that global synchronization is 
+ *                    requested. DEFAULT: 0
+ *
+ *  \returns          True if the task completed (in which case the stream is 
+ *                    in the same state as after sync(ticket)).
+ */
+inline bool Stream::try_sync(I_t ticket) {
 
-  } else {
+  PROFILING_FUNCTION_HEADER
 
-    // Remove all tasks from the queue
-    queue.clear();
+  if (!is_done(ticket)) return false;
 
-    // This signals that no work is available
-    next_ticket = next_in_queue;
+  // All sub streams are done, this only updates the bookkeeping
+  sync(ticket);
 
-  }
+  return true;
+
+}
+/** \overload
+ */
+inline bool Stream::try_sync() { return try_sync(0); }
+
+
+/** \brief            Remove all tasks from the stream
+ *
+ *  For streams not supporting clearing, synchronization is performed.
+ */
+inline void Stream::clear() {
+
+  PROFILING_FUNCTION_HEADER
+
+  // Generic stream operations: only the consumer may remove tasks from the 
+  // queue, so mark them instead. Their tickets count as completed as soon as 
+  // the consumer passed them.
+  discard_until = I_t(queue.claimed());
 
 #ifdef HAVE_CUDA
   sync_cuda();
@@ -392,6 +695,44 @@ inline void Stream::set(int device_id_, bool asynchronous_) {
 
 }
 
+/** \brief            Set where the tasks of the stream are executed
+ *
+ *  A running stream is stopped (see stop_thread()) and restarted on the 
+ *  executor for the new policy.
+ *
+ *  \param[in]        affinity_
+ *                    The placement policy, e.g. Threads::Affinity::core(3), 
+ *                    Threads::Affinity::numa_node(1) or 
+ *                    Threads::Affinity::none() for the global executor.
+ */
+inline void Stream::set_affinity(const Threads::Affinity& affinity_) {
+
+  PROFILING_FUNCTION_HEADER
+
+  // Resolve first such that an invalid policy leaves the stream untouched
+  auto& target      = Threads::Executor::for_affinity(affinity_);
+  auto  was_running = !synchronous && thread_alive;
+
+  stop_thread();
+
+  affinity = affinity_;
+  executor = &target;
+
+  if (was_running) start_thread();
+
+}
+
+/** \brief            Describe where the tasks of the stream are executed
+ *
+ *  \returns          The policy and the CPUs each worker of the executor may 
+ *                    run on, e.g. "numa:1 -> 0:cpus=8 1:cpus=9".
+ */
+inline std::string Stream::placement() const {
+  auto& target = (executor != nullptr)
+                 ? *executor : Threads::Executor::for_affinity(affinity);
+  return affinity.to_string() + " -> " + target.placement();
+}
+
 #ifndef DOXYGEN_SKIP
 /** \brief            Set all members to default values
  */
@@ -401,8 +742,6 @@ inline void Stream::load_defaults() {
   prefer_native        = true;
   device_id            = 0;
   thread_alive         = false;
-  next_ticket          = 1;
-  generic_synchronized = true;
 # ifdef HAVE_CUDA
   cuda_synchronized    = true;
   cuda_stream          = NULL;
@@ -411,54 +750,60 @@ inline void Stream::load_defaults() {
   mpi_synchronized     = true;
 # endif
   terminate_thread     = false;
-  next_in_queue.store(1);
+  runner_scheduled     = false;
+  sync_policy          = Threads::SyncPolicy::adaptive();
+  coalesce             = 1;
+  priority             = Threads::Priority::normal;
+  affinity             = Threads::Affinity::from_environment();
+  executor             = nullptr;
+  next_in_queue        = 1;
+  discard_until        = 0;
+  holding              = false;
+  held.after_stream    = nullptr;
+  n_continuations      = 0;
+  wake_at              = std::numeric_limits<I_t>::max();
+  drainer              = nullptr;
 
 }
 #endif /* not DOXYGEN_SKIP */
 
 // Generic stream facilities
-/** \brief            Enables the generic stream by creating the worker thread
+/** \brief            Enables the generic stream by attaching it to the 
+ *                    executor
  *
- *  For synchronous streams, no worker thread is spawned.
+ *  For synchronous streams, nothing happens. Tasks added before the stream is 
+ *  started are executed from now on.
  */
 inline void Stream::start_thread() {
 
   PROFILING_FUNCTION_HEADER
 
-  if (synchronous) {
-
-    return;
-
-  } else {
-
-    // Start the worker thread
-#ifdef USE_POSIX_THREADS
+  if (synchronous) return;
 
-    // See in the class definition why we need the wrapper for the worker 
-    // function
-    printf("CREATING POSIX THREAD\n");
-    auto error = pthread_create(&worker_thread, NULL, 
-                                &Stream::worker_wrapper, this);
-# ifndef LINALG_NO_CHECKS
-    if (error != 0) {
-      throw excSystemError("Unable to spawn thread, error = %d", error);
-    }
-# endif
-
-#else /* use C++11 threads */
-
-    worker_thread = std::thread(&Stream::worker, this);
+  {
+    // Allocates the queue on first use
+    Threads::MutexLock queue_registry_lock(queue_lock);
+    queue.reserve(0);
+  }
 
-#endif
+  if (executor == nullptr) {
+    executor = &Threads::Executor::for_affinity(affinity);
+  }
 
-    thread_alive = true;
+  thread_alive = true;
 
+  if (has_work() && !runner_scheduled.exchange(true)) {
+    executor->submit({&Stream::runner_wrapper, this}, priority);
   }
 
 }
 
-/** \brief            Signal the worker thread to exit, thereby stopping the 
+/** \brief            Detach the stream from the executor, thereby stopping the 
  *                    queue
+ *
+ *  The task that is currently being executed (if any) is completed, the 
+ *  remaining tasks stay in the queue. If the stream waits for another stream 
+ *  (see wait()), this returns once that dependency completed.
  */
 inline void Stream::stop_thread() {
 
@@ -466,21 +811,14 @@ inline void Stream::stop_thread() {
 
   if (!synchronous && thread_alive) {
 
-    {
+    Threads::MutexLock terminate_lock(lock);
 
-      Threads::MutexLock terminate_lock(lock);
+    terminate_thread = true;
 
-      terminate_thread = true;
+    // Wait for the job on the executor to notice
+    cv.wait(terminate_lock, [this](){ return !runner_scheduled; });
 
-    }
-
-    cv.notify_all();
-
-#ifdef USE_POSIX_THREADS
-    pthread_join(worker_thread, NULL);
-#else /* C++11 threads */
-    worker_thread.join();
-#endif
+    terminate_thread = false;
 
   }
 
@@ -489,153 +827,523 @@ inline void Stream::stop_thread() {
 }
 
 #ifndef DOXYGEN_SKIP
-/** \brief            Payload for the thread
+/** \brief            Payload for the executor: execute the next task and 
+ *                    reschedule if there is more work
  */
-inline void Stream::worker() {
+inline void Stream::runner() {
 
   PROFILING_FUNCTION_HEADER
 
-  // Buffer so we can release the lock before executing
-  std::function<void()> current_task;
+  // When blocked, the stream is rescheduled by the stream it waits for and 
+  // we may not touch it anymore
+  for (int i = 0; i < coalesce && !terminate_thread; ++i) {
+    auto progress = run_next(false);
+    if (progress == Progress::blocked) return;
+    if (progress == Progress::empty) break;
+    // Let more urgent streams go first
+    if (executor->has_jobs_above(priority)) break;
+  }
+
+  // Reschedule instead of looping such that other streams sharing the 
+  // executor get their turn
+  if (!terminate_thread && has_work()) {
+    executor->submit({&Stream::runner_wrapper, this}, priority);
+    return;
+  }
+
+  // Going idle. This happens under the lock as stop_thread() (and with it 
+  // the destructor) may proceed as soon as the flag is cleared.
+  Threads::MutexLock runner_lock(lock);
 
-  while (!terminate_thread) {
+  runner_scheduled = false;
 
-    { // RAII scope for thread_lock
+  // add() may have pushed after the check above while the flag was still 
+  // set. Only look at the queue: once the flag is cleared, a new runner may 
+  // own the held entry (we hold none, otherwise has_work() was true above).
+  if (!terminate_thread && !queue.empty() &&
+      !runner_scheduled.exchange(true)) {
+    runner_lock.unlock();
+    executor->submit({&Stream::runner_wrapper, this}, priority);
+    return;
+  }
+
+  cv.notify_all();
+
+}
+
+/** \brief            Consume the next entry: execute it (unless it has been 
+ *                    cleared) and wake the threads waiting for it
+ *
+ *  Only the runner or, for streams not attached to the executor, the thread 
+ *  adding to or synchronizing with the stream may call this.
+ *
+ *  \param[in]        may_block
+ *                    Whether to wait in the calling thread for unmet 
+ *                    dependencies. If false, the stream is registered to be 
+ *                    rescheduled on its executor instead and 
+ *                    Progress::blocked is returned (after which the caller 
+ *                    must not access the stream anymore).
+ *
+ *  \returns          Progress::empty if the queue was empty.
+ */
+inline Stream::Progress Stream::run_next(bool may_block) {
 
-      // Safely examine the condition. The lock prevents other threads to 
-      // modify it while we check the condition.
-      Threads::MutexLock thread_lock(lock);
+  if (!holding) {
+    bool popped;
+    if (synchronous || !thread_alive) {
+      Threads::MutexLock queue_registry_lock(queue_lock);
+      popped = queue.pop(held, held_position);
+    } else {
+      popped = queue.pop(held, held_position);
+    }
+    if (!popped) return Progress::empty;
+    holding = true;
+  }
 
-      if (queue.empty()) {
+  auto ticket    = I_t(held_position) + 1;
+  auto discarded = ticket <= discard_until;
 
-        // If the queue is empty we wait (releases the lock while waiting and 
-        // reacquires it when the condition becomes true)
-        cv.wait(thread_lock,
-                [this](){ return (!queue.empty() || terminate_thread); });
+  if (!discarded && held.after_stream != nullptr) {
 
-        if (terminate_thread) return;
+    auto& after = *held.after_stream;
 
+    if (after.next_in_queue <= held.after_ticket) {
+      if (may_block) {
+        after.sync_generic(held.after_ticket);
+      } else {
+        after.notify_when_done(held.after_ticket, *executor,
+                               {&Stream::runner_wrapper, this}, priority);
+        return Progress::blocked;
       }
+    }
 
-      // Fetch work
-      current_task = queue.back();
-      queue.pop_back();
+  }
 
-    } // Implicit release of thread_lock at the end of the scope block
+  holding = false;
 
-    // Execute the task
-    current_task();
+  if (!discarded && held.task) held.task();
 
-    // Atomically increment counter (next_in_queue is an atomic variable)
-    ++next_in_queue;
+  // Release the captures before anyone learns that the task completed
+  held.task.reset();
+  held.after_stream = nullptr;
 
-    // Signal to waiters
-    cv.notify_all();
+  ++next_in_queue;
 
+  if (next_in_queue > wake_at) {
+    wake_at = std::numeric_limits<I_t>::max();
+    completed.notify_all();
   }
 
-  return;
+  if (n_continuations > 0) fire_continuations();
+
+  return Progress::executed;
+
+}
+
+/** \brief            Submit a job to an executor once a ticket completed
+ *
+ *  If the ticket completed already, the job is submitted immediately.
+ *
+ *  \param[in]        ticket
+ *                    Ticket to wait for.
+ *
+ *  \param[in]        target
+ *                    Executor to submit the job to.
+ *
+ *  \param[in]        job
+ *                    The job.
+ *
+ *  \param[in]        job_priority
+ *                    OPTIONAL: priority to submit the job with. Default: 
+ *                    Threads::Priority::normal.
+ */
+inline void Stream::notify_when_done(I_t ticket, Threads::Executor& target,
+                                     Threads::Job job,
+                                     Threads::Priority job_priority) {
+
+  {
+
+    Threads::MutexLock registration_lock(continuation_lock);
+
+    // Announce before checking such that the consumer either sees the 
+    // announcement or we see its progress
+    ++n_continuations;
+
+    if (next_in_queue <= ticket) {
+      continuations.push_back({ticket, &target, job, job_priority});
+      return;
+    }
+
+    --n_continuations;
+
+  }
+
+  target.submit(job, job_priority);
+
+}
+
+inline void Stream::fire_continuations() {
+
+  Threads::MutexLock fire_lock(continuation_lock);
+
+  std::size_t kept = 0;
+  for (std::size_t i = 0; i < continuations.size(); ++i) {
+    auto& continuation = continuations[i];
+    if (continuation.ticket < next_in_queue) {
+      continuation.executor->submit(continuation.job, continuation.priority);
+      --n_continuations;
+    } else {
+      continuations[kept++] = continuation;
+    }
+  }
+  continuations.resize(kept);
 
 }
 #endif /* DOXYGEN_SKIP */
 
 /** \brief            Add a new task to the queue of the generic stream
+ *
+ *  If the queue is full, the calling thread waits until there is space. The 
+ *  queue of a stream not attached to the executor grows instead.
  *
  *  \param[in]        task
  *                    Functor to be put on the queue and processed
- *                    asynchronously.
+ *                    asynchronously (converted to a Threads::Task, which is 
+ *                    moved through the queue).
  *
  *  \returns          Ticket number of the task.
  */
-inline I_t Stream::add(std::function<void()> task) {
+inline I_t Stream::add(Threads::Task task) {
 
   PROFILING_FUNCTION_HEADER
 
-  I_t my_ticket;
+  return push({std::move(task), nullptr, 0});
 
-  if (synchronous || !thread_alive) {
+}
+
+/** \brief            Add several tasks at once
+ *
+ *  The tasks get consecutive tickets (no task added concurrently by another 
+ *  thread ends up in between) and are executed in the order given. Compared 
+ *  to calling add() for each task, the queue positions are claimed with one 
+ *  atomic operation and the runner is scheduled once.
+ *
+ *  \param[in]        tasks
+ *                    The tasks. For streams attached to the executor at 
+ *                    most as many as the queue holds 
+ *                    (LINALG_STREAM_QUEUE_SIZE).
+ *
+ *  \returns          The tickets of the first and the last task.
+ *
+ *  \example
+ *    std::vector<Threads::Task> updates;
+ *    for (auto& block : blocks) updates.emplace_back([&block]() { ... });
+ *    stream.sync(stream.add_batch(std::move(updates)).last);
+ */
+inline TicketRange Stream::add_batch(std::vector<Threads::Task> tasks) {
 
-    // No worker thread, no locking required
-    my_ticket = next_ticket;
+  PROFILING_FUNCTION_HEADER
+
+  auto n_tasks = tasks.size();
 
-    queue.push_front(task);
+  if (n_tasks == 0) {
+    auto claimed = I_t(queue.claimed());
+    return {claimed + 1, claimed};
+  }
 
-    ++next_ticket;
+  auto fill = [&tasks](Entry& entry, std::size_t i) {
+    entry.task         = std::move(tasks[i]);
+    entry.after_stream = nullptr;
+  };
 
+  std::size_t position;
+
+  if (synchronous || !thread_alive) {
+    Threads::MutexLock queue_registry_lock(queue_lock);
+    while (!queue.push_n(n_tasks, fill, position)) queue.reserve(n_tasks);
   } else {
+#ifndef LINALG_NO_CHECKS
+    if (n_tasks > queue.capacity()) {
+      throw excBadArgument("Stream::add_batch(): batch of %d tasks exceeds "
+                           "the queue size (%d, see LINALG_STREAM_QUEUE_SIZE)",
+                           int(n_tasks), int(queue.capacity()));
+    }
+#endif
+    while (!queue.push_n(n_tasks, fill, position)) make_room(n_tasks);
+  }
+
+  schedule_runner();
 
-    // Do the locking dance
+  return {I_t(position) + 1, I_t(position + n_tasks)};
 
-    { // RAII scope for adder_lock
+}
 
-      // Safely examine the condition. The lock prevents other threads to  
-      // modify it while we check the condition.
-      Threads::MutexLock adder_lock(lock);
+/** \brief            Add a new task that must not start before the given 
+ *                    events
+ *
+ *  Besides the dependencies, the task is ordered with respect to the other 
+ *  tasks of the stream as usual (i.e. the dependencies also hold back the 
+ *  tasks added later).
+ *
+ *  \param[in]        task
+ *                    Functor to be put on the queue and processed
+ *                    asynchronously.
+ *
+ *  \param[in]        dependencies
+ *                    Events (typically tickets of other streams) that need 
+ *                    to complete before the task starts.
+ *
+ *  \returns          Ticket number of the task.
+ *
+ *  \example
+ *    auto a = stream_a.add(inversion);
+ *    auto b = stream_b.add(receive);
+ *    stream_c.add(gemm, { Event(stream_a, a), Event(stream_b, b) });
+ */
+inline I_t Stream::add(Threads::Task task,
+                       const std::vector<Event>& dependencies) {
 
-      my_ticket = next_ticket;
+  PROFILING_FUNCTION_HEADER
 
-      queue.push_front(task);
+  for (const auto& event : dependencies) wait(event);
 
-      ++next_ticket;
+  return push({std::move(task), nullptr, 0});
 
-    } // Implicit release of adder_lock at the end of the scope block
+}
 
-    cv.notify_all();
+/** \brief            Make all tasks added after this call wait for an event
+ *
+ *  \param[in]        event
+ *                    Event to wait for, typically recorded on another stream. 
+ *                    Events of this stream and empty events are ignored.
+ *
+ *  \returns          Ticket that completes once the event completed.
+ */
+inline I_t Stream::wait(const Event& event) {
 
+  PROFILING_FUNCTION_HEADER
+
+  if (event.stream == nullptr || event.stream == this || event.done()) {
+    return I_t(queue.claimed());
+  }
+
+  return push({Threads::Task(), event.stream, event.ticket});
+
+}
+
+/** \brief            Add a task returning a value
+ *
+ *  \param[in]        function
+ *                    Callable without arguments, its result (or exception) 
+ *                    is stored in the returned future.
+ *
+ *  \param[in]        dependencies
+ *                    OPTIONAL: events that need to complete before the task 
+ *                    starts, see add().
+ *
+ *  \returns          Future for the result of the task.
+ */
+template <typename F>
+inline Future<typename std::result_of<typename std::decay<F>::type&()>::type>
+Stream::async(F&& function, const std::vector<Event>& dependencies) {
+
+  PROFILING_FUNCTION_HEADER
+
+  typedef typename std::decay<F>::type                      Function;
+  typedef typename std::result_of<Function&()>::type        Result;
+
+  Future<Result> future;
+  future.state = std::make_shared<FutureState<Result>>();
+
+  auto ticket = add(FutureTask<Result, Function>{future.state,
+                                                 std::forward<F>(function)},
+                    dependencies);
+
+  future.event = Event(*this, ticket);
+
+  return future;
+
+}
+/** \overload
+ */
+template <typename F>
+inline Future<typename std::result_of<typename std::decay<F>::type&()>::type>
+Stream::async(F&& function) {
+  return async(std::forward<F>(function), std::vector<Event>());
+}
+
+/** \brief            Event for all tasks added to the stream so far
+ */
+inline Event Stream::record() {
+  return Event(*this, I_t(queue.claimed()));
+}
+
+#ifndef DOXYGEN_SKIP
+// Append an entry to the queue and make sure a runner is scheduled
+inline I_t Stream::push(Entry&& entry) {
+
+  std::size_t position;
+
+  if (synchronous || !thread_alive) {
+    // No runner to wait for: allocate or grow the queue
+    Threads::MutexLock queue_registry_lock(queue_lock);
+    while (!queue.push(std::move(entry), position)) queue.reserve(1);
+  } else {
+    while (!queue.push(std::move(entry), position)) make_room(1);
+  }
+
+  schedule_runner();
+
+  return I_t(position) + 1;
+
+}
+
+// Called by producers of streams attached to the executor when the queue 
+// has no space for n entries
+inline void Stream::make_room(std::size_t n) {
+
+  // Wait for the runner, see sync_generic() for why workers don't help
+  Threads::BlockingRegion blocking;
+  while (queue.claimed() + n > queue.consumed() + queue.capacity()) {
+    Threads::yield();
   }
 
-  generic_synchronized = false;
+}
 
-  return my_ticket;
+// Make sure a runner is scheduled after pushing
+inline void Stream::schedule_runner() {
+
+  // Only one job per stream is on the executor at any time
+  if (!synchronous && thread_alive && !runner_scheduled.exchange(true)) {
+    executor->submit({&Stream::runner_wrapper, this}, priority);
+  }
 
 }
+#endif
 
 /** \brief            Synchronize with a specific task in the generic stream, 
  *                    i.e. wait for a specific task to be completed
  *
  *  \param[in]        ticket
- *                    'Ticket' number of the task to be processed.
+ *                    'Ticket' number of the task to be processed, 0 for all 
+ *                    tasks added so far.
  */
 inline void Stream::sync_generic(I_t ticket) {
 
   PROFILING_FUNCTION_HEADER
 
-  if (generic_synchronized) return;
+  if (ticket == 0) ticket = I_t(queue.claimed());
 
-  if (next_in_queue > ticket) {
+  if (next_in_queue > ticket) return;
 
-    return;
+  if (synchronous || !thread_alive) {
 
-  } else {
+    // Work off the queue in the current thread. Only one thread consumes at 
+    // a time, the others wait for it and take over if it stops short of 
+    // their ticket. Tasks synchronizing with their own stream continue 
+    // where the consumer is.
+    auto me = this_thread_tag();
+
+    // The outermost consumer hands over when done (or on exceptions)
+    struct Release {
+      Stream& stream;
+      bool    active;
+      ~Release() {
+        if (!active) return;
+        stream.drainer = nullptr;
+        stream.completed.notify_all();
+      }
+    };
 
-    if (synchronous || !thread_alive) {
+    while (next_in_queue <= ticket) {
 
-      // Work off the queue in the current thread (no locking required)
+      const void* none   = nullptr;
+      auto        nested = (drainer.load() == me);
 
-      std::function<void()> current_task;
+      if (nested || drainer.compare_exchange_strong(none, me)) {
+        Release release{*this, !nested};
+        while (next_in_queue <= ticket && run_next(true) != Progress::empty) {}
+        // Also if the ticket's task is still being added
+        return;
+      }
 
-      while (next_in_queue < ticket + 1) {
+      sleep_until(ticket, true);
 
-        current_task = queue.back();
-        current_task();
+    }
 
-        ++next_in_queue;
-        queue.pop_back();
+  } else {
 
-      }
+    if (sync_policy.wait_briefly([this, ticket]() {
+                                   return next_in_queue > ticket;
+                                 })) {
+      return;
+    }
 
-    } else {
+    sleep_until(ticket, false);
+
+  }
 
-      // Acquire the lock, check the condition, wait till next_in_queue is 
-      // larger than the requested ticket (release the lock in the mean time)
-      Threads::MutexLock sync_lock(lock);
-      cv.wait(sync_lock, [this, ticket](){ return next_in_queue > ticket; });
+}
 
+#ifndef DOXYGEN_SKIP
+// Sleep until the ticket completed or, if requested, nobody consumes the 
+// queue of a stream not attached to the executor
+inline void Stream::sleep_until(I_t ticket, bool or_drainer_leaves) {
+
+  // Called from within a task: a spare thread takes over our worker while 
+  // we sleep (the task we wait for might be queued behind us). Executing 
+  // other jobs here instead could nest waits that deadlock.
+  Threads::BlockingRegion blocking;
+
+  auto done = [this, ticket, or_drainer_leaves]() {
+    return next_in_queue > ticket ||
+           (or_drainer_leaves && drainer.load() == nullptr);
+  };
+
+  while (!done()) {
+
+    // Announce the wait before lowering wake_at: the runner resets wake_at 
+    // before notifying so a notification we miss here invalidates the key
+    auto key     = completed.prepare_wait();
+    auto current = wake_at.load();
+    while (ticket < current &&
+           !wake_at.compare_exchange_weak(current, ticket)) {}
+
+    if (done()) {
+      completed.cancel_wait();
+      break;
     }
 
+    completed.wait(key);
+
   }
 
-  if (ticket == next_in_queue - 1) generic_synchronized = true;
+}
+#endif
+
+
+/** \brief            Whether the event completed
+ */
+inline bool Event::done() const {
+  return stream == nullptr || stream->next_in_queue > ticket;
+}
+
+/** \brief            Wait for the event in the calling thread
+ */
+inline void Event::sync() const {
+  if (stream != nullptr) stream->sync_generic(ticket);
+}
+
+/** \brief            Wait for the task and return its result
+ *
+ *  Rethrows the exception if the task threw one. Can only be called once.
+ */
+template <typename R>
+inline R Future<R>::get() {
+
+  wait();
+
+  return state->take();
 
 }
 
@@ -0,0 +1,181 @@
+/** \file
+ *
+ *  \brief            Move-only callable with inline storage for Stream tasks
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_TASK_H_
+#define LINALG_TASK_H_
+
+#include <cstddef>      // std::size_t, std::max_align_t, std::nullptr_t
+#include <new>          // placement new
+#include <utility>      // std::move, std::forward
+#include <type_traits>  // std::decay, std::enable_if, std::is_same
+
+#include "preprocessor.h"
+#include "types.h"
+
+namespace LinAlg {
+
+namespace Threads {
+
+/** \brief            Type erased, move-only void() callable
+ *
+ *  Replaces std::function<void()> for the tasks of a Stream. Callables of up
+ *  to LINALG_TASK_INLINE_SIZE bytes (enough for a lambda capturing three
+ *  Dense<T> and two scalars as in xGEMM_async()) are stored inside the Task
+ *  itself, larger ones on the heap. As Tasks can't be copied, the captures
+ *  are moved from the caller into the stream's queue and from there to the
+ *  executing thread without touching the heap or any reference counts.
+ *
+ *  \example
+ *    Dense<D_t> A, B, C;
+ *    stream.add([=]() mutable { xGEMM(1.0, A, B, 0.0, C); });
+ */
+struct Task {
+
+  static const std::size_t inline_size = LINALG_TASK_INLINE_SIZE;
+
+  Task() : operations(nullptr) {}
+  Task(std::nullptr_t) : operations(nullptr) {}
+  template <typename F, typename = typename std::enable_if<
+                          !std::is_same<typename std::decay<F>::type,
+                                        Task>::value>::type>
+  Task(F&& function);
+  Task(Task&& other) noexcept;
+  Task& operator=(Task&& other) noexcept;
+  Task(const Task&) = delete;
+  Task& operator=(const Task&) = delete;
+  ~Task() { reset(); }
+
+  /// Execute the callable
+  inline void operator()() { operations->invoke(storage); }
+
+  /// Whether the task holds a callable
+  explicit operator bool() const { return operations != nullptr; }
+
+  /// Whether the callable is stored inline (as opposed to on the heap)
+  inline bool is_inline() const {
+    return operations != nullptr && !operations->on_heap;
+  }
+
+  inline void reset();
+
+#ifndef DOXYGEN_SKIP
+  // Type specific operations on the storage
+  struct Operations {
+    void (*invoke)(void* storage);
+    void (*move)(void* from, void* to);
+    void (*destroy)(void* storage);
+    bool on_heap;
+  };
+
+  template <typename F>
+  struct InlineStorage {
+    static void invoke(void* storage) { (*static_cast<F*>(storage))(); }
+    static void move(void* from, void* to) {
+      new (to) F(std::move(*static_cast<F*>(from)));
+      static_cast<F*>(from)->~F();
+    }
+    static void destroy(void* storage) { static_cast<F*>(storage)->~F(); }
+    static const Operations* operations() {
+      static const Operations table = { &invoke, &move, &destroy, false };
+      return &table;
+    }
+  };
+
+  template <typename F>
+  struct HeapStorage {
+    static void invoke(void* storage) { (**static_cast<F**>(storage))(); }
+    static void move(void* from, void* to) {
+      *static_cast<F**>(to) = *static_cast<F**>(from);
+    }
+    static void destroy(void* storage) { delete *static_cast<F**>(storage); }
+    static const Operations* operations() {
+      static const Operations table = { &invoke, &move, &destroy, true };
+      return &table;
+    }
+  };
+
+  template <typename Function, typename F>
+  inline const Operations* emplace(F&& function, std::true_type) {
+    new (storage) Function(std::forward<F>(function));
+    return InlineStorage<Function>::operations();
+  }
+  template <typename Function, typename F>
+  inline const Operations* emplace(F&& function, std::false_type) {
+    *reinterpret_cast<Function**>(storage) =
+                                      new Function(std::forward<F>(function));
+    return HeapStorage<Function>::operations();
+  }
+
+  const Operations* operations;
+  alignas(std::max_align_t) unsigned char storage[inline_size];
+#endif
+
+};
+
+/** \brief            Constructor from any callable
+ *
+ *  \param[in]        function
+ *                    Callable with signature void(). Rvalues are moved into
+ *                    the task.
+ */
+template <typename F, typename>
+Task::Task(F&& function) {
+
+  typedef typename std::decay<F>::type Function;
+
+  // Inline storage requires that moving can't fail as queues move tasks
+  // around
+  typedef std::integral_constant<bool,
+            sizeof(Function) <= inline_size &&
+            alignof(Function) <= alignof(std::max_align_t) &&
+            std::is_nothrow_move_constructible<Function>::value> fits_inline;
+
+  operations = emplace<Function>(std::forward<F>(function), fits_inline());
+
+}
+
+/** \brief            Move constructor, leaves other empty
+ */
+inline Task::Task(Task&& other) noexcept : operations(other.operations) {
+  if (operations != nullptr) {
+    operations->move(other.storage, storage);
+    other.operations = nullptr;
+  }
+}
+
+/** \brief            Move assignment, leaves other empty
+ */
+inline Task& Task::operator=(Task&& other) noexcept {
+  if (this != &other) {
+    reset();
+    operations = other.operations;
+    if (operations != nullptr) {
+      operations->move(other.storage, storage);
+      other.operations = nullptr;
+    }
+  }
+  return *this;
+}
+
+/** \brief            Destroy the callable (and its captures)
+ */
+inline void Task::reset() {
+  if (operations != nullptr) {
+    operations->destroy(storage);
+    operations = nullptr;
+  }
+}
+
+} /* namespace LinAlg::Threads */
+
+} /* namespace LinAlg */
+
+#endif /* LINALG_TASK_H_ */
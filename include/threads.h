@@ -15,16 +15,32 @@
 #ifndef LINALG_THREADS_H_
 #define LINALG_THREADS_H_
 
+#include <functional>   // std::function
+#include <vector>       // std::vector
+#include <atomic>       // std::atomic
+#include <climits>      // INT_MAX
+#include <cstdint>      // uint32_t
+#include <chrono>       // std::chrono::steady_clock
+
 #include "preprocessor.h"
+#include "types.h"
 
 #ifdef USE_POSIX_THREADS
 # include <pthread.h>
+# include <sched.h>     // sched_yield
+# include <unistd.h>    // sysconf
 #else // C++11 threading primitives
 # include <thread>
 # include <mutex>
 # include <condition_variable>
 #endif
 
+#ifdef __linux__
+# include <linux/futex.h> // FUTEX_WAIT_PRIVATE, FUTEX_WAKE_PRIVATE
+# include <sys/syscall.h> // SYS_futex
+# include <unistd.h>      // syscall
+#endif
+
 namespace LinAlg {
 
 namespace Threads {
@@ -122,19 +138,210 @@ struct ConditionVariable {
 # endif
   }
 
-  inline void wait(MutexLock lock, std::function<bool()> condition) {
+  inline void wait(MutexLock& lock, std::function<bool()> condition) {
   
     while (!condition()) pthread_cond_wait(&condition_variable, &(lock.mutex));
   
   }
 
-  inline void notify_all() { pthread_cond_signal(&condition_variable); }
+  inline void notify_one() { pthread_cond_signal(&condition_variable); }
+
+  inline void notify_all() { pthread_cond_broadcast(&condition_variable); }
 
 };
 #else
 typedef std::condition_variable ConditionVariable;
 #endif
 
+/** \brief            Give up the rest of the calling thread's time slice
+ */
+inline void yield() {
+#ifdef USE_POSIX_THREADS
+  sched_yield();
+#else
+  std::this_thread::yield();
+#endif
+}
+
+/** \brief            Number of hardware threads available to the process
+ */
+inline int hardware_threads() {
+
+#ifdef USE_POSIX_THREADS
+  auto n = sysconf(_SC_NPROCESSORS_ONLN);
+#else
+  auto n = std::thread::hardware_concurrency();
+#endif
+
+  return (n > 0) ? int(n) : 1;
+
+}
+
+/** \brief            Hint to the CPU that the calling thread is spinning
+ */
+inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  __asm__ __volatile__("yield");
+#endif
+}
+
+/** \brief            How a thread waits for a condition set by another 
+ *                    thread
+ *
+ *  Waiting proceeds in three phases: spin (with cpu_relax()) for up to 
+ *  spin_ns nanoseconds, then yield the processor for up to yield_ns 
+ *  nanoseconds, then sleep until notified. Spinning avoids the sleep/wake 
+ *  round trip (several microseconds) for short waits at the cost of 
+ *  occupying a core.
+ *
+ *  \example
+ *    stream.sync_policy = Threads::SyncPolicy::park();
+ *    stream.sync_policy = Threads::SyncPolicy(20000, 0); // spin up to 20us
+ */
+struct SyncPolicy {
+
+  SyncPolicy(long spin_ns_ = 0, long yield_ns_ = 0)
+    : spin_ns(spin_ns_), yield_ns(yield_ns_) {}
+
+  /// Sleep right away
+  static inline SyncPolicy park() { return SyncPolicy(0, 0); }
+
+  /// Spin up to spin_ns_ nanoseconds before sleeping (only pays off if the 
+  /// thread completing the work runs on another core)
+  static inline SyncPolicy spin(long spin_ns_ = 50000) {
+    return SyncPolicy(spin_ns_, 0);
+  }
+
+  /// Spin briefly (unless there is only one hardware thread, on which 
+  /// spinning can't succeed), yield a bit longer, then sleep
+  static inline SyncPolicy adaptive() {
+    static const bool single_thread = (hardware_threads() == 1);
+    return SyncPolicy(single_thread ? 0 : 2000, 20000);
+  }
+
+  /** \brief          Wait without sleeping for as long as the policy allows
+   *
+   *  \param[in]      done
+   *                  Callable returning true once the wait is over.
+   *
+   *  \returns        True if done() became true, false if the caller should 
+   *                  go to sleep.
+   */
+  template <typename Condition>
+  inline bool wait_briefly(Condition done) const {
+
+    if (done()) return true;
+    if (spin_ns <= 0 && yield_ns <= 0) return false;
+
+    typedef std::chrono::steady_clock clock;
+    auto start = clock::now();
+    auto since = [start]() {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                             clock::now() - start).count();
+    };
+
+    // Reading the clock costs about as much as a few dozen pause 
+    // instructions, so only check it now and then
+    while (spin_ns > 0) {
+      for (int i = 0; i < 64; ++i) {
+        if (done()) return true;
+        cpu_relax();
+      }
+      if (since() >= spin_ns) break;
+    }
+
+    while (since() < spin_ns + yield_ns) {
+      if (done()) return true;
+      yield();
+    }
+
+    return done();
+
+  }
+
+  long spin_ns;
+  long yield_ns;
+
+};
+
+/** \brief            Event count for targeted wakeups
+ *
+ *  Lets threads sleep until a condition they check themselves becomes true
+ *  without the notifying side having to take a lock. Waiters announce
+ *  themselves with prepare_wait(), recheck their condition and then either
+ *  cancel_wait() or wait(). Notifiers change the condition first and then
+ *  call notify_one() or notify_all(), which are a single atomic load if
+ *  nobody waits. On Linux the waiters sleep on a futex, elsewhere on a
+ *  condition variable.
+ *
+ *  \example
+ *    // waiter                                // notifier
+ *    while (!done) {                          done = true;
+ *      auto key = event.prepare_wait();       event.notify_all();
+ *      if (done) { event.cancel_wait(); break; }
+ *      event.wait(key);
+ *    }
+ */
+struct EventCount {
+
+  EventCount() : epoch(0), waiters(0) {}
+
+  inline uint32_t prepare_wait() {
+    ++waiters;
+    return epoch.load();
+  }
+
+  inline void cancel_wait() { --waiters; }
+
+  inline void wait(uint32_t key) {
+#ifdef __linux__
+    while (epoch.load() == key) {
+      syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch),
+              FUTEX_WAIT_PRIVATE, key, nullptr, nullptr, 0);
+    }
+#else
+    {
+      MutexLock wait_lock(lock);
+      condition_variable.wait(wait_lock, [this, key]() {
+        return epoch.load() != key;
+      });
+    }
+#endif
+    --waiters;
+  }
+
+  inline void notify_one() { if (waiters.load() > 0) notify(1); }
+
+  inline void notify_all() { if (waiters.load() > 0) notify(INT_MAX); }
+
+#ifndef DOXYGEN_SKIP
+  std::atomic<uint32_t> epoch;
+  std::atomic<int>      waiters;
+# ifndef __linux__
+  Mutex                 lock;
+  ConditionVariable     condition_variable;
+# endif
+
+  inline void notify(int count) {
+# ifdef __linux__
+    ++epoch;
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch),
+            FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+# else
+    {
+      MutexLock notify_lock(lock);
+      ++epoch;
+    }
+    if (count == 1) condition_variable.notify_one();
+    else            condition_variable.notify_all();
+# endif
+  }
+#endif
+
+};
+
 } /* namespace LinAlg::Utilities */
 
 } /* namespace LinAlg */
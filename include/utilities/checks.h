@@ -411,6 +411,44 @@ inline void check_same_dimensions(const Sparse<T>& A, const Sparse<U>& B,
 
 }
 
+/** \brief            Checks if a matrix is a vector (has one row or one
+ *                    column) of a given length. Throws an exception if not.
+ *
+ *  \param[in]        length
+ *                    Number of elements, negative values accept any length.
+ *
+ *  \param[in]        x
+ *                    Matrix to check.
+ *
+ *  \param[in]        caller_name
+ *                    Name of the calling routine.
+ */
+template <typename T>
+inline void check_vector(I_t length, const Dense<T>& x,
+                         const char* caller_name) {
+
+  if (x.rows() != 1 && x.cols() != 1) {
+
+    auto message = stringformat("%s: matrix is not a vector: is %dx%d",
+                                caller_name, x.rows(), x.cols());
+
+    throw excBadArgument(message);
+
+  }
+
+  auto x_length = (x.cols() == 1) ? x.rows() : x.cols();
+
+  if (length >= 0 && x_length != length) {
+
+    auto message = stringformat("%s: vector has wrong length: is %d, should "
+                                "be %d", caller_name, x_length, length);
+
+    throw excBadArgument(message);
+
+  }
+
+}
+
 /** \brief            Check if the thread of a stream is alive
  *
  *  \param[in]        stream
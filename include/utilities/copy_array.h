@@ -12,8 +12,17 @@
 #ifndef LINALG_UTILITIES_COPY_ARRAY_H_
 #define LINALG_UTILITIES_COPY_ARRAY_H_
 
+#include <algorithm>    // std::min, std::copy, std::swap
+#include <cmath>        // std::sqrt
+#include <utility>      // std::move
+#include <vector>       // std::vector
+
 #include "../preprocessor.h"
 
+#ifdef __AVX__
+# include <immintrin.h>
+#endif
+
 #ifdef HAVE_CUDA
 # include <cuda_runtime.h> // various CUDA routines
 # include "../CUDA/cuda_checks.h"  // checkCUDA, checkCUBLAS, checkCUSPARSE
@@ -23,6 +32,7 @@
 #include "../profiling.h"
 #include "../exceptions.h"
 #include "../streams.h"
+#include "../executor.h"
 #include "../BLAS/blas.h"
 
 namespace LinAlg {
@@ -265,7 +275,7 @@ I_t copy_1Darray_async(T* src_array, I_t length, T* dst_array,
 
     auto task = [=](){ copy_1Darray_host(src_array, length, dst_array); };
 
-    ticket = stream.add(task);
+    ticket = stream.add(std::move(task));
 
   }
 
@@ -349,6 +359,349 @@ I_t copy_1Darray_async(T* src_array, I_t length, T* dst_array,
 
 }
 
+#ifndef DOXYGEN_SKIP
+/*  Copies in main memory without MKL
+ *
+ *  All four combinations of source and destination format reduce to two
+ *  operations on column major views of the arrays: a RowMajor array is the
+ *  ColMajor view of its transpose. If the number of transpositions (the
+ *  requested one plus one per RowMajor array) is even, the views are copied
+ *  column by column, otherwise the destination view is the transpose of the
+ *  source view.
+ *
+ *  The transpose is done in square tiles that fit into L1 together with
+ *  their destination, the tiles in turn are transposed in W x W blocks
+ *  (in registers with AVX for S_t, D_t and C_t). Large arrays are split
+ *  into contiguous ranges of tiles (or columns), one per thread.
+ */
+
+// Transposes the W x W block src (column major) into dst: dst(j, i) =
+// src(i, j)
+template <typename T>
+struct TransposeKernel {
+
+  enum { W = 4 };
+
+  static inline void transpose(const T* src, I_t src_ld, T* dst,
+                               I_t dst_ld) {
+    for (int i = 0; i < W; ++i) {
+      for (int j = 0; j < W; ++j) dst[i * dst_ld + j] = src[j * src_ld + i];
+    }
+  }
+
+};
+
+# ifdef __AVX__
+template <>
+struct TransposeKernel<D_t> {
+
+  enum { W = 4 };
+
+  static inline void transpose(const D_t* src, I_t src_ld, D_t* dst,
+                               I_t dst_ld) {
+
+    auto r0 = _mm256_loadu_pd(src);
+    auto r1 = _mm256_loadu_pd(src + src_ld);
+    auto r2 = _mm256_loadu_pd(src + 2 * src_ld);
+    auto r3 = _mm256_loadu_pd(src + 3 * src_ld);
+
+    auto t0 = _mm256_unpacklo_pd(r0, r1);
+    auto t1 = _mm256_unpackhi_pd(r0, r1);
+    auto t2 = _mm256_unpacklo_pd(r2, r3);
+    auto t3 = _mm256_unpackhi_pd(r2, r3);
+
+    _mm256_storeu_pd(dst,              _mm256_permute2f128_pd(t0, t2, 0x20));
+    _mm256_storeu_pd(dst + dst_ld,     _mm256_permute2f128_pd(t1, t3, 0x20));
+    _mm256_storeu_pd(dst + 2 * dst_ld, _mm256_permute2f128_pd(t0, t2, 0x31));
+    _mm256_storeu_pd(dst + 3 * dst_ld, _mm256_permute2f128_pd(t1, t3, 0x31));
+
+  }
+
+};
+
+template <>
+struct TransposeKernel<S_t> {
+
+  enum { W = 8 };
+
+  static inline void transpose(const S_t* src, I_t src_ld, S_t* dst,
+                               I_t dst_ld) {
+
+    __m256 r[8], t[8], u[8];
+    for (int j = 0; j < 8; ++j) r[j] = _mm256_loadu_ps(src + j * src_ld);
+
+    for (int j = 0; j < 8; j += 2) {
+      t[j]     = _mm256_unpacklo_ps(r[j], r[j + 1]);
+      t[j + 1] = _mm256_unpackhi_ps(r[j], r[j + 1]);
+    }
+    for (int j = 0; j < 8; j += 4) {
+      u[j]     = _mm256_shuffle_ps(t[j],     t[j + 2], _MM_SHUFFLE(1,0,1,0));
+      u[j + 1] = _mm256_shuffle_ps(t[j],     t[j + 2], _MM_SHUFFLE(3,2,3,2));
+      u[j + 2] = _mm256_shuffle_ps(t[j + 1], t[j + 3], _MM_SHUFFLE(1,0,1,0));
+      u[j + 3] = _mm256_shuffle_ps(t[j + 1], t[j + 3], _MM_SHUFFLE(3,2,3,2));
+    }
+    for (int i = 0; i < 4; ++i) {
+      _mm256_storeu_ps(dst + i * dst_ld,
+                       _mm256_permute2f128_ps(u[i], u[i + 4], 0x20));
+      _mm256_storeu_ps(dst + (i + 4) * dst_ld,
+                       _mm256_permute2f128_ps(u[i], u[i + 4], 0x31));
+    }
+
+  }
+
+};
+
+// C_t has the size of a D_t, so the blocks can be moved as such
+template <>
+struct TransposeKernel<C_t> {
+
+  enum { W = 4 };
+
+  static inline void transpose(const C_t* src, I_t src_ld, C_t* dst,
+                               I_t dst_ld) {
+    TransposeKernel<D_t>::transpose(reinterpret_cast<const D_t*>(src), src_ld,
+                                    reinterpret_cast<D_t*>(dst), dst_ld);
+  }
+
+};
+# endif /* __AVX__ */
+
+// Transposes the m x n tile src (column major) into dst (n x m)
+template <typename T>
+inline void transpose_tile(I_t m, I_t n, const T* src, I_t src_ld, T* dst,
+                           I_t dst_ld) {
+
+  typedef TransposeKernel<T> Kernel;
+  const I_t W = Kernel::W;
+
+  auto m_full = m / W * W;
+  auto n_full = n / W * W;
+
+  for (I_t j = 0; j < n_full; j += W) {
+    for (I_t i = 0; i < m_full; i += W) {
+      Kernel::transpose(src + j * src_ld + i, src_ld, dst + i * dst_ld + j,
+                        dst_ld);
+    }
+    for (I_t i = m_full; i < m; ++i) {
+      for (I_t jj = j; jj < j + W; ++jj) {
+        dst[i * dst_ld + jj] = src[jj * src_ld + i];
+      }
+    }
+  }
+  for (I_t j = n_full; j < n; ++j) {
+    for (I_t i = 0; i < m; ++i) dst[i * dst_ld + j] = src[j * src_ld + i];
+  }
+
+}
+
+// Number of threads for copying elements in main memory (copies are bound
+// by the memory bandwidth, a few threads saturate it for large arrays only)
+inline int copy_2Darray_threads(I_t rows, I_t cols) {
+
+  const double min_elements_per_thread = 1 << 18;
+  auto max_threads = int(double(rows) * cols / min_elements_per_thread) + 1;
+
+  return std::min(Threads::hardware_threads(), max_threads);
+
+}
+
+// dst (n x m) = src**T (m x n), both column major
+template <typename T>
+inline void transpose_2Darray_host(I_t m, I_t n, const T* src, I_t src_ld,
+                                   T* dst, I_t dst_ld) {
+
+  PROFILING_FUNCTION_HEADER
+
+  const I_t tile = 32;
+  auto row_tiles = (m + tile - 1) / tile;
+  auto col_tiles = (n + tile - 1) / tile;
+
+  Threads::parallel_for(row_tiles * col_tiles, [&](I_t first, I_t last) {
+    for (auto t = first; t < last; ++t) {
+      auto row  = (t % row_tiles) * tile;
+      auto col  = (t / row_tiles) * tile;
+      auto rows = std::min(tile, m - row);
+      auto cols = std::min(tile, n - col);
+      transpose_tile(rows, cols, src + col * src_ld + row, src_ld,
+                     dst + row * dst_ld + col, dst_ld);
+    }
+  }, copy_2Darray_threads(m, n));
+
+}
+
+// dst (m x n) = src (m x n), both column major
+template <typename T>
+inline void copy_columns_host(I_t m, I_t n, const T* src, I_t src_ld,
+                              T* dst, I_t dst_ld) {
+
+  PROFILING_FUNCTION_HEADER
+
+  Threads::parallel_for(n, [&](I_t first, I_t last) {
+    for (auto col = first; col < last; ++col) {
+      std::copy(src + col * src_ld, src + col * src_ld + m,
+                dst + col * dst_ld);
+    }
+  }, copy_2Darray_threads(m, n));
+
+}
+
+// Host part of copy_2Darray() for all format combinations (rows and cols
+// are the dimensions of the source)
+template <typename T>
+inline void copy_2Darray_host(bool transpose, Format src_format,
+                              const T* src_array, I_t src_ld, I_t rows,
+                              I_t cols, Format dst_format, T* dst_array,
+                              I_t dst_ld) {
+
+  // Column major view of the source
+  auto m = (src_format == Format::ColMajor) ? rows : cols;
+  auto n = (src_format == Format::ColMajor) ? cols : rows;
+
+  auto transpositions = int(transpose) +
+                        int(src_format == Format::RowMajor) +
+                        int(dst_format == Format::RowMajor);
+
+  if (transpositions % 2 == 0) {
+    copy_columns_host(m, n, src_array, src_ld, dst_array, dst_ld);
+  } else {
+    transpose_2Darray_host(m, n, src_array, src_ld, dst_array, dst_ld);
+  }
+
+}
+#endif /* DOXYGEN_SKIP */
+
+#ifndef DOXYGEN_SKIP
+// In-place transpose of the n x n array (column major) in square tiles: the
+// tiles on the diagonal are transposed through a buffer, the pairs of tiles
+// (i, j) and (j, i) are swapped and transposed (one of them through the
+// buffer). The pairs are split over threads.
+template <typename T>
+inline void transpose_square_in_place(I_t n, T* array, I_t ld) {
+
+  PROFILING_FUNCTION_HEADER
+
+  const I_t tile = 32;
+  auto tiles = (n + tile - 1) / tile;
+  auto pairs = tiles * (tiles + 1) / 2;
+
+  Threads::parallel_for(pairs, [&](I_t first, I_t last) {
+
+    T buffer[tile * tile];
+
+    for (auto pair = first; pair < last; ++pair) {
+
+      // Pair index to (i, j) with i <= j (enumerating column by column)
+      auto j = I_t((std::sqrt(8.0 * pair + 1) - 1) / 2);
+      while (j * (j + 1) / 2 > pair) --j;
+      while ((j + 1) * (j + 2) / 2 <= pair) ++j;
+      auto i = pair - j * (j + 1) / 2;
+
+      auto row  = i * tile;
+      auto col  = j * tile;
+      auto rows = std::min(tile, n - row);
+      auto cols = std::min(tile, n - col);
+      auto upper = array + col * ld + row;
+      auto lower = array + row * ld + col;
+
+      // buffer = upper**T, upper = lower**T, lower = buffer
+      transpose_tile(rows, cols, upper, ld, buffer, tile);
+      if (i != j) transpose_tile(cols, rows, lower, ld, upper, ld);
+      for (I_t c = 0; c < rows; ++c) {
+        std::copy(buffer + c * tile, buffer + c * tile + cols,
+                  lower + c * ld);
+      }
+
+    }
+
+  }, copy_2Darray_threads(n, n));
+
+}
+
+// In-place transpose of the m x n array (column major, contiguous) into an
+// n x m array by following the cycles of the permutation. Element k = i + j
+// * m moves to k * n mod (m * n - 1). Visited elements are marked in a bit
+// vector, which is the only additional memory (m * n bits).
+template <typename T>
+inline void transpose_rectangular_in_place(I_t m, I_t n, T* array) {
+
+  PROFILING_FUNCTION_HEADER
+
+  typedef long long index_t;
+
+  auto size = index_t(m) * n;
+  auto last = size - 1;
+  std::vector<bool> visited(size, false);
+
+  for (index_t start = 1; start < last; ++start) {
+
+    if (visited[start]) continue;
+
+    // Move the elements of the cycle forward, starting with the element at
+    // start
+    auto value = array[start];
+    auto k = start;
+    do {
+      auto next = (k * n) % last;
+      std::swap(array[next], value);
+      visited[next] = true;
+      k = next;
+    } while (k != start);
+
+  }
+
+}
+#endif /* DOXYGEN_SKIP */
+
+/** \brief            In-place transpose of a 2D array in main memory
+ *
+ *  Transposes the column major m x n array into a column major n x m array
+ *  in the same memory. Square arrays are transposed in tiles (see
+ *  copy_2Darray()), rectangular arrays by following the cycles of the
+ *  permutation, which needs m * n bits of additional memory but accesses
+ *  memory irregularly. For a RowMajor array pass the dimensions of its
+ *  column major view (cols x rows).
+ *
+ *  \param[in]        m
+ *                    Number of rows of the array.
+ *
+ *  \param[in]        n
+ *                    Number of columns of the array.
+ *
+ *  \param[in,out]    array
+ *                    The array to transpose.
+ *
+ *  \param[in]        ld
+ *                    Leading dimension of the array. Must be m for
+ *                    rectangular arrays, the leading dimension of the
+ *                    transposed array is then n. Square arrays keep their
+ *                    leading dimension.
+ */
+template <typename T>
+inline void transpose_2Darray_in_place(I_t m, I_t n, T* array, I_t ld) {
+
+  PROFILING_FUNCTION_HEADER
+
+  if (m == 0 || n == 0) return;
+
+  if (m == n) {
+
+    transpose_square_in_place(n, array, ld);
+
+  } else {
+
+#ifndef LINALG_NO_CHECKS
+    if (ld != m) {
+      throw excBadArgument("transpose_2Darray_in_place(): rectangular arrays "
+                           "must be contiguous (ld = %d, m = %d)", ld, m);
+    }
+#endif
+
+    transpose_rectangular_in_place(m, n, array);
+
+  }
+
+}
+
 // Predeclaration of copy_2Darray_async() for use in copy_2Darray()
 template <typename T>
 I_t copy_2Darray_async(bool, Format, const T*, I_t, Location, int, I_t, I_t, 
@@ -401,6 +754,11 @@ I_t copy_2Darray_async(bool, Format, const T*, I_t, Location, int, I_t, I_t,
  *  \param[in]        dst_device_id
  *                    Device id of the output array.
  *
+ *  \note             In main memory without MKL, copies that change the
+ *                    layout are cache blocked (transposed in registers when
+ *                    compiling with -mavx or -march=native) and large
+ *                    copies use multiple threads.
+ *
  *  \note             While calls to copy_2Darray are synchronous, each call
  *                    involving cudaMemcpy or xGEAM creates its own stream 
  *                    such that if there are multiple threads calling
@@ -442,98 +800,21 @@ void copy_2Darray(bool transpose, Format src_format, const T* src_array,
 #endif
 
   // Copy in main memory: here we support all variants
-#ifdef HAVE_MKL
-  using LinAlg::BLAS::MKL::xomatcopy;
-#endif
   if (src_location == Location::host && dst_location == Location::host) {
 
-    if (src_format == Format::ColMajor && dst_format == Format::ColMajor) {
-
-      if (transpose) {
-#ifndef HAVE_MKL
-        for (I_t col = 0; col < cols; ++col) {
-          for (I_t row = 0; row < rows; ++row) {
-            dst_array[col * dst_ld + row] = src_array[row * src_ld + col];
-          }
-        }
-#else
-        xomatcopy('C', 'T', rows, cols, cast<T>(1.0), src_array, src_ld, 
-                  dst_array, dst_ld);
-#endif
-      } else {
-#ifndef HAVE_MKL
-        for (I_t col = 0; col < cols; ++col) {
-          for (I_t row = 0; row < rows; ++row) {
-            dst_array[col * dst_ld + row] = src_array[col * src_ld + row];
-          }
-        }
-#else
-        xomatcopy('C', 'N', rows, cols, cast<T>(1.0), src_array, src_ld, 
-                   dst_array, dst_ld);
+#ifdef HAVE_MKL
+    if (src_format == dst_format) {
+      using LinAlg::BLAS::MKL::xomatcopy;
+      auto ordering = (src_format == Format::ColMajor) ? 'C' : 'R';
+      xomatcopy(ordering, (transpose) ? 'T' : 'N', rows, cols, cast<T>(1.0),
+                src_array, src_ld, dst_array, dst_ld);
+      return;
+    }
 #endif
-      }
-
-    } else if (src_format == Format::RowMajor && 
-               dst_format == Format::ColMajor) {
 
-      if (transpose) {
-        for (I_t row = 0; row < rows; ++row) {
-          for (I_t col = 0; col < cols; ++col) {
-            dst_array[col * dst_ld + row] = src_array[col * src_ld + row];
-          }
-        }
-      } else {
-        for (I_t row = 0; row < rows; ++row) {
-          for (I_t col = 0; col < cols; ++col) {
-            dst_array[col * dst_ld + row] = src_array[row * src_ld + col];
-          }
-        }
-      }
+    copy_2Darray_host(transpose, src_format, src_array, src_ld, rows, cols,
+                      dst_format, dst_array, dst_ld);
 
-    } else if (src_format == Format::ColMajor && 
-               dst_format == Format::RowMajor) {
-
-      if (transpose) {
-        for (I_t col = 0; col < cols; ++col) {
-          for (I_t row = 0; row < rows; ++row) {
-            dst_array[row * dst_ld + col] = src_array[row * src_ld + col];
-          }
-        }
-      } else {
-        for (I_t col = 0; col < cols; ++col) {
-          for (I_t row = 0; row < rows; ++row) {
-            dst_array[row * dst_ld + col] = src_array[col * src_ld + row];
-          }
-        }
-      }
-
-    } else if (src_format == Format::RowMajor && 
-               dst_format == Format::RowMajor) {
-
-      if (transpose) {
-#ifndef HAVE_MKL
-        for (I_t row = 0; row < rows; ++row) {
-          for (I_t col = 0; col < cols; ++col) {
-            dst_array[row * dst_ld + col] = src_array[col * src_ld + row];
-          }
-        }
-#else
-        xomatcopy('R', 'T', rows, cols, cast<T>(1.0), src_array, src_ld, 
-                  dst_array, dst_ld);
-#endif
-      } else {
-#ifndef HAVE_MKL
-        for (I_t row = 0; row < rows; ++row) {
-          for (I_t col = 0; col < cols; ++col) {
-            dst_array[row * dst_ld + col] = src_array[row * src_ld + col];
-          }
-        }
-#else
-        xomatcopy('R', 'N', rows, cols, cast<T>(1.0), src_array, src_ld, 
-                  dst_array, dst_ld);
-#endif
-      }
-    }
   }
 
 #ifdef HAVE_CUDA
@@ -716,7 +997,7 @@ I_t copy_2Darray_async(bool transpose, Format src_format, const T* src_array,
                    dst_location, dst_device_id);
     };
 
-    ticket = stream.add(task);
+    ticket = stream.add(std::move(task));
 
   }
 
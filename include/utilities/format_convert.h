@@ -13,6 +13,8 @@
 #define LINALG_UTILITIES_FORMAT_CONVERT_H_
 
 #include <tuple>      // std::tie
+#include <vector>     // std::vector
+#include <algorithm>  // std::max, std::fill_n
 
 #include "../preprocessor.h"
 #include "../types.h"
@@ -20,6 +22,8 @@
 #include "../exceptions.h"
 #include "../dense.h"
 #include "../sparse.h"
+#include "../dia.h"
+#include "../banded.h"
 #include "../fills.h"
 #include "checks.h"
 #include "../streams.h"
@@ -688,6 +692,242 @@ inline void realimag2complex(const Dense<T>& R, const Dense<T>& I,
   realimag2complex(cast<T>(1.0), R, I, cast<U>(0.0), C);
 }
 
+
+////////////////////////////
+// CSR -> DIA, CSR -> banded
+
+/** \brief            Convert a CSR matrix to diagonal (DIA) storage
+ *
+ *  All diagonals containing at least one stored element are stored. The
+ *  diagonals are ordered by increasing offset.
+ *
+ *  \param[in]        source
+ *                    The sparse matrix to convert (Format::CSR, in main
+ *                    memory).
+ *
+ *  \param[out]       destination
+ *                    DIA matrix to store the result in, will be reallocated.
+ *                    The number of columns is the number of rows of the
+ *                    source unless there are elements stored beyond that.
+ */
+template <typename T>
+inline void sparse2dia_host(const Sparse<T>& source, DIA<T>& destination) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_format(Format::CSR, source, "sparse2dia_host()");
+  if (source._transposed) {
+    throw excUnimplemented("sparse2dia_host(): conversion from transposed "
+                           "sparse matrices is not supported.");
+  }
+  if (source._location != Location::host) {
+    throw excUnimplemented("sparse2dia_host(): only matrices in main memory "
+                           "are supported");
+  }
+#endif
+
+  auto rows        = source._size;
+  auto first_index = source._first_index;
+  auto edges       = source._edges.get();
+  auto indices     = source._indices.get();
+  auto values      = source._values.get();
+
+  I_t cols = rows;
+  for (I_t i = 0; i < source._n_nonzeros; ++i) {
+    cols = std::max(cols, indices[i] - first_index + 1);
+  }
+
+  // Mark occupied diagonals, offset k is stored at position k + rows - 1
+  std::vector<I_t> diagonal_of(rows + cols - 1, -1);
+  for (I_t row = 0; row < rows; ++row) {
+    for (auto index = edges[row] - first_index;
+         index < edges[row + 1] - first_index; ++index) {
+      diagonal_of[indices[index] - first_index - row + rows - 1] = 0;
+    }
+  }
+
+  I_t n_diagonals = 0;
+  for (auto& diagonal : diagonal_of) {
+    if (diagonal == 0) diagonal = n_diagonals++;
+  }
+
+  destination.reallocate(rows, cols, n_diagonals);
+
+  auto offsets   = destination._offsets._begin();
+  auto dia_data  = destination._values._begin();
+  auto dia_ld    = destination._values._leading_dimension;
+
+  for (I_t k = 0; k < rows + cols - 1; ++k) {
+    if (diagonal_of[k] >= 0) offsets[diagonal_of[k]] = k - (rows - 1);
+  }
+
+  std::fill_n(dia_data, dia_ld * n_diagonals, cast<T>(0.0));
+
+  for (I_t row = 0; row < rows; ++row) {
+    for (auto index = edges[row] - first_index;
+         index < edges[row + 1] - first_index; ++index) {
+      auto col      = indices[index] - first_index;
+      auto diagonal = diagonal_of[col - row + rows - 1];
+      dia_data[diagonal * dia_ld + row] += values[index];
+    }
+  }
+
+}
+
+/** \brief            Convert a square CSR matrix to LAPACK general banded
+ *                    (GB) storage
+ *
+ *  The number of sub- and superdiagonals is determined from the stored
+ *  elements.
+ *
+ *  \param[in]        source
+ *                    The sparse matrix to convert (Format::CSR, in main
+ *                    memory, square).
+ *
+ *  \param[out]       destination
+ *                    Banded matrix to store the result in, will be
+ *                    reallocated.
+ */
+template <typename T>
+inline void sparse2banded_host(const Sparse<T>& source,
+                               Banded<T>& destination) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_format(Format::CSR, source, "sparse2banded_host()");
+  if (source._transposed) {
+    throw excUnimplemented("sparse2banded_host(): conversion from transposed "
+                           "sparse matrices is not supported.");
+  }
+  if (source._location != Location::host) {
+    throw excUnimplemented("sparse2banded_host(): only matrices in main "
+                           "memory are supported");
+  }
+#endif
+
+  auto n           = source._size;
+  auto first_index = source._first_index;
+  auto edges       = source._edges.get();
+  auto indices     = source._indices.get();
+  auto values      = source._values.get();
+
+  I_t kl = 0;
+  I_t ku = 0;
+  for (I_t row = 0; row < n; ++row) {
+    for (auto index = edges[row] - first_index;
+         index < edges[row + 1] - first_index; ++index) {
+      auto col = indices[index] - first_index;
+#ifndef LINALG_NO_CHECKS
+      if (col >= n) {
+        throw excBadArgument("sparse2banded_host(): source matrix must be "
+                             "square");
+      }
+#endif
+      kl = std::max(kl, row - col);
+      ku = std::max(ku, col - row);
+    }
+  }
+
+  destination.reallocate(n, kl, ku);
+
+  Fills::zero(destination._values);
+
+  for (I_t row = 0; row < n; ++row) {
+    for (auto index = edges[row] - first_index;
+         index < edges[row + 1] - first_index; ++index) {
+      auto col = indices[index] - first_index;
+      *destination._element(row, col) += values[index];
+    }
+  }
+
+}
+
+
+////////////////////
+// CSR transposition
+
+/** \brief            Transpose a CSR matrix in main memory
+ *
+ *  AT <- A^T   or   AT <- A^H
+ *
+ *  The result has sorted column indices. Optionally, the position in A of
+ *  each element of AT is returned, which allows to update the values of AT
+ *  when only the values of A change.
+ *
+ *  \param[in]        A
+ *                    Format::CSR.
+ *
+ *  \param[in]        A_cols
+ *                    Number of columns of A.
+ *
+ *  \param[out]       AT
+ *                    Matrix for the result, reallocated (C-style indexing).
+ *
+ *  \param[in]        conjugate
+ *                    OPTIONAL: whether to conjugate the values. Default:
+ *                    false.
+ *
+ *  \param[out]       source_position
+ *                    OPTIONAL: if not nullptr, resized and set such that
+ *                    AT._values[k] = A._values[source_position[k]]
+ *                    (conjugated if requested). Default: nullptr.
+ */
+template <typename T>
+inline void csr_transpose_host(const Sparse<T>& A, I_t A_cols, Sparse<T>& AT,
+                               bool conjugate = false,
+                               std::vector<I_t>* source_position = nullptr) {
+
+  PROFILING_FUNCTION_HEADER
+
+#ifndef LINALG_NO_CHECKS
+  check_format(Format::CSR, A, "csr_transpose_host()");
+  if (A._location != Location::host) {
+    throw excUnimplemented("csr_transpose_host(): only matrices in main "
+                           "memory are supported");
+  }
+#endif
+
+  auto rows        = A._size;
+  auto n_nonzeros  = A._n_nonzeros;
+  auto first_index = A._first_index;
+  auto edges       = A._edges.get();
+  auto indices     = A._indices.get();
+  auto values      = A._values.get();
+
+  Sparse<T> result(A_cols, n_nonzeros, 0);
+  auto T_edges   = result._edges.get();
+  auto T_indices = result._indices.get();
+  auto T_values  = result._values.get();
+
+  if (source_position != nullptr) source_position->resize(n_nonzeros);
+
+  std::fill_n(T_edges, A_cols + 1, 0);
+  for (I_t i = 0; i < n_nonzeros; ++i) ++T_edges[indices[i] - first_index + 1];
+  for (I_t col = 0; col < A_cols; ++col) T_edges[col + 1] += T_edges[col];
+
+  // Walking A row by row yields sorted indices in each row of AT
+  std::vector<I_t> next(T_edges, T_edges + A_cols);
+  for (I_t row = 0; row < rows; ++row) {
+    for (auto index = edges[row] - first_index;
+         index < edges[row + 1] - first_index; ++index) {
+      auto position = next[indices[index] - first_index]++;
+      T_indices[position] = row;
+      T_values[position]  = conjugate ? conj(values[index]) : values[index];
+      if (source_position != nullptr) {
+        (*source_position)[position] = index;
+      }
+    }
+  }
+
+  result._minimal_index = 0;
+  result._maximal_index = rows;
+
+  swap(result, AT);
+
+}
+
 #ifdef HAVE_CUDA
 /** \brief            Routine to convert a CSR matrix to a dense matrix in 
  *                    Format::ColMajor on a GPU
@@ -33,6 +33,9 @@ template <typename T>
 void copy_2Darray(bool, Format, const T*, I_t, Location, int, I_t, I_t, Format,
                   T*, I_t, Location, int);
 
+template <typename T>
+inline void transpose_2Darray_in_place(I_t, I_t, T*, I_t);
+
 template <typename T, typename U>
 void reallocate_like(Dense<T>&, const Dense<U>&, SubBlock, Location, int);
 
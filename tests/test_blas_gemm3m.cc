@@ -0,0 +1,130 @@
+/** \file             test_blas_gemm3m.cc
+ *
+ *  \brief            Test for LinAlg::BLAS::NATIVE::xGEMM3M and
+ *                    LinAlg::BLAS::xGEMM3M (compares with the BLAS library
+ *                    and reports the time of the 3M product, the native
+ *                    conventional product and the library)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <linalg.h>
+
+#include "test_helpers.h"
+
+using namespace std;
+using namespace LinAlg;
+
+// Maximal deviation between the 3M product and the library GEMM
+template <typename T>
+double deviation(char transa, char transb, int m, int n, int k, T beta) {
+
+  // Storage large enough for either transposition
+  int lda = max(m, k) + 1, ldb = max(k, n) + 3, ldc = m + 2;
+
+  vector<T> A(lda * max(m, k)), B(ldb * max(k, n)), C(ldc * n);
+  for (auto& a : A) a = random_value<T>();
+  for (auto& b : B) b = random_value<T>();
+  for (auto& c : C) c = random_value<T>();
+  auto reference = C;
+  auto alpha     = random_value<T>();
+
+  BLAS::NATIVE::xGEMM3M(transa, transb, m, n, k, alpha, A.data(), lda,
+                        B.data(), ldb, beta, C.data(), ldc);
+  BLAS::FORTRAN::xGEMM(transa, transb, m, n, k, alpha, A.data(), lda,
+                       B.data(), ldb, beta, reference.data(), ldc);
+
+  return max_difference(C, reference);
+
+}
+
+template <typename T>
+bool test(const char* name, double tolerance) {
+
+  double max_deviation = 0;
+  for (auto transa : { 'N', 'T', 'C' }) {
+    for (auto transb : { 'N', 'T', 'C' }) {
+      for (auto beta : { cast<T>(0.0), random_value<T>() }) {
+        for (int size : { 1, 7, 33, 300 }) {
+          auto d = deviation<T>(transa, transb, size, size + 5, size + 2,
+                                beta);
+          if (d > max_deviation) max_deviation = d;
+        }
+      }
+    }
+  }
+
+  // The binding for Dense<T>
+  int n = 70;
+  vector<T> a(n * n), b(n * n), c(n * n), c_reference(n * n);
+  for (auto& x : a) x = random_value<T>();
+  for (auto& x : b) x = random_value<T>();
+  Dense<T> A(a.data(), n, n, n), B(b.data(), n, n, n);
+  Dense<T> C(c.data(), n, n, n), C_reference(c_reference.data(), n, n, n);
+  A.transpose();
+  BLAS::xGEMM3M(cast<T>(1.0), A, B, cast<T>(0.0), C);
+  BLAS::xGEMM(cast<T>(1.0), A, B, cast<T>(0.0), C_reference);
+  max_deviation = max(max_deviation, max_difference(c, c_reference));
+
+  return report(name, "GEMM3M", max_deviation, tolerance);
+
+}
+
+template <typename T>
+void benchmark(const char* name, int n) {
+
+  const int repetitions = 3;
+
+  vector<T> A(n * n), B(n * n), C(n * n);
+  for (auto& a : A) a = random_value<T>();
+  for (auto& b : B) b = random_value<T>();
+
+  auto start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) {
+    BLAS::NATIVE::xGEMM3M('N', 'N', n, n, n, cast<T>(1.0), A.data(), n,
+                          B.data(), n, cast<T>(0.0), C.data(), n);
+  }
+  auto gemm3m = milliseconds_since(start, repetitions);
+
+  start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) {
+    BLAS::NATIVE::xGEMM('N', 'N', n, n, n, cast<T>(1.0), A.data(), n,
+                        B.data(), n, cast<T>(0.0), C.data(), n);
+  }
+  auto native = milliseconds_since(start, repetitions);
+
+  start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) {
+    BLAS::FORTRAN::xGEMM('N', 'N', n, n, n, cast<T>(1.0), A.data(), n,
+                         B.data(), n, cast<T>(0.0), C.data(), n);
+  }
+  auto library = milliseconds_since(start, repetitions);
+
+  printf("%sGEMM %4dx%4d: 3M %8.2f ms, native %8.2f ms, library %8.2f ms\n",
+         name, n, n, gemm3m, native, library);
+
+}
+
+int main(int argc, char* argv[]) {
+
+  auto passed = test<C_t>("C", 1e-3) &&
+                test<Z_t>("Z", 1e-10);
+
+  for (int n : { 256, 1024 }) {
+    benchmark<C_t>("C", n);
+    benchmark<Z_t>("Z", n);
+  }
+
+  return passed ? 0 : 1;
+
+}
@@ -0,0 +1,209 @@
+/** \file             test_blas_gemm_batched.cc
+ *
+ *  \brief            Test for LinAlg::BLAS::xGEMM_batched and
+ *                    xGEMM_strided_batched and their native implementations
+ *                    (compares with one library GEMM per product and reports
+ *                    the performance of both)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <functional>
+#include <algorithm>
+
+#include <linalg.h>
+
+#include "test_helpers.h"
+
+using namespace std;
+using namespace LinAlg;
+
+// Products of different sizes (around the register blocking of the small
+// kernels, some transposed) with xGEMM_batched() or NATIVE::xGEMM_batched()
+template <typename T>
+double deviation_batched(bool native) {
+
+  int sizes[][3] = { {1, 1, 1}, {2, 3, 4}, {8, 8, 8}, {16, 16, 16},
+                     {17, 9, 5}, {24, 40, 32}, {33, 7, 64}, {100, 90, 110} };
+
+  vector<Dense<T>> A, B, C;
+  int product = 0;
+  for (auto& size : sizes) {
+    for (int transposed = 0; transposed < 2; ++transposed, ++product) {
+      if (transposed) {
+        A.push_back(random_matrix<T>(size[2], size[0]));
+        A.back().transpose();
+      } else {
+        A.push_back(random_matrix<T>(size[0], size[2]));
+      }
+      if (product % 3 == 0) {
+        B.push_back(random_matrix<T>(size[1], size[2]));
+        B.back().transpose();
+      } else {
+        B.push_back(random_matrix<T>(size[2], size[1]));
+      }
+      C.push_back(random_matrix<T>(size[0], size[1]));
+    }
+  }
+
+  vector<vector<T>> reference;
+  for (auto& c : C) {
+    reference.emplace_back(c._begin(), c._begin() + c.rows() * c.cols());
+  }
+  auto alpha = random_value<T>();
+  auto beta  = random_value<T>();
+
+  if (native) BLAS::NATIVE::xGEMM_batched(alpha, A, B, beta, C);
+  else        BLAS::xGEMM_batched(alpha, A, B, beta, C);
+
+  double deviation = 0;
+  for (size_t i = 0; i < C.size(); ++i) {
+    BLAS::FORTRAN::xGEMM(A[i]._transposed ? 'T' : 'N',
+                         B[i]._transposed ? 'T' : 'N', C[i].rows(),
+                         C[i].cols(), A[i].cols(), alpha, A[i]._begin(),
+                         A[i]._leading_dimension, B[i]._begin(),
+                         B[i]._leading_dimension, beta, reference[i].data(),
+                         C[i].rows());
+    auto d = max_difference(C[i]._begin(), reference[i].data(),
+                            reference[i].size());
+    if (d > deviation) deviation = d;
+  }
+
+  return deviation;
+
+}
+
+// xGEMM_strided_batched() (or the native one) with padded leading dimensions
+// and strides
+template <typename T>
+double deviation_strided(char transa, char transb, int m, int n, int k,
+                         int batch, bool native) {
+
+  int lda = ((transa == 'N') ? m : k) + 1;
+  int ldb = ((transb == 'N') ? k : n) + 1;
+  int ldc = m + 1;
+  int stride_a = lda * ((transa == 'N') ? k : m) + 3;
+  int stride_b = ldb * ((transb == 'N') ? n : k) + 3;
+  int stride_c = ldc * n + 3;
+
+  vector<T> A(stride_a * batch), B(stride_b * batch), C(stride_c * batch);
+  for (auto& a : A) a = random_value<T>();
+  for (auto& b : B) b = random_value<T>();
+  for (auto& c : C) c = random_value<T>();
+  auto reference = C;
+  auto alpha     = random_value<T>();
+  auto beta      = random_value<T>();
+
+  if (native) {
+    BLAS::NATIVE::xGEMM_strided_batched(transa, transb, m, n, k, alpha,
+                                        A.data(), lda, stride_a, B.data(),
+                                        ldb, stride_b, beta, C.data(), ldc,
+                                        stride_c, batch);
+  } else {
+    BLAS::xGEMM_strided_batched(transa, transb, m, n, k, alpha, A.data(),
+                                lda, stride_a, B.data(), ldb, stride_b, beta,
+                                C.data(), ldc, stride_c, batch);
+  }
+  for (int i = 0; i < batch; ++i) {
+    BLAS::FORTRAN::xGEMM(transa, transb, m, n, k, alpha,
+                         A.data() + i * stride_a, lda,
+                         B.data() + i * stride_b, ldb, beta,
+                         reference.data() + i * stride_c, ldc);
+  }
+
+  return max_difference(C, reference);
+
+}
+
+template <typename T>
+bool test(const char* name, const char* transpositions, double tolerance) {
+
+  int sizes[][3] = { {4, 4, 4}, {16, 16, 16}, {19, 11, 23}, {64, 64, 64} };
+
+  double deviation = 0;
+  for (bool native : { false, true }) {
+    auto d = deviation_batched<T>(native);
+    if (d > deviation) deviation = d;
+    for (auto transa = transpositions; *transa; ++transa) {
+      for (auto transb = transpositions; *transb; ++transb) {
+        for (auto& size : sizes) {
+          d = deviation_strided<T>(*transa, *transb, size[0], size[1],
+                                   size[2], 13, native);
+          if (d > deviation) deviation = d;
+        }
+      }
+    }
+  }
+
+  return report(name, "GEMM_batched", deviation, tolerance);
+
+}
+
+// Time for a batch of n x n products, batched and with one library call per
+// product
+template <typename T>
+void benchmark(const char* name, int n, int batch) {
+
+  vector<T> A(n * n * batch), B(n * n * batch), C(n * n * batch);
+  for (auto& a : A) a = random_value<T>();
+  for (auto& b : B) b = random_value<T>();
+
+  // Best of a few runs such that neither variant pays for warming up
+  auto gflops = [n, batch](const function<void()>& run) {
+    double best = 0;
+    for (int repetition = 0; repetition < 3; ++repetition) {
+      auto start = chrono::steady_clock::now();
+      run();
+      auto elapsed = chrono::steady_clock::now() - start;
+      best = max(best, 2.0 * n * n * n * batch /
+                       chrono::duration<double, nano>(elapsed).count());
+    }
+    return best;
+  };
+
+  auto batched = gflops([&]() {
+    BLAS::xGEMM_strided_batched('N', 'N', n, n, n, cast<T>(1.0), A.data(), n,
+                                n * n, B.data(), n, n * n, cast<T>(0.0),
+                                C.data(), n, n * n, batch);
+  });
+
+  auto library = gflops([&]() {
+    for (int i = 0; i < batch; ++i) {
+      BLAS::FORTRAN::xGEMM('N', 'N', n, n, n, cast<T>(1.0),
+                           A.data() + i * n * n, n, B.data() + i * n * n, n,
+                           cast<T>(0.0), C.data() + i * n * n, n);
+    }
+  });
+
+  printf("%sGEMM_batched %d x %dx%d: batched %6.2f GFlop/s, library %6.2f "
+         "GFlop/s\n", name, batch, n, n, batched, library);
+
+}
+
+int main(int argc, char* argv[]) {
+
+  int batch = (argc > 1) ? atoi(argv[1]) : 4096;
+
+  auto passed = test<S_t>("S", "NT", 1e-3) &&
+                test<D_t>("D", "NT", 1e-10) &&
+                test<C_t>("C", "NTC", 1e-3) &&
+                test<Z_t>("Z", "NTC", 1e-10);
+
+  for (int n : {16, 32, 64, 128}) {
+    benchmark<S_t>("S", n, batch / (n / 16));
+    benchmark<D_t>("D", n, batch / (n / 16));
+  }
+  benchmark<Z_t>("Z", 16, batch);
+
+  return passed ? 0 : 1;
+
+}
@@ -0,0 +1,145 @@
+/** \file             test_blas_gemm_fixed.cc
+ *
+ *  \brief            Test for LinAlg::BLAS::NATIVE::xGEMM_fixed and SmallGEMM
+ *                    (compares with the BLAS library and reports the time per
+ *                    product of both)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <linalg.h>
+
+#include "test_helpers.h"
+
+using namespace std;
+using namespace LinAlg;
+
+// Maximal deviation between the fixed size kernel and the library GEMM for
+// an m x n x k product, -1 if there is no kernel for the sizes
+template <typename T>
+double deviation(char transa, char transb, int m, int n, int k, T beta) {
+
+  // Leading dimensions with padding, large enough for either transposition
+  int ld = max(max(m, n), k) + 2;
+
+  vector<T> A(ld * ld), B(ld * ld), C(ld * n);
+  for (auto& a : A) a = random_value<T>();
+  for (auto& b : B) b = random_value<T>();
+  for (auto& c : C) c = random_value<T>();
+  auto reference = C;
+  auto alpha     = random_value<T>();
+
+  if (!BLAS::NATIVE::xGEMM_fixed(transa, transb, m, n, k, alpha, A.data(), ld,
+                                 B.data(), ld, beta, C.data(), ld)) {
+    return -1;
+  }
+  BLAS::FORTRAN::xGEMM(transa, transb, m, n, k, alpha, A.data(), ld,
+                       B.data(), ld, beta, reference.data(), ld);
+
+  return max_difference(C, reference);
+
+}
+
+template <typename T>
+bool test(const char* name, const char* transpositions, double tolerance) {
+
+  double max_deviation = 0;
+  bool   dispatched    = true;
+  for (auto transa = transpositions; *transa; ++transa) {
+    for (auto transb = transpositions; *transb; ++transb) {
+      for (int m = 1; m <= LINALG_FIXED_GEMM_MAX; ++m) {
+        for (int n = 1; n <= LINALG_FIXED_GEMM_MAX; ++n) {
+          for (int k = 1; k <= LINALG_FIXED_GEMM_MAX; ++k) {
+            for (auto beta : { cast<T>(0.0), random_value<T>() }) {
+              auto d = deviation<T>(*transa, *transb, m, n, k, beta);
+              if (d < 0) dispatched = false;
+              if (d > max_deviation) max_deviation = d;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // A non-square kernel used directly
+  int m = 3, n = 5, k = 9;
+  vector<T> A(m * k), B(k * n), C(m * n), reference(m * n);
+  for (auto& a : A) a = random_value<T>();
+  for (auto& b : B) b = random_value<T>();
+  BLAS::NATIVE::SmallGEMM<T, 3, 5, 9>::multiply('N', 'N', cast<T>(1.0),
+                                                A.data(), m, B.data(), k,
+                                                cast<T>(0.0), C.data(), m);
+  BLAS::FORTRAN::xGEMM('N', 'N', m, n, k, cast<T>(1.0), A.data(), m, B.data(),
+                       k, cast<T>(0.0), reference.data(), m);
+  max_deviation = max(max_deviation, max_difference(C, reference));
+
+  // No kernel if any size is larger
+  if (BLAS::NATIVE::xGEMM_fixed('N', 'N', LINALG_FIXED_GEMM_MAX + 1, 1, 1,
+                                cast<T>(1.0), A.data(), m, B.data(), k,
+                                cast<T>(0.0), C.data(), m) ||
+      BLAS::NATIVE::xGEMM_fixed('N', 'N', 1, 1, LINALG_FIXED_GEMM_MAX + 1,
+                                cast<T>(1.0), A.data(), m, B.data(), k,
+                                cast<T>(0.0), C.data(), m)) {
+    dispatched = false;
+  }
+  if (!dispatched) printf("%sGEMM_fixed: wrong dispatch (FAILED)\n", name);
+
+  return report(name, "GEMM_fixed", max_deviation, tolerance) && dispatched;
+
+}
+
+template <typename T>
+void benchmark(const char* name, int n) {
+
+  const int repetitions = 100000;
+
+  vector<T> A(n * n), B(n * n), C(n * n);
+  for (auto& a : A) a = random_value<T>();
+  for (auto& b : B) b = random_value<T>();
+
+  Dense<T> A_dense(A.data(), n, n, n);
+  Dense<T> B_dense(B.data(), n, n, n);
+  Dense<T> C_dense(C.data(), n, n, n);
+
+  auto start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) multiply(A_dense, B_dense, C_dense);
+  auto fixed = 1e6 * milliseconds_since(start, repetitions);
+
+  start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) {
+    BLAS::FORTRAN::xGEMM('N', 'N', n, n, n, cast<T>(1.0), A.data(), n,
+                         B.data(), n, cast<T>(0.0), C.data(), n);
+  }
+  auto library = 1e6 * milliseconds_since(start, repetitions);
+
+  printf("%sGEMM %2dx%2d: multiply() %7.1f ns, library %7.1f ns\n", name, n, n,
+         fixed, library);
+
+}
+
+int main(int argc, char* argv[]) {
+
+  auto passed = test<S_t>("S", "NT", 1e-4) &&
+                test<D_t>("D", "NT", 1e-12) &&
+                test<C_t>("C", "NTC", 1e-4) &&
+                test<Z_t>("Z", "NTC", 1e-12);
+
+  for (int n : { 2, 3, 4, 8 }) {
+    benchmark<S_t>("S", n);
+    benchmark<D_t>("D", n);
+    benchmark<Z_t>("Z", n);
+  }
+
+  return passed ? 0 : 1;
+
+}
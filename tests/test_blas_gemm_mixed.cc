@@ -0,0 +1,184 @@
+/** \file             test_blas_gemm_mixed.cc
+ *
+ *  \brief            Test for LinAlg::BLAS::NATIVE::xGEMM_mixed, the mixed
+ *                    type BLAS::xGEMM and multiply() (compares with the
+ *                    complex GEMM of the BLAS library on the operands
+ *                    converted to complex and reports the time of the native
+ *                    product, of BLAS::xGEMM, of the split into work_T and
+ *                    of complex x real multiply())
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <linalg.h>
+
+#include "test_helpers.h"
+
+using namespace std;
+using namespace LinAlg;
+
+// Maximal deviation between xGEMM_mixed and the library's complex GEMM with
+// the real operand converted to complex (A is real if real_A, B otherwise)
+template <typename R, typename U>
+double deviation(bool real_A, char transa, char transb, int m, int n, int k,
+                 U beta) {
+
+  // Storage large enough for either transposition
+  int lda = max(m, k) + 1, ldb = max(k, n) + 3, ldc = m + 2;
+
+  vector<U> A(lda * max(m, k)), B(ldb * max(k, n)), C(ldc * n);
+  for (auto& a : A) a = real_A ? cast<U>(real(random_value<U>()), 0.0)
+                               : random_value<U>();
+  for (auto& b : B) b = real_A ? random_value<U>()
+                               : cast<U>(real(random_value<U>()), 0.0);
+  for (auto& c : C) c = random_value<U>();
+  auto reference = C;
+  auto alpha     = random_value<U>();
+
+  vector<R> real_operand;
+  for (auto& x : (real_A ? A : B)) real_operand.push_back(real(x));
+
+  if (real_A) {
+    BLAS::NATIVE::xGEMM_mixed(transa, transb, m, n, k, alpha,
+                              real_operand.data(), lda, B.data(), ldb, beta,
+                              C.data(), ldc);
+  } else {
+    BLAS::NATIVE::xGEMM_mixed(transa, transb, m, n, k, alpha, A.data(), lda,
+                              real_operand.data(), ldb, beta, C.data(), ldc);
+  }
+  BLAS::FORTRAN::xGEMM(transa, transb, m, n, k, alpha, A.data(), lda,
+                       B.data(), ldb, beta, reference.data(), ldc);
+
+  return max_difference(C, reference);
+
+}
+
+template <typename R, typename U>
+bool test(const char* name, double tolerance) {
+
+  double max_deviation = 0;
+  for (auto real_A : { true, false }) {
+    for (auto transa : { 'N', 'T', 'C' }) {
+      for (auto transb : { 'N', 'T', 'C' }) {
+        for (auto beta : { cast<U>(0.0), random_value<U>() }) {
+          for (int size : { 1, 7, 33, 300 }) {
+            auto d = deviation<R, U>(real_A, transa, transb, size, size + 5,
+                                     size + 2, beta);
+            if (d > max_deviation) max_deviation = d;
+          }
+        }
+      }
+    }
+  }
+
+  // multiply() on Dense matrices, both orders of the operands
+  int n = 50;
+  vector<R> a_real(n * n);
+  vector<U> a(n * n), b(n * n), c(n * n), c_reference(n * n);
+  for (int i = 0; i < n * n; ++i) {
+    a_real[i] = real(random_value<U>());
+    a[i]      = cast<U>(a_real[i], 0.0);
+    b[i]      = random_value<U>();
+  }
+  Dense<R> A_real(a_real.data(), n, n, n);
+  Dense<U> A(a.data(), n, n, n), B(b.data(), n, n, n);
+  Dense<U> C(c.data(), n, n, n), C_reference(c_reference.data(), n, n, n);
+
+  auto compare = [&]() {
+    max_deviation = max(max_deviation, max_difference(c, c_reference));
+  };
+  multiply(A_real, B, C);
+  multiply(A, B, C_reference);
+  compare();
+  multiply(B, A_real, C);
+  multiply(B, A, C_reference);
+  compare();
+
+  // BLAS::xGEMM with real A, also with transposed operands
+  auto alpha = random_value<U>(), beta = random_value<U>();
+  for (auto transpose_A : { false, true }) {
+    for (auto transpose_B : { false, true }) {
+      if (transpose_A) { A_real.transpose(); A.transpose(); }
+      if (transpose_B) B.transpose();
+      for (auto& x : c) x = random_value<U>();
+      c_reference = c;
+      BLAS::xGEMM(alpha, A_real, B, beta, C);
+      BLAS::xGEMM(alpha, A, B, beta, C_reference);
+      compare();
+      if (transpose_A) { A_real.transpose(); A.transpose(); }
+      if (transpose_B) B.transpose();
+    }
+  }
+
+  return report(name, "GEMM_mixed", max_deviation, tolerance);
+
+}
+
+template <typename R, typename U>
+void benchmark(const char* name, int n) {
+
+  const int repetitions = 5;
+
+  vector<R> a(n * n);
+  vector<U> b(n * n), c(n * n);
+  for (auto& x : a) x = real(random_value<U>());
+  for (auto& x : b) x = random_value<U>();
+
+  Dense<R> A(a.data(), n, n, n);
+  Dense<U> B(b.data(), n, n, n), C(c.data(), n, n, n);
+
+  auto start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) {
+    BLAS::NATIVE::xGEMM_mixed(cast<U>(1.0), A, B, cast<U>(0.0), C);
+  }
+  auto native = milliseconds_since(start, repetitions);
+
+  start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) {
+    BLAS::xGEMM(cast<U>(1.0), A, B, cast<U>(0.0), C);
+  }
+  auto blas = milliseconds_since(start, repetitions);
+
+  // The split into real and imaginary parts used on other locations
+  Dense<R> work_T;
+  multiply(cast<R>(1.0), A, B, cast<U>(0.0), C, work_T);
+  start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) {
+    multiply(cast<R>(1.0), A, B, cast<U>(0.0), C, work_T);
+  }
+  auto split = milliseconds_since(start, repetitions);
+
+  // Complex x real as one real product of the library
+  start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) multiply(B, A, C);
+  auto view = milliseconds_since(start, repetitions);
+
+  printf("%sGEMM_mixed %4dx%4d: native %8.2f ms, BLAS::xGEMM %8.2f ms, "
+         "with work_T %8.2f ms, complex x real multiply() %8.2f ms\n", name, n,
+         n, native, blas, split, view);
+
+}
+
+int main(int argc, char* argv[]) {
+
+  auto passed = test<S_t, C_t>("C", 1e-3) &&
+                test<D_t, Z_t>("Z", 1e-10);
+
+  for (int n : { 256, 1024 }) {
+    benchmark<S_t, C_t>("C", n);
+    benchmark<D_t, Z_t>("Z", n);
+  }
+
+  return passed ? 0 : 1;
+
+}
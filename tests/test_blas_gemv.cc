@@ -0,0 +1,203 @@
+/** \file             test_blas_gemv.cc
+ *
+ *  \brief            Test for the Level-1/Level-2 bindings LinAlg::BLAS::xGEMV,
+ *                    xDOT, xDOTC, xNRM2, xSCAL, xGER, xGERC and xAXPBY and the
+ *                    dispatch of multiply() to xGEMV (compares with reference
+ *                    loops and reports the time of multiply() for a
+ *                    matrix-vector product with and without xGEMV)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <linalg.h>
+
+#include "test_helpers.h"
+
+using namespace std;
+using namespace LinAlg;
+
+template <typename T>
+bool test(const char* name, double tolerance) {
+
+  int m = 37, n = 53, ld = 41;
+
+  // x and y are stored as row vectors with leading dimension ld (stride ld
+  // in memory), z is a column vector
+  vector<T> a(m * n), x(ld * n), y(ld * m), z(n);
+  for (auto& v : a) v = random_value<T>();
+  for (auto& v : x) v = random_value<T>();
+  for (auto& v : y) v = random_value<T>();
+  for (auto& v : z) v = random_value<T>();
+
+  auto alpha = random_value<T>(), beta = random_value<T>();
+
+  Dense<T> A(a.data(), m, m, n), A_T(a.data(), m, m, n);
+  A_T.transpose();
+  Dense<T> X(x.data(), ld, 1, n), Z(z.data(), n, n, 1);
+
+  double max_deviation = 0;
+  auto check = [&](double difference) {
+    if (difference > max_deviation) max_deviation = difference;
+  };
+
+  // y = alpha * A * x + beta * y with strided x and y, and z = A**T * y
+  // through multiply() with a row vector result
+  {
+    auto result = y, reference = y;
+    Dense<T> Y(result.data(), ld, 1, m);
+    BLAS::xGEMV(alpha, A, X, beta, Y);
+    for (int i = 0; i < m; ++i) {
+      T sum = cast<T>(0.0);
+      for (int j = 0; j < n; ++j) sum += a[i + j * m] * x[j * ld];
+      reference[i * ld] = alpha * sum + beta * y[i * ld];
+    }
+    check(max_difference(result, reference));
+
+    vector<T> result_z(n), reference_z(n);
+    Dense<T> Y_T(result.data(), ld, 1, m), R(result_z.data(), n, n, 1);
+    Y_T.transpose();
+    BLAS::xGEMV(cast<T>(1.0), A_T, Y_T, cast<T>(0.0), R);
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < m; ++i) {
+        reference_z[j] += a[i + j * m] * result[i * ld];
+      }
+    }
+    check(max_difference(result_z, reference_z));
+
+    // (row vector) = (row vector) * A
+    vector<T> result_row(ld * n, cast<T>(0.0));
+    Dense<T> Row(result_row.data(), ld, 1, n);
+    multiply(Y, A, Row);
+    for (int j = 0; j < n; ++j) result_z[j] = result_row[j * ld];
+    check(max_difference(result_z, reference_z));
+
+    // Column vector through multiply()
+    vector<T> result_col(m), reference_col(m);
+    Dense<T> Col(result_col.data(), m, m, 1);
+    multiply(A, Z, Col);
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < n; ++j) reference_col[i] += a[i + j * m] * z[j];
+    }
+    check(max_difference(result_col, reference_col));
+  }
+
+  // Dot products and norm of the strided x and the contiguous z
+  {
+    T dot = cast<T>(0.0), dotc = cast<T>(0.0);
+    double norm = 0;
+    for (int j = 0; j < n; ++j) {
+      dot  += x[j * ld] * z[j];
+      dotc += LinAlg::conj(x[j * ld]) * z[j];
+      norm += abs(x[j * ld]) * abs(x[j * ld]);
+    }
+    norm = sqrt(norm);
+
+    check(abs(BLAS::xDOT(X, Z) - dot));
+    check(abs(BLAS::xDOTC(X, Z) - dotc));
+    check(abs(BLAS::xNRM2(X) - norm));
+
+    Stream stream;
+    stream.start_thread();
+    T result;
+    typename RealType<T>::type result_norm;
+    BLAS::xDOTC_async(X, Z, result, stream);
+    BLAS::xNRM2_async(X, result_norm, stream);
+    stream.sync();
+    check(abs(result - dotc));
+    check(abs(result_norm - norm));
+  }
+
+  // z = alpha * x + beta * z, x = alpha * x and A = alpha * y * x**T + A
+  // (and x**H)
+  {
+    auto result = z, reference = z;
+    Dense<T> R(result.data(), n, n, 1);
+    BLAS::xAXPBY(alpha, X, beta, R);
+    for (int j = 0; j < n; ++j) reference[j] = alpha * x[j * ld] + beta * z[j];
+    check(max_difference(result, reference));
+
+    auto result_x = x, reference_x = x;
+    Dense<T> R_X(result_x.data(), ld, 1, n);
+    Stream stream;
+    stream.start_thread();
+    BLAS::xSCAL_async(alpha, R_X, stream);
+    stream.sync();
+    for (int j = 0; j < n; ++j) reference_x[j * ld] = alpha * x[j * ld];
+    check(max_difference(result_x, reference_x));
+
+    Dense<T> Y(y.data(), ld, 1, m);
+    for (int conjugate = 0; conjugate < 2; ++conjugate) {
+      auto result_a = a, reference_a = a;
+      Dense<T> R_A(result_a.data(), m, m, n);
+      if (conjugate) {
+        BLAS::xGERC(alpha, Y, X, R_A);
+      } else {
+        BLAS::xGER(alpha, Y, X, R_A);
+      }
+      for (int j = 0; j < n; ++j) {
+        auto x_j = (conjugate) ? LinAlg::conj(x[j * ld]) : x[j * ld];
+        for (int i = 0; i < m; ++i) {
+          reference_a[i + j * m] += alpha * y[i * ld] * x_j;
+        }
+      }
+      check(max_difference(result_a, reference_a));
+    }
+  }
+
+  return report(name, "GEMV/DOT/NRM2/SCAL/GER/AXPBY", max_deviation,
+                tolerance);
+
+}
+
+template <typename T>
+void benchmark(const char* name, int n) {
+
+  const int repetitions = 20;
+
+  vector<T> a(n * n), x(n), y(n);
+  for (auto& v : a) v = random_value<T>();
+  for (auto& v : x) v = random_value<T>();
+
+  Dense<T> A(a.data(), n, n, n), X(x.data(), n, n, 1), Y(y.data(), n, n, 1);
+
+  auto start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) multiply(A, X, Y);
+  auto gemv = milliseconds_since(start, repetitions);
+
+  start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) {
+    BLAS::xGEMM(cast<T>(1.0), A, X, cast<T>(0.0), Y);
+  }
+  auto gemm = milliseconds_since(start, repetitions);
+
+  printf("%sGEMV %4dx%4d: multiply(A, x) %8.3f ms, xGEMM %8.3f ms\n", name,
+         n, n, gemv, gemm);
+
+}
+
+int main(int argc, char* argv[]) {
+
+  auto passed = test<S_t>("S", 1e-3) &&
+                test<D_t>("D", 1e-10) &&
+                test<C_t>("C", 1e-3) &&
+                test<Z_t>("Z", 1e-10);
+
+  for (int n : { 256, 2048 }) {
+    benchmark<D_t>("D", n);
+    benchmark<Z_t>("Z", n);
+  }
+
+  return passed ? 0 : 1;
+
+}
@@ -0,0 +1,117 @@
+/** \file             test_blas_native_gemm.cc
+ *
+ *  \brief            Test for LinAlg::BLAS::NATIVE::xGEMM (compares with the 
+ *                    BLAS library and reports the performance of both)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <linalg.h>
+
+#include "test_helpers.h"
+
+using namespace std;
+using namespace LinAlg;
+
+// Maximal deviation between the native and the library GEMM
+template <typename T>
+double deviation(char transa, char transb, int m, int n, int k) {
+
+  int lda = ((transa == 'N') ? m : k) + 1;
+  int ldb = ((transb == 'N') ? k : n) + 1;
+  int ldc = m + 1;
+
+  vector<T> A(lda * ((transa == 'N') ? k : m));
+  vector<T> B(ldb * ((transb == 'N') ? n : k));
+  vector<T> C(ldc * n);
+  for (auto& a : A) a = random_value<T>();
+  for (auto& b : B) b = random_value<T>();
+  for (auto& c : C) c = random_value<T>();
+  auto reference = C;
+  auto alpha     = random_value<T>();
+  auto beta      = random_value<T>();
+
+  BLAS::NATIVE::xGEMM(transa, transb, m, n, k, alpha, A.data(), lda,
+                      B.data(), ldb, beta, C.data(), ldc);
+  BLAS::FORTRAN::xGEMM(transa, transb, m, n, k, alpha, A.data(), lda,
+                       B.data(), ldb, beta, reference.data(), ldc);
+
+  return max_difference(C, reference);
+
+}
+
+template <typename T>
+bool test(const char* name, const char* transpositions, double tolerance) {
+
+  // Sizes around the register and cache blocking
+  int sizes[][3] = { {1, 1, 1}, {7, 5, 3}, {17, 13, 9}, {33, 29, 300},
+                     {100, 1, 50}, {1, 100, 50}, {130, 70, 513} };
+
+  double max_deviation = 0;
+  for (auto transa = transpositions; *transa; ++transa) {
+    for (auto transb = transpositions; *transb; ++transb) {
+      for (auto& size : sizes) {
+        auto d = deviation<T>(*transa, *transb, size[0], size[1], size[2]);
+        if (d > max_deviation) max_deviation = d;
+      }
+    }
+  }
+
+  return report(name, "GEMM", max_deviation, tolerance);
+
+}
+
+template <typename T>
+void benchmark(const char* name, int n) {
+
+  vector<T> A(n * n), B(n * n), C(n * n);
+  for (auto& a : A) a = random_value<T>();
+  for (auto& b : B) b = random_value<T>();
+
+  auto gflops = [n](chrono::steady_clock::time_point start) {
+    auto elapsed = chrono::steady_clock::now() - start;
+    return 2.0 * n * n * n / chrono::duration<double, nano>(elapsed).count();
+  };
+
+  auto start = chrono::steady_clock::now();
+  BLAS::NATIVE::xGEMM('N', 'N', n, n, n, cast<T>(1.0), A.data(), n, B.data(),
+                      n, cast<T>(0.0), C.data(), n);
+  auto native = gflops(start);
+
+  start = chrono::steady_clock::now();
+  BLAS::FORTRAN::xGEMM('N', 'N', n, n, n, cast<T>(1.0), A.data(), n,
+                       B.data(), n, cast<T>(0.0), C.data(), n);
+  auto library = gflops(start);
+
+  printf("%sGEMM %dx%d: native %6.2f GFlop/s, library %6.2f GFlop/s\n", name,
+         n, n, native, library);
+
+}
+
+int main(int argc, char* argv[]) {
+
+  int n = (argc > 1) ? atoi(argv[1]) : 1000;
+
+  auto passed = test<S_t>("S", "NT", 1e-3) &&
+                test<D_t>("D", "NT", 1e-10) &&
+                test<C_t>("C", "NTC", 1e-3) &&
+                test<Z_t>("Z", "NTC", 1e-10);
+
+  benchmark<S_t>("S", n);
+  benchmark<D_t>("D", n);
+  benchmark<C_t>("C", n);
+  benchmark<Z_t>("Z", n);
+
+  return passed ? 0 : 1;
+
+}
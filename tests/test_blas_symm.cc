@@ -0,0 +1,190 @@
+/** \file             test_blas_symm.cc
+ *
+ *  \brief            Test for LinAlg::BLAS::xSYMM, xHEMM, xSYRK, xHERK and
+ *                    the dispatch of multiply() to them (compares with the
+ *                    GEMM of the BLAS library and reports the time of
+ *                    multiply(A, A**T) with and without xSYRK)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <linalg.h>
+
+#include "test_helpers.h"
+
+using namespace std;
+using namespace LinAlg;
+
+template <typename T>
+bool test(const char* name, double tolerance) {
+
+  int m = 37, n = 53, k = 29;
+
+  // S is symmetric, H is hermitian (real diagonal), both n x n
+  vector<T> s(n * n), h(n * n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i <= j; ++i) {
+      s[i + j * n] = s[j + i * n] = random_value<T>();
+      h[i + j * n] = random_value<T>();
+      h[j + i * n] = LinAlg::conj(h[i + j * n]);
+    }
+    h[j + j * n] = cast<T>(real(h[j + j * n]), 0.0);
+  }
+  vector<T> a(m * n), b(n * m), x(n * k), c(m * n);
+  for (auto& v : a) v = random_value<T>();
+  for (auto& v : b) v = random_value<T>();
+  for (auto& v : x) v = random_value<T>();
+  for (auto& v : c) v = random_value<T>();
+
+  auto alpha = random_value<T>(), beta = random_value<T>();
+
+  Dense<T> S(s.data(), n, n, n), H(h.data(), n, n, n);
+  Dense<T> A(a.data(), m, m, n), B(b.data(), n, n, m), X(x.data(), n, n, k);
+  Dense<T> X_T(x.data(), n, n, k);
+  X_T.transpose();
+  S.set(Property::symmetric);
+  if (!std::is_same<T, S_t>::value && !std::is_same<T, D_t>::value) {
+    H.set(Property::hermitian);
+  }
+
+  double max_deviation = 0;
+  auto check = [&](const vector<T>& result, const vector<T>& reference) {
+    auto d = max_difference(result, reference);
+    if (d > max_deviation) max_deviation = d;
+  };
+
+  // C = alpha * A * S + beta * C and C = alpha * S * B + beta * C, both
+  // through multiply() and through the bindings with the other triangle
+  {
+    auto result = c, reference = c;
+    Dense<T> C(result.data(), m, m, n);
+    multiply(alpha, A, S, beta, C);
+    BLAS::FORTRAN::xGEMM('N', 'N', m, n, n, alpha, a.data(), m, s.data(), n,
+                         beta, reference.data(), m);
+    check(result, reference);
+
+    result = c;
+    BLAS::xSYMM(Side::right, UPLO::lower, alpha, S, A, beta, C);
+    check(result, reference);
+  }
+  {
+    vector<T> result(n * m), reference(n * m);
+    Dense<T> C(result.data(), n, n, m);
+    multiply(alpha, S, B, cast<T>(0.0), C);
+    BLAS::FORTRAN::xGEMM('N', 'N', n, m, n, alpha, s.data(), n, b.data(), n,
+                         cast<T>(0.0), reference.data(), n);
+    check(result, reference);
+  }
+
+  // Same with the hermitian matrix (xSYMM for real types)
+  {
+    auto result = c, reference = c;
+    Dense<T> C(result.data(), m, m, n);
+    BLAS::xHEMM(Side::right, UPLO::lower, alpha, H, A, beta, C);
+    BLAS::FORTRAN::xGEMM('N', 'N', m, n, n, alpha, a.data(), m, h.data(), n,
+                         beta, reference.data(), m);
+    check(result, reference);
+
+    if (H.is(Property::hermitian)) {
+      result = c;
+      multiply(alpha, A, H, beta, C);
+      check(result, reference);
+    }
+  }
+
+  // C = alpha * X * X**T (+ beta * C if C is symmetric) through multiply()
+  // and C = alpha * X**T * X through xSYRK() on the transposed view
+  {
+    vector<T> result(n * n), reference(n * n);
+    Dense<T> C(result.data(), n, n, n);
+    multiply(alpha, X, X_T, cast<T>(0.0), C);
+    BLAS::FORTRAN::xGEMM('N', 'T', n, n, k, alpha, x.data(), n, x.data(), n,
+                         cast<T>(0.0), reference.data(), n);
+    check(result, reference);
+
+    result = s, reference = s;
+    C.set(Property::symmetric);
+    multiply(alpha, X, X_T, beta, C);
+    BLAS::FORTRAN::xGEMM('N', 'T', n, n, k, alpha, x.data(), n, x.data(), n,
+                         beta, reference.data(), n);
+    check(result, reference);
+
+    vector<T> result_k(k * k), reference_k(k * k);
+    Dense<T> C_k(result_k.data(), k, k, k);
+    BLAS::xSYRK(UPLO::upper, alpha, X_T, cast<T>(0.0), C_k);
+    BLAS::FORTRAN::xGEMM('T', 'N', k, k, n, alpha, x.data(), n, x.data(), n,
+                         cast<T>(0.0), reference_k.data(), k);
+    for (int j = 0; j < k; ++j) {
+      for (int i = j + 1; i < k; ++i) reference_k[i + j * k] = cast<T>(0.0);
+    }
+    check(result_k, reference_k);
+  }
+
+  // C = 2 * X * X**H + 0.5 * C on the lower triangle through xHERK()
+  {
+    auto result = h, reference = h;
+    Dense<T> C(result.data(), n, n, n);
+    BLAS::xHERK(UPLO::lower, 2.0, X, 0.5, C);
+    BLAS::FORTRAN::xGEMM('N', 'C', n, n, k, cast<T>(2.0), x.data(), n,
+                         x.data(), n, cast<T>(0.5), reference.data(), n);
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < j; ++i) reference[i + j * n] = h[i + j * n];
+    }
+    check(result, reference);
+  }
+
+  return report(name, "SYMM/HEMM/SYRK/HERK", max_deviation, tolerance);
+
+}
+
+template <typename T>
+void benchmark(const char* name, int n) {
+
+  const int repetitions = 5;
+
+  vector<T> a(n * n), c(n * n);
+  for (auto& x : a) x = random_value<T>();
+
+  Dense<T> A(a.data(), n, n, n), A_T(a.data(), n, n, n), C(c.data(), n, n, n);
+  A_T.transpose();
+
+  auto start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) multiply(A, A_T, C);
+  auto syrk = milliseconds_since(start, repetitions);
+
+  start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) {
+    BLAS::xGEMM(cast<T>(1.0), A, A_T, cast<T>(0.0), C);
+  }
+  auto gemm = milliseconds_since(start, repetitions);
+
+  printf("%sSYRK %4dx%4d: multiply(A, A**T) %8.2f ms, xGEMM %8.2f ms\n", name,
+         n, n, syrk, gemm);
+
+}
+
+int main(int argc, char* argv[]) {
+
+  auto passed = test<S_t>("S", 1e-3) &&
+                test<D_t>("D", 1e-10) &&
+                test<C_t>("C", 1e-3) &&
+                test<Z_t>("Z", 1e-10);
+
+  for (int n : { 256, 1024 }) {
+    benchmark<D_t>("D", n);
+    benchmark<Z_t>("Z", n);
+  }
+
+  return passed ? 0 : 1;
+
+}
@@ -0,0 +1,183 @@
+/** \file             test_blas_trmm.cc
+ *
+ *  \brief            Test for LinAlg::BLAS::xTRMM and LinAlg::LAPACK::xTRTRI
+ *                    (compares xTRMM with the GEMM of the BLAS library on the
+ *                    zero padded triangle, checks that A * A**-1 is the
+ *                    identity and reports the time of both against GEMM and
+ *                    GETRF/GETRI)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <linalg.h>
+
+#include "test_helpers.h"
+
+using namespace std;
+using namespace LinAlg;
+
+// Random n x n triangular matrix with a dominant diagonal, the other
+// triangle is zero
+template <typename T>
+vector<T> triangular(int n, UPLO uplo) {
+  vector<T> a(n * n, cast<T>(0.0));
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < n; ++i) {
+      if ((uplo == UPLO::lower) ? (i > j) : (i < j)) {
+        a[i + j * n] = random_value<T>();
+      }
+    }
+    a[j + j * n] = cast<T>(double(n), 0.0) + random_value<T>();
+  }
+  return a;
+}
+
+template <typename T>
+bool test(const char* name, double tolerance) {
+
+  int m = 41, n = 29;
+  double max_deviation = 0;
+
+  Stream stream;
+  stream.start_thread();
+
+  for (auto side : { Side::left, Side::right }) {
+    for (auto uplo : { UPLO::lower, UPLO::upper }) {
+      for (auto transposed : { false, true }) {
+
+        auto size = (side == Side::left) ? m : n;
+        auto a    = triangular<T>(size, uplo);
+        vector<T> b(m * n);
+        for (auto& x : b) x = random_value<T>();
+        auto result = b, result_async = b;
+        vector<T> reference(m * n);
+        auto alpha = random_value<T>();
+
+        Dense<T> A(a.data(), size, size, size);
+        Dense<T> B(result.data(), m, m, n);
+        Dense<T> B_async(result_async.data(), m, m, n);
+        if (transposed) A.transpose();
+
+        BLAS::xTRMM(side, uplo, Diag::non_unit, alpha, A, B);
+        BLAS::xTRMM_async(side, uplo, Diag::non_unit, alpha, A, B_async,
+                          stream);
+        stream.sync();
+
+        auto trans = transposed ? 'T' : 'N';
+        if (side == Side::left) {
+          BLAS::FORTRAN::xGEMM(trans, 'N', m, n, m, alpha, a.data(), m,
+                               b.data(), m, cast<T>(0.0), reference.data(),
+                               m);
+        } else {
+          BLAS::FORTRAN::xGEMM('N', trans, m, n, n, alpha, b.data(), m,
+                               a.data(), n, cast<T>(0.0), reference.data(),
+                               m);
+        }
+
+        max_deviation = max({ max_deviation,
+                              max_difference(result, reference),
+                              max_difference(result_async, reference) });
+
+      }
+    }
+  }
+
+  // A * A**-1 = 1 with the inverse from xTRTRI and the product from xTRMM
+  for (auto uplo : { UPLO::lower, UPLO::upper }) {
+
+    auto a = triangular<T>(n, uplo), a_inverse = a;
+    Dense<T> A(a.data(), n, n, n), A_inverse(a_inverse.data(), n, n, n);
+
+    LAPACK::xTRTRI_async(uplo, Diag::non_unit, A_inverse, stream);
+    stream.sync();
+    BLAS::xTRMM(Side::left, uplo, Diag::non_unit, cast<T>(1.0), A,
+                A_inverse);
+
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < n; ++i) {
+        auto one = cast<T>((i == j) ? 1.0 : 0.0);
+        double d = abs(a_inverse[i + j * n] - one);
+        if (d > max_deviation) max_deviation = d;
+      }
+    }
+
+  }
+
+  return report(name, "TRMM/TRTRI", max_deviation, tolerance);
+
+}
+
+template <typename T>
+void benchmark(const char* name, int n) {
+
+  const int repetitions = 5;
+
+  auto a = triangular<T>(n, UPLO::lower), a_work = a;
+  vector<T> b(n * n), c(n * n);
+  for (auto& x : b) x = random_value<T>();
+
+  Dense<T> A(a.data(), n, n, n), B(b.data(), n, n, n), C(c.data(), n, n, n);
+  Dense<T> A_work(a_work.data(), n, n, n);
+
+  auto start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) {
+    BLAS::xTRMM(Side::left, UPLO::lower, Diag::non_unit, cast<T>(1.0), A, B);
+  }
+  auto trmm = milliseconds_since(start, repetitions);
+
+  start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) {
+    BLAS::xGEMM(cast<T>(1.0), A, B, cast<T>(0.0), C);
+  }
+  auto gemm = milliseconds_since(start, repetitions);
+
+  start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) {
+    a_work = a;
+    LAPACK::xTRTRI(UPLO::lower, Diag::non_unit, A_work);
+  }
+  auto trtri = milliseconds_since(start, repetitions);
+
+  vector<int> ipiv(n);
+  vector<T> work(64 * n);
+  start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) {
+    a_work = a;
+    int info = 0;
+    LAPACK::FORTRAN::xGETRF(n, n, a_work.data(), n, ipiv.data(), &info);
+    LAPACK::FORTRAN::xGETRI(n, a_work.data(), n, ipiv.data(), work.data(),
+                            int(work.size()), &info);
+  }
+  auto getri = milliseconds_since(start, repetitions);
+
+  printf("%sTRMM %4dx%4d: xTRMM %8.2f ms, xGEMM %8.2f ms, xTRTRI %8.2f ms, "
+         "xGETRF+xGETRI %8.2f ms\n", name, n, n, trmm, gemm, trtri, getri);
+
+}
+
+int main(int argc, char* argv[]) {
+
+  auto passed = test<S_t>("S", 1e-3) &&
+                test<D_t>("D", 1e-10) &&
+                test<C_t>("C", 1e-3) &&
+                test<Z_t>("Z", 1e-10);
+
+  for (int n : { 256, 1024 }) {
+    benchmark<D_t>("D", n);
+    benchmark<Z_t>("Z", n);
+  }
+
+  return passed ? 0 : 1;
+
+}
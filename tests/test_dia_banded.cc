@@ -0,0 +1,185 @@
+/** \file             test_dia_banded.cc
+ *
+ *  \brief            Test for DIA<T> and Banded<T> (conversion from CSR, DIA
+ *                    multiply and banded solve compared with dense LAPACK
+ *                    and BLAS, reports the time of DIA and CSR multiply)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <linalg.h>
+
+#include "test_helpers.h"
+
+using namespace std;
+using namespace LinAlg;
+
+// Random diagonally dominant n x n matrix with kl sub- and ku
+// superdiagonals, the superdiagonal with offset empty is left zero
+template <typename T>
+vector<T> band(int n, int kl, int ku, int empty) {
+  vector<T> a(n * n, cast<T>(0.0));
+  for (int j = 0; j < n; ++j) {
+    for (int i = max(0, j - ku); i < min(n, j + kl + 1); ++i) {
+      if (j - i != empty) a[i + j * n] = random_value<T>();
+    }
+    a[j + j * n] = cast<T>(2.0 * (kl + ku), 0.0) + random_value<T>();
+  }
+  return a;
+}
+
+template <typename T>
+bool test(const char* name, double tolerance) {
+
+  int n = 300, kl = 2, ku = 3, nrhs = 3;
+  double max_deviation = 0;
+  size_t errors = 0;
+
+  auto a = band<T>(n, kl, ku, 2);
+  auto A = dense2csr(a, n);
+
+  // DIA: diagonals -2, -1, 0, 1 and 3 are stored,
+  // Y = alpha * A * X + beta * Y
+  {
+    DIA<T> A_dia;
+    Utilities::sparse2dia_host(A, A_dia);
+    if (A_dia.rows() != n || A_dia.cols() != n || A_dia.n_diagonals() != 5) {
+      ++errors;
+    }
+
+    vector<T> x(n * nrhs), y(n * nrhs);
+    for (auto& v : x) v = random_value<T>();
+    for (auto& v : y) v = random_value<T>();
+    auto reference = y;
+    auto alpha = random_value<T>(), beta = random_value<T>();
+
+    Dense<T> X(x.data(), n, n, nrhs), Y(y.data(), n, n, nrhs);
+    multiply(alpha, A_dia, X, beta, Y);
+    BLAS::FORTRAN::xGEMM('N', 'N', n, nrhs, n, alpha, a.data(), n, x.data(),
+                         n, beta, reference.data(), n);
+    max_deviation = max(max_deviation, max_difference(y, reference));
+
+    // Wrong dimensions of the result
+    Dense<T> Y_wrong(n - 1, nrhs);
+    try {
+      multiply(A_dia, X, Y_wrong);
+      ++errors;
+    } catch (excBadArgument&) {
+    }
+  }
+
+  // Banded: solve() compared with dense xGESV, then one xGBTRF and several
+  // xGBTRS
+  {
+    Banded<T> A_banded;
+    Utilities::sparse2banded_host(A, A_banded);
+    if (A_banded.kl() != kl || A_banded.ku() != ku) ++errors;
+
+    vector<T> b(n * nrhs);
+    for (auto& v : b) v = random_value<T>();
+    auto x = b, x_reference = b, a_factors = a;
+
+    Dense<T> X(x.data(), n, n, nrhs), X_reference(x_reference.data(), n, n,
+                                                  nrhs);
+    Dense<T> A_factors(a_factors.data(), n, n, n);
+    Dense<int> pivot(n, 1);
+    solve(A_banded, X);
+    LAPACK::xGESV(A_factors, pivot, X_reference);
+    max_deviation = max(max_deviation, max_difference(x, x_reference));
+
+    // Residual b - A * x
+    auto residual = b;
+    BLAS::FORTRAN::xGEMM('N', 'N', n, nrhs, n, cast<T>(-1.0), a.data(), n,
+                         x.data(), n, cast<T>(1.0), residual.data(), n);
+    max_deviation = max(max_deviation,
+                        max_difference(residual, vector<T>(n * nrhs)));
+
+    // A_factors and pivot hold the dense LU decomposition from xGESV
+    Dense<int> banded_pivot(n, 1);
+    Utilities::sparse2banded_host(A, A_banded);
+    LAPACK::xGBTRF(A_banded, banded_pivot);
+    for (int repetition = 0; repetition < 2; ++repetition) {
+      for (auto& v : b) v = random_value<T>();
+      x = b;
+      x_reference = b;
+      LAPACK::xGBTRS(A_banded, banded_pivot, X);
+      LAPACK::xGETRS(A_factors, pivot, X_reference);
+      max_deviation = max(max_deviation, max_difference(x, x_reference));
+    }
+  }
+
+  // Elements beyond the last column can't be stored in a square banded
+  // matrix
+  {
+    vector<T> values = { cast<T>(1.0) };
+    vector<I_t> indices = { n }, edges = { 0, 1, 1 };
+    Sparse<T> A_wide(2, 1, values.data(), indices.data(), edges.data(), 0);
+    Banded<T> A_banded;
+    try {
+      Utilities::sparse2banded_host(A_wide, A_banded);
+      ++errors;
+    } catch (excBadArgument&) {
+    }
+  }
+
+  if (errors > 0) {
+    printf("%sDIA/GB: %zu wrong results (FAILED)\n", name, errors);
+  }
+
+  return report(name, "DIA/GB", max_deviation, tolerance) && errors == 0;
+
+}
+
+// Time for DIA and CSR multiply with the 5-point stencil on a grid x grid
+// grid
+template <typename T>
+void benchmark(const char* name, int grid) {
+
+  const int repetitions = 20;
+
+  int n = grid * grid;
+  auto A = laplacian_2D<T>(grid);
+  DIA<T> A_dia;
+  Utilities::sparse2dia_host(A, A_dia);
+
+  vector<T> x(n), y(n);
+  for (auto& v : x) v = random_value<T>();
+  Dense<T> X(x.data(), n, n, 1), Y(y.data(), n, n, 1);
+
+  auto start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) multiply(A_dia, X, Y);
+  auto dia = milliseconds_since(start, repetitions);
+
+  start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) multiply(A, X, Y);
+  auto csr = milliseconds_since(start, repetitions);
+
+  printf("%smultiply %dx%d grid: DIA %8.3f ms, CSR %8.3f ms\n", name, grid,
+         grid, dia, csr);
+
+}
+
+int main(int argc, char* argv[]) {
+
+  auto passed = test<S_t>("S", 1e-4) &&
+                test<D_t>("D", 1e-12) &&
+                test<C_t>("C", 1e-4) &&
+                test<Z_t>("Z", 1e-12);
+
+  benchmark<D_t>("D", 1000);
+  benchmark<Z_t>("Z", 1000);
+
+  return passed ? 0 : 1;
+
+}
@@ -0,0 +1,214 @@
+/** \file             test_helpers.h
+ *
+ *  \brief            Helpers shared by the tests (random operands, deviations
+ *                    from a reference, timings and the result line)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+#ifndef LINALG_TESTS_TEST_HELPERS_H_
+#define LINALG_TESTS_TEST_HELPERS_H_
+
+#include <chrono>     // std::chrono::steady_clock, std::chrono::duration
+#include <cmath>      // std::abs
+#include <complex>    // std::abs
+#include <cstddef>    // size_t
+#include <cstdio>     // std::printf
+#include <cstdlib>    // std::rand, RAND_MAX
+#include <vector>     // std::vector
+
+#include <linalg.h>
+
+/** \brief            Random value with real (and imaginary) part in [-1, 1]
+ */
+template <typename T>
+T random_value() {
+  return LinAlg::cast<T>(2.0 * std::rand() / RAND_MAX - 1.0,
+                         2.0 * std::rand() / RAND_MAX - 1.0);
+}
+
+/** \brief            Column major rows x cols matrix with random elements
+ *
+ *  \param[in]        rows
+ *                    Number of rows.
+ *
+ *  \param[in]        cols
+ *                    Number of columns.
+ */
+template <typename T>
+LinAlg::Dense<T> random_matrix(LinAlg::I_t rows, LinAlg::I_t cols) {
+  LinAlg::Dense<T> matrix(rows, cols);
+  for (LinAlg::I_t i = 0; i < rows * cols; ++i) {
+    matrix._begin()[i] = random_value<T>();
+  }
+  return matrix;
+}
+
+/** \brief            CSR matrix (zero based, in main memory) with the non
+ *                    zero elements of a dense n x n matrix
+ *
+ *  \param[in]        a
+ *                    Column major n x n matrix with leading dimension n, the
+ *                    dense reference for the tests.
+ *
+ *  \param[in]        n
+ *                    Number of rows and columns.
+ */
+template <typename T>
+LinAlg::Sparse<T> dense2csr(const std::vector<T>& a, LinAlg::I_t n) {
+
+  LinAlg::I_t n_nonzeros = 0;
+  for (auto& element : a) {
+    if (element != LinAlg::cast<T>(0.0)) ++n_nonzeros;
+  }
+
+  LinAlg::Sparse<T> A(n, n_nonzeros, 0);
+  auto values  = A._values.get();
+  auto indices = A._indices.get();
+  auto edges   = A._edges.get();
+
+  LinAlg::I_t index = 0;
+  for (LinAlg::I_t row = 0; row < n; ++row) {
+    edges[row] = index;
+    for (LinAlg::I_t col = 0; col < n; ++col) {
+      if (a[row + col * n] != LinAlg::cast<T>(0.0)) {
+        values[index]    = a[row + col * n];
+        indices[index++] = col;
+      }
+    }
+  }
+  edges[n] = index;
+
+  return A;
+
+}
+
+/** \brief            CSR matrix (zero based, in main memory) of the 5-point
+ *                    Laplacian on a grid x grid grid (Dirichlet boundary)
+ *
+ *  \param[in]        grid
+ *                    Number of grid points per dimension.
+ */
+template <typename T>
+LinAlg::Sparse<T> laplacian_2D(LinAlg::I_t grid) {
+
+  auto n = grid * grid;
+  LinAlg::Sparse<T> A(n, 5 * n - 4 * grid, 0);
+  auto values  = A._values.get();
+  auto indices = A._indices.get();
+  auto edges   = A._edges.get();
+
+  LinAlg::I_t index = 0;
+  auto add = [&](LinAlg::I_t col, double value) {
+    values[index]    = LinAlg::cast<T>(value, 0.0);
+    indices[index++] = col;
+  };
+  for (LinAlg::I_t i = 0; i < grid; ++i) {
+    for (LinAlg::I_t j = 0; j < grid; ++j) {
+      auto row = i * grid + j;
+      edges[row] = index;
+      if (i > 0)        add(row - grid, -1.0);
+      if (j > 0)        add(row - 1, -1.0);
+      add(row, 4.0);
+      if (j < grid - 1) add(row + 1, -1.0);
+      if (i < grid - 1) add(row + grid, -1.0);
+    }
+  }
+  edges[n] = index;
+
+  return A;
+
+}
+
+/** \brief            Maximal absolute difference between two arrays
+ *
+ *  \param[in]        a
+ *                    First array.
+ *
+ *  \param[in]        b
+ *                    Second array.
+ *
+ *  \param[in]        length
+ *                    Number of elements to compare.
+ */
+template <typename T>
+double max_difference(const T* a, const T* b, size_t length) {
+  using std::abs;
+  double max_deviation = 0;
+  for (size_t i = 0; i < length; ++i) {
+    double difference = abs(a[i] - b[i]);
+    if (difference > max_deviation) max_deviation = difference;
+  }
+  return max_deviation;
+}
+
+/** \brief            Maximal absolute difference between two vectors of the
+ *                    same length
+ */
+template <typename T>
+double max_difference(const std::vector<T>& a, const std::vector<T>& b) {
+  return max_difference(a.data(), b.data(), a.size());
+}
+
+/** \brief            Milliseconds elapsed since start, per repetition
+ *
+ *  \param[in]        start
+ *                    Time point the measurement started at.
+ *
+ *  \param[in]        repetitions
+ *                    Number of repetitions the elapsed time is divided by.
+ */
+inline double milliseconds_since(std::chrono::steady_clock::time_point start,
+                                 int repetitions = 1) {
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::milli>(elapsed).count() /
+         repetitions;
+}
+
+/** \brief            Prints the result line of a test comparing with a
+ *                    reference and returns whether it passed
+ *
+ *  \param[in]        name
+ *                    Prefix of the tested routine (e.g. "Z").
+ *
+ *  \param[in]        routine
+ *                    Tested routine (e.g. "GEMM").
+ *
+ *  \param[in]        deviation
+ *                    Maximal deviation from the reference.
+ *
+ *  \param[in]        tolerance
+ *                    Largest deviation that passes.
+ */
+inline bool report(const char* name, const char* routine, double deviation,
+                   double tolerance) {
+  auto passed = deviation < tolerance;
+  std::printf("%s%s: max deviation %g (%s)\n", name, routine, deviation,
+              passed ? "ok" : "FAILED");
+  return passed;
+}
+
+/** \brief            Prints the result line of a test counting wrong
+ *                    elements and returns whether it passed
+ *
+ *  \param[in]        name
+ *                    Prefix of the tested routine (e.g. "Z").
+ *
+ *  \param[in]        routine
+ *                    Tested routine (e.g. "copy_2Darray").
+ *
+ *  \param[in]        errors
+ *                    Number of wrong elements.
+ */
+inline bool report_errors(const char* name, const char* routine,
+                          size_t errors) {
+  std::printf("%s%s: %zu wrong elements (%s)\n", name, routine, errors,
+              (errors == 0) ? "ok" : "FAILED");
+  return errors == 0;
+}
+
+#endif /* LINALG_TESTS_TEST_HELPERS_H_ */
@@ -0,0 +1,248 @@
+/** \file             test_lapack_gtsv_batched.cc
+ *
+ *  \brief            Test for LinAlg::LAPACK::xGTSV_batched and
+ *                    xGTSV_block_batched (compares with dense xGESV per
+ *                    system and reports the time of the batched solve and of
+ *                    one library xGTSV per system)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <linalg.h>
+
+#include "test_helpers.h"
+
+using namespace std;
+using namespace LinAlg;
+
+// rows x cols operand on array, column s is system s. In Format::RowMajor
+// element e of system s is array[e * ld + s] (interleaved), otherwise
+// array[s * ld + e].
+template <typename T>
+Dense<T> operand(vector<T>& array, I_t ld, I_t rows, I_t cols,
+                 Format format) {
+  Dense<T> A(array.data(), ld, rows, cols);
+  A._format = format;
+  return A;
+}
+
+// Element e of system s of an operand stored as by operand()
+template <typename T>
+T& element(vector<T>& array, I_t ld, Format format, I_t e, I_t s) {
+  return (format == Format::RowMajor) ? array[e * ld + s] : array[s * ld + e];
+}
+
+// Solves batch random diagonally dominant block tridiagonal systems with n
+// block rows of m x m blocks (tridiagonal if m == 1) with the batched solver
+// and compares each system with dense xGESV, returns the maximal deviation of
+// the solutions and the residuals
+template <typename T>
+double deviation(I_t n, I_t m, I_t batch, Format format, int n_threads) {
+
+  auto size       = n * m;
+  auto block_size = m * m;
+  auto rows       = n * block_size;
+  auto ld_matrix  = ((format == Format::RowMajor) ? batch : rows) + 3;
+  auto ld_vector  = (format == Format::RowMajor) ? ld_matrix : size + 3;
+  auto length     = ld_matrix * ((format == Format::RowMajor) ? rows : batch);
+
+  vector<T> dl(length), d(length), du(length), b(length);
+  for (auto& v : dl) v = random_value<T>();
+  for (auto& v : du) v = random_value<T>();
+  for (auto& v : d) v = random_value<T>();
+  for (auto& v : b) v = random_value<T>();
+  for (I_t s = 0; s < batch; ++s) {
+    for (I_t k = 0; k < n; ++k) {
+      for (I_t i = 0; i < m; ++i) {
+        element(d, ld_matrix, format, k * block_size + i * m + i, s) +=
+          cast<T>(4.0 * m, 0.0);
+      }
+    }
+  }
+  auto du_original = du, b_original = b;
+
+  auto DL = operand(dl, ld_matrix, rows, batch, format);
+  auto D  = operand(d, ld_matrix, rows, batch, format);
+  auto DU = operand(du, ld_matrix, rows, batch, format);
+  auto B  = operand(b, ld_vector, size, batch, format);
+  vector<T> d_solved = d;
+  if (m == 1) {
+    LAPACK::xGTSV_batched(DL, D, DU, B, n_threads);
+  } else {
+    auto D_solved = operand(d_solved, ld_matrix, rows, batch, format);
+    LAPACK::xGTSV_block_batched(m, DL, D_solved, DU, B, n_threads);
+  }
+
+  // Dense reference per system
+  double max_deviation = 0;
+  vector<T> a(size * size), a_factors(size * size), x(size), residual(size);
+  vector<int> pivot(size);
+  for (I_t s = 0; s < batch; ++s) {
+
+    fill(a.begin(), a.end(), cast<T>(0.0));
+    for (I_t k = 0; k < n; ++k) {
+      for (I_t j = 0; j < m; ++j) {
+        for (I_t i = 0; i < m; ++i) {
+          auto e = k * block_size + j * m + i;
+          a[(k * m + i) + (k * m + j) * size] = element(d, ld_matrix, format,
+                                                        e, s);
+          if (k > 0) {
+            a[(k * m + i) + ((k - 1) * m + j) * size] =
+              element(dl, ld_matrix, format, e, s);
+          }
+          if (k < n - 1) {
+            a[(k * m + i) + ((k + 1) * m + j) * size] =
+              element(du_original, ld_matrix, format, e, s);
+          }
+        }
+      }
+    }
+    for (I_t e = 0; e < size; ++e) {
+      x[e] = element(b_original, ld_vector, format, e, s);
+      residual[e] = x[e];
+    }
+
+    a_factors = a;
+    int info = 0;
+    LAPACK::FORTRAN::xGESV(size, 1, a_factors.data(), size, pivot.data(),
+                           x.data(), size, &info);
+
+    vector<T> result(size);
+    for (I_t e = 0; e < size; ++e) {
+      result[e] = element(b, ld_vector, format, e, s);
+    }
+    max_deviation = max(max_deviation, max_difference(result, x));
+
+    BLAS::FORTRAN::xGEMM('N', 'N', size, 1, size, cast<T>(-1.0), a.data(),
+                         size, result.data(), size, cast<T>(1.0),
+                         residual.data(), size);
+    max_deviation = max(max_deviation,
+                        max_difference(residual, vector<T>(size)));
+
+  }
+
+  return max_deviation;
+
+}
+
+template <typename T>
+bool test(const char* name, double tolerance) {
+
+  double max_deviation = 0;
+  size_t errors = 0;
+
+  // Tridiagonal and block tridiagonal, interleaved (in place) and column
+  // blocks (through the buffer), serial and threaded, batches that are no
+  // multiple of the SIMD width
+  for (auto format : { Format::RowMajor, Format::ColMajor }) {
+    for (int n_threads : { 1, 0 }) {
+      max_deviation = max(max_deviation,
+                          deviation<T>(17, 1, 1003, format, n_threads));
+      max_deviation = max(max_deviation,
+                          deviation<T>(1, 1, 5, format, n_threads));
+      max_deviation = max(max_deviation,
+                          deviation<T>(6, 3, 205, format, n_threads));
+      max_deviation = max(max_deviation,
+                          deviation<T>(4, 2, 33, format, n_threads));
+    }
+  }
+
+  // Zero pivot in row 0 of one of the systems
+  {
+    Dense<T> DL(4, 8), D(4, 8), DU(4, 8), B(4, 8);
+    Fills::zero(DL);
+    Fills::zero(DU);
+    Fills::zero(B);
+    for (int i = 0; i < 4 * 8; ++i) D._begin()[i] = cast<T>(1.0);
+    D._begin()[4 * 5] = cast<T>(0.0);
+    try {
+      LAPACK::xGTSV_batched(DL, D, DU, B);
+      ++errors;
+    } catch (excMath&) {
+    }
+  }
+
+  // Number of rows not a multiple of the block size
+  {
+    Dense<T> DL(10 * 3, 2), D(10 * 3, 2), DU(10 * 3, 2), B(10, 2);
+    try {
+      LAPACK::xGTSV_block_batched(3, DL, D, DU, B);
+      ++errors;
+    } catch (excBadArgument&) {
+    }
+  }
+
+  if (errors > 0) {
+    printf("%sGTSV_batched: %zu wrong results (FAILED)\n", name, errors);
+  }
+
+  return report(name, "GTSV_batched", max_deviation, tolerance) &&
+         errors == 0;
+
+}
+
+// Time for batch tridiagonal systems of size n, batched and with one library
+// xGTSV per system
+template <typename T>
+void benchmark(const char* name, I_t n, I_t batch) {
+
+  vector<T> dl(n * batch), d(n * batch), du(n * batch), b(n * batch);
+  for (auto& v : dl) v = random_value<T>();
+  for (auto& v : du) v = random_value<T>();
+  for (auto& v : d) v = cast<T>(4.0, 0.0) + random_value<T>();
+  for (auto& v : b) v = random_value<T>();
+  auto dl_copy = dl, d_copy = d, du_copy = du, b_copy = b;
+
+  auto DL = operand(dl_copy, batch, n, batch, Format::RowMajor);
+  auto D  = operand(d_copy, batch, n, batch, Format::RowMajor);
+  auto DU = operand(du_copy, batch, n, batch, Format::RowMajor);
+  auto B  = operand(b_copy, batch, n, batch, Format::RowMajor);
+
+  auto start = chrono::steady_clock::now();
+  LAPACK::xGTSV_batched(DL, D, DU, B);
+  auto batched = milliseconds_since(start);
+
+  // The library routine overwrites all diagonals and takes DL and DU with
+  // n - 1 elements
+  dl_copy = dl;
+  d_copy = d;
+  du_copy = du;
+  b_copy = b;
+  start = chrono::steady_clock::now();
+  for (I_t s = 0; s < batch; ++s) {
+    int info = 0;
+    LAPACK::FORTRAN::xGTSV(n, 1, dl_copy.data() + s * n + 1,
+                           d_copy.data() + s * n, du_copy.data() + s * n,
+                           b_copy.data() + s * n, n, &info);
+  }
+  auto library = milliseconds_since(start);
+
+  printf("%sGTSV_batched %d x %d: batched %8.2f ms, library %8.2f ms\n",
+         name, batch, n, batched, library);
+
+}
+
+int main(int argc, char* argv[]) {
+
+  auto passed = test<S_t>("S", 1e-4) &&
+                test<D_t>("D", 1e-12) &&
+                test<C_t>("C", 1e-4) &&
+                test<Z_t>("Z", 1e-12);
+
+  benchmark<D_t>("D", 32, 100000);
+  benchmark<Z_t>("Z", 32, 100000);
+
+  return passed ? 0 : 1;
+
+}
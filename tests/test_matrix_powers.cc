@@ -0,0 +1,216 @@
+/** \file             test_matrix_powers.cc
+ *
+ *  \brief            Test for LinAlg::MatrixPowers, matrix_powers and the
+ *                    native CSR multiply (compares with dense BLAS, checks
+ *                    that applying the kernel is faster than s multiplies)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <linalg.h>
+
+#include "test_helpers.h"
+
+using namespace std;
+using namespace LinAlg;
+
+// Random n x n matrix with a few elements per row close to the diagonal and
+// one far away, scaled such that the powers stay bounded
+template <typename T>
+vector<T> random_sparse(int n) {
+  vector<T> a(n * n, cast<T>(0.0));
+  for (int i = 0; i < n; ++i) {
+    for (int k = 0; k < 4; ++k) {
+      auto j = min(n - 1, max(0, i + rand() % 7 - 3));
+      a[i + j * n] = cast<T>(0.2) * random_value<T>();
+    }
+    a[i + (rand() % n) * n] = cast<T>(0.2) * random_value<T>();
+  }
+  return a;
+}
+
+// Maximal deviation of matrix_powers() (or of powers.apply() if given) from
+// repeated dense products
+template <typename T>
+double deviation(vector<T>& a, Sparse<T>& A, I_t s, I_t tile_rows,
+                 int n_threads, const MatrixPowers<T>* powers = nullptr) {
+
+  I_t n = A._size;
+  vector<T> x(n), v(n * (s + 1)), reference(n * (s + 1));
+  for (auto& element : x) element = random_value<T>();
+
+  Dense<T> X(x.data(), n, n, 1), V(v.data(), n, n, s + 1);
+  if (powers) {
+    powers->apply(X, V);
+  } else {
+    matrix_powers(A, X, s, V, tile_rows, n_threads);
+  }
+
+  copy(x.begin(), x.end(), reference.begin());
+  for (I_t j = 1; j <= s; ++j) {
+    BLAS::FORTRAN::xGEMM('N', 'N', n, 1, n, cast<T>(1.0), a.data(), n,
+                         reference.data() + (j - 1) * n, n, cast<T>(0.0),
+                         reference.data() + j * n, n);
+  }
+
+  return max_difference(v, reference);
+
+}
+
+template <typename T>
+bool test(const char* name, double tolerance) {
+
+  int n = 500;
+  double max_deviation = 0;
+  size_t errors = 0;
+
+  auto a = random_sparse<T>(n);
+  auto A = dense2csr(a, n);
+
+  // Tiles from single rows to the whole matrix, serial and threaded
+  for (I_t s : { 0, 1, 2, 5 }) {
+    for (I_t tile_rows : { 1, 7, 64, 2048 }) {
+      for (int n_threads : { 1, 0 }) {
+        max_deviation = max(max_deviation,
+                            deviation(a, A, s, tile_rows, n_threads));
+      }
+    }
+  }
+
+  // One setup, several start vectors
+  {
+    MatrixPowers<T> powers;
+    powers.tile_rows = 7;
+    powers.setup(A, 3);
+    for (int i = 0; i < 3; ++i) {
+      max_deviation = max(max_deviation,
+                          deviation(a, A, 3, 0, 0, &powers));
+    }
+  }
+
+  // Y = alpha * A * X + beta * Y
+  {
+    int n_vectors = 3;
+    vector<T> x(n * n_vectors), y(n * n_vectors);
+    for (auto& v : x) v = random_value<T>();
+    for (auto& v : y) v = random_value<T>();
+    auto reference = y;
+    auto alpha = random_value<T>(), beta = random_value<T>();
+
+    Dense<T> X(x.data(), n, n, n_vectors), Y(y.data(), n, n, n_vectors);
+    multiply(alpha, A, X, beta, Y);
+    BLAS::FORTRAN::xGEMM('N', 'N', n, n_vectors, n, alpha, a.data(), n,
+                         x.data(), n, beta, reference.data(), n);
+    max_deviation = max(max_deviation, max_difference(y, reference));
+  }
+
+  // One based indices
+  A.first_index(1);
+  max_deviation = max(max_deviation, deviation(a, A, 4, 64, 0));
+
+  // Negative powers, wrong dimensions of the output, apply() before setup()
+  {
+    Dense<T> X(n, 1), V(n, 2);
+    MatrixPowers<T> powers;
+    try {
+      powers.apply(X, V);
+      ++errors;
+    } catch (excUserError&) {
+    }
+    try {
+      matrix_powers(A, X, -1, V);
+      ++errors;
+    } catch (excBadArgument&) {
+    }
+    try {
+      matrix_powers(A, X, 3, V);
+      ++errors;
+    } catch (excBadArgument&) {
+    }
+  }
+
+  if (errors > 0) {
+    printf("%smatrix_powers: %zu wrong results (FAILED)\n", name, errors);
+  }
+
+  return report(name, "matrix_powers/CSRMM", max_deviation, tolerance) &&
+         errors == 0;
+
+}
+
+// Time for A^1 * x ... A^s * x with the 5-point stencil on a grid x grid
+// grid, with MatrixPowers (setup once, best of several applications) and
+// with s calls to xCSRMM. Returns false if the kernel isn't faster.
+template <typename T>
+bool benchmark(const char* name, int grid, I_t s) {
+
+  const int repetitions = 5;
+
+  int n = grid * grid;
+  auto A = laplacian_2D<T>(grid);
+
+  vector<T> x(n), v(n * (s + 1));
+  for (auto& element : x) element = random_value<T>();
+  Dense<T> X(x.data(), n, n, 1), V(v.data(), n, n, s + 1);
+
+  // The ghost zone of a tile spans s grid rows on either side, the tiles
+  // have to be considerably larger than that
+  MatrixPowers<T> powers;
+  powers.tile_rows = 64 * grid;
+
+  auto start = chrono::steady_clock::now();
+  powers.setup(A, s);
+  auto setup = milliseconds_since(start, 1);
+
+  double applied = 0, multiplied = 0;
+  for (int i = 0; i < repetitions; ++i) {
+
+    start = chrono::steady_clock::now();
+    powers.apply(X, V);
+    auto time = milliseconds_since(start, 1);
+    if (i == 0 || time < applied) applied = time;
+
+    start = chrono::steady_clock::now();
+    for (I_t j = 1; j <= s; ++j) {
+      Dense<T> previous(v.data() + (j - 1) * n, n, n, 1);
+      Dense<T> current(v.data() + j * n, n, n, 1);
+      BLAS::NATIVE::xCSRMM(cast<T>(1.0), A, previous, cast<T>(0.0), current);
+    }
+    time = milliseconds_since(start, 1);
+    if (i == 0 || time < multiplied) multiplied = time;
+
+  }
+
+  auto faster = applied < multiplied;
+  printf("%sMatrixPowers %dx%d grid, s = %d: setup %8.2f ms, apply %8.2f ms, "
+         "%d x xCSRMM %8.2f ms (%s)\n", name, grid, grid, s, setup, applied,
+         s, multiplied, faster ? "ok" : "FAILED");
+
+  return faster;
+
+}
+
+int main(int argc, char* argv[]) {
+
+  auto passed = test<S_t>("S", 1e-4) &&
+                test<D_t>("D", 1e-12) &&
+                test<C_t>("C", 1e-4) &&
+                test<Z_t>("Z", 1e-12);
+
+  passed = benchmark<D_t>("D", 1000, 8) && passed;
+  passed = benchmark<Z_t>("Z", 1000, 8) && passed;
+
+  return passed ? 0 : 1;
+
+}
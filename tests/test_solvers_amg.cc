@@ -0,0 +1,218 @@
+/** \file             test_solvers_amg.cc
+ *
+ *  \brief            Test for LinAlg::Solvers::AMG (V-cycles as a solver for
+ *                    the 2D Laplacian compared with dense xGESV, reports the
+ *                    time of setup, update and a V-cycle)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <linalg.h>
+
+#include "test_helpers.h"
+
+using namespace std;
+using namespace LinAlg;
+
+// Dense n x n copy of a zero based CSR matrix
+template <typename T>
+vector<T> csr2dense(const Sparse<T>& A) {
+  auto n = A._size;
+  vector<T> a(n * n, cast<T>(0.0));
+  for (I_t row = 0; row < n; ++row) {
+    for (auto index = A._edges.get()[row]; index < A._edges.get()[row + 1];
+         ++index) {
+      a[row + A._indices.get()[index] * n] = A._values.get()[index];
+    }
+  }
+  return a;
+}
+
+// Solution of A * x = b with dense xGESV
+template <typename T>
+vector<T> dense_solve(const Sparse<T>& A, vector<T> b) {
+  auto n = A._size;
+  auto a = csr2dense(A);
+  vector<int> pivot(n);
+  int info = 0;
+  LAPACK::FORTRAN::xGESV(n, 1, a.data(), n, pivot.data(), b.data(), n, &info);
+  return b;
+}
+
+// Maximal element of |b - A * x| relative to the maximal element of |b|
+template <typename T>
+double relative_residual(const Sparse<T>& A, vector<T>& b, vector<T>& x) {
+  auto n = A._size;
+  vector<T> Ax(n);
+  Dense<T> X(x.data(), n, n, 1), AX(Ax.data(), n, n, 1);
+  multiply(A, X, AX);
+  return max_difference(Ax, b) / max_difference(b, vector<T>(n));
+}
+
+// Runs V-cycles until the relative residual is below tolerance (at most 50),
+// returns the maximal deviation from the dense solution relative to the
+// largest element of the solution, -1 if the cycles don't converge at a rate
+// of at least 0.7 per cycle
+template <typename T>
+double deviation(Solvers::AMG<T>& amg, const Sparse<T>& A, vector<T>& b,
+                 double tolerance) {
+
+  auto n = A._size;
+  vector<T> x(n);
+  Dense<T> B(b.data(), n, n, 1), X(x.data(), n, n, 1);
+
+  amg.apply(B, X);
+  auto residual = relative_residual(A, b, x);
+  int cycles = 1;
+  for (; cycles < 50 && residual > tolerance; ++cycles) {
+    amg.cycle(B, X);
+    residual = relative_residual(A, b, x);
+  }
+  if (residual > tolerance || residual > pow(0.7, cycles)) return -1;
+
+  auto reference = dense_solve(A, b);
+  return max_difference(x, reference) / max_difference(reference,
+                                                       vector<T>(n));
+
+}
+
+template <typename T>
+bool test(const char* name, double tolerance) {
+
+  I_t grid = 40, n = grid * grid;
+  double max_deviation = 0;
+  size_t errors = 0;
+
+  auto A = laplacian_2D<T>(grid);
+  vector<T> b(n);
+  for (auto& v : b) v = random_value<T>();
+
+  auto check = [&](double d) {
+    if (d < 0) ++errors;
+    max_deviation = max(max_deviation, d);
+  };
+
+  for (auto smoother : { Solvers::AMGSmoother::Jacobi,
+                         Solvers::AMGSmoother::Chebyshev }) {
+
+    Solvers::AMG<T> amg;
+    amg.max_coarse_size = 50;
+    amg.smoother        = smoother;
+    amg.setup(A);
+    if (amg.n_levels() < 3) ++errors;
+    check(deviation(amg, A, b, tolerance));
+
+    // New values, same pattern: 2 * A + shift on the diagonal
+    Sparse<T> A_new(A);
+    auto values  = A_new._values.get();
+    auto indices = A_new._indices.get();
+    auto edges   = A_new._edges.get();
+    for (I_t row = 0; row < n; ++row) {
+      for (auto index = edges[row]; index < edges[row + 1]; ++index) {
+        values[index] = cast<T>(2.0) * values[index];
+        if (indices[index] == row) values[index] += cast<T>(0.5);
+      }
+    }
+    amg.update(A_new);
+    check(deviation(amg, A_new, b, tolerance));
+
+  }
+
+  // Small enough for the coarsest level only, one application is exact
+  {
+    auto A_small = laplacian_2D<T>(5);
+    vector<T> b_small(25), x_small(25);
+    for (auto& v : b_small) v = random_value<T>();
+    Dense<T> B(b_small.data(), 25, 25, 1), X(x_small.data(), 25, 25, 1);
+    Solvers::AMG<T> amg;
+    amg.setup(A_small);
+    amg.apply(B, X);
+    if (amg.n_levels() != 1) ++errors;
+    max_deviation = max(max_deviation,
+                        relative_residual(A_small, b_small, x_small));
+  }
+
+  // update() needs setup() and the same pattern
+  {
+    Solvers::AMG<T> amg;
+    try {
+      amg.update(A);
+      ++errors;
+    } catch (excUserError&) {
+    }
+    amg.setup(A);
+    auto A_other = laplacian_2D<T>(grid + 1);
+    try {
+      amg.update(A_other);
+      ++errors;
+    } catch (excBadArgument&) {
+    }
+  }
+
+  if (errors > 0) {
+    printf("%sAMG: %zu wrong results (FAILED)\n", name, errors);
+  }
+
+  // The error of the solution is up to the condition number (~650) larger
+  // than the residual
+  return report(name, "AMG", max_deviation, 1000 * tolerance) && errors == 0;
+
+}
+
+// Time for setup, update and one V-cycle for the 2D Laplacian on a grid x
+// grid grid
+template <typename T>
+void benchmark(const char* name, int grid) {
+
+  const int repetitions = 5;
+
+  int n = grid * grid;
+  auto A = laplacian_2D<T>(grid);
+  vector<T> b(n), x(n);
+  for (auto& v : b) v = random_value<T>();
+  Dense<T> B(b.data(), n, n, 1), X(x.data(), n, n, 1);
+
+  Solvers::AMG<T> amg;
+  auto start = chrono::steady_clock::now();
+  amg.setup(A);
+  auto setup = milliseconds_since(start);
+
+  start = chrono::steady_clock::now();
+  amg.update(A);
+  auto update = milliseconds_since(start);
+
+  start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) amg.cycle(B, X);
+  auto cycle = milliseconds_since(start, repetitions);
+
+  printf("%sAMG %dx%d grid, %d levels: setup %8.2f ms, update %8.2f ms, "
+         "V-cycle %8.2f ms\n", name, grid, grid, int(amg.n_levels()), setup,
+         update, cycle);
+
+}
+
+int main(int argc, char* argv[]) {
+
+  auto passed = test<S_t>("S", 1e-5) &&
+                test<D_t>("D", 1e-10) &&
+                test<C_t>("C", 1e-5) &&
+                test<Z_t>("Z", 1e-10);
+
+  benchmark<D_t>("D", 500);
+  benchmark<Z_t>("Z", 500);
+
+  return passed ? 0 : 1;
+
+}
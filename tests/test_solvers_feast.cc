@@ -0,0 +1,329 @@
+/** \file             test_solvers_feast.cc
+ *
+ *  \brief            Test for LinAlg::Solvers::FEAST (eigenpairs in an
+ *                    interval compared with dense xHEEV/xHEGV, reports the
+ *                    time of a solve with the built-in banded LU and with a
+ *                    dense LU plugged in as shifted solver)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <linalg.h>
+
+#include "test_helpers.h"
+
+using namespace std;
+using namespace LinAlg;
+
+// Column major n x n tridiagonal Hermitian matrix with diagonal d and
+// off diagonal (off_real, off_imag) below the diagonal, the corner elements
+// are set too if periodic
+template <typename T>
+vector<T> tridiagonal(int n, double d, double off_real, double off_imag,
+                      bool periodic) {
+  vector<T> a(n * n, cast<T>(0.0));
+  auto below = cast<T>(off_real, off_imag);
+  for (int i = 0; i < n; ++i) {
+    a[i + i * n] = cast<T>(d, 0.0);
+    if (i + 1 < n || periodic) {
+      auto j = (i + 1) % n;
+      a[j + i * n] = below;
+      a[i + j * n] = conj(below);
+    }
+  }
+  return a;
+}
+
+// Eigenvalues of the dense pencil (a, s) (or of a if s is empty), ascending
+template <typename T>
+vector<typename RealType<T>::type> dense_eigenvalues(vector<T> a,
+                                                     vector<T> s, int n) {
+  typedef typename RealType<T>::type R;
+  vector<R> w(n), rwork(3 * n);
+  T work_size;
+  int info = 0;
+  if (s.empty()) {
+    LAPACK::FORTRAN::xHEEV('N', 'U', n, a.data(), n, w.data(), &work_size,
+                           -1, rwork.data(), &info);
+    vector<T> work(int(real(work_size)));
+    LAPACK::FORTRAN::xHEEV('N', 'U', n, a.data(), n, w.data(), work.data(),
+                           int(work.size()), rwork.data(), &info);
+  } else {
+    LAPACK::FORTRAN::xHEGV(1, 'N', 'U', n, a.data(), n, s.data(), n,
+                           w.data(), &work_size, -1, rwork.data(), &info);
+    vector<T> work(int(real(work_size)));
+    LAPACK::FORTRAN::xHEGV(1, 'N', 'U', n, a.data(), n, s.data(), n,
+                           w.data(), work.data(), int(work.size()),
+                           rwork.data(), &info);
+  }
+  return w;
+}
+
+// Eigenpairs of (a, s) (or a if s is empty) in [e_min, e_max] from FEAST
+// compared with dense LAPACK, returns the maximal deviation of the
+// eigenvalues and of the residuals |H x - lambda S x| / |x| relative to the
+// largest magnitude in the interval, -1 if the number of eigenpairs differs
+template <typename T>
+double deviation(Solvers::FEAST<T>& feast, vector<T>& a, vector<T>& s,
+                 int n, double e_min, double e_max, I_t m0) {
+
+  auto H = dense2csr(a, n);
+  Dense<typename RealType<T>::type> lambda;
+  Dense<T> X;
+  I_t n_found;
+  if (s.empty()) {
+    n_found = feast.solve(H, e_min, e_max, m0, lambda, X);
+  } else {
+    auto S = dense2csr(s, n);
+    n_found = feast.solve(H, S, e_min, e_max, m0, lambda, X);
+  }
+
+  vector<double> reference;
+  for (auto w : dense_eigenvalues(a, s, n)) {
+    if (w >= e_min && w <= e_max) reference.push_back(w);
+  }
+  if (n_found != I_t(reference.size())) {
+    printf("FEAST: found %d eigenvalues in [%g, %g], dense LAPACK %d\n",
+           n_found, e_min, e_max, int(reference.size()));
+    return -1;
+  }
+
+  auto scale = max(abs(e_min), abs(e_max));
+  double max_deviation = 0;
+  vector<T> hx(n), sx(n);
+  for (I_t j = 0; j < n_found; ++j) {
+    max_deviation = max(max_deviation,
+                        abs(double(lambda._begin()[j]) - reference[j]) /
+                        scale);
+    auto x_j = X._begin() + j * X._leading_dimension;
+    BLAS::FORTRAN::xGEMM('N', 'N', n, 1, n, cast<T>(1.0), a.data(), n, x_j,
+                         n, cast<T>(0.0), hx.data(), n);
+    if (s.empty()) {
+      copy(x_j, x_j + n, sx.begin());
+    } else {
+      BLAS::FORTRAN::xGEMM('N', 'N', n, 1, n, cast<T>(1.0), s.data(), n,
+                           x_j, n, cast<T>(0.0), sx.data(), n);
+    }
+    double r2 = 0, x2 = 0;
+    for (int i = 0; i < n; ++i) {
+      auto r = hx[i] - cast<T>(double(lambda._begin()[j])) * sx[i];
+      r2 += real(r * conj(r));
+      x2 += real(x_j[i] * conj(x_j[i]));
+    }
+    max_deviation = max(max_deviation, sqrt(r2 / x2) / scale);
+  }
+
+  return max_deviation;
+
+}
+
+template <typename T>
+bool test(const char* name, double tolerance) {
+
+  int n = 300;
+  double max_deviation = 0;
+  size_t errors = 0;
+  vector<T> no_s;
+
+  auto check = [&](double d) {
+    if (d < 0) ++errors;
+    max_deviation = max(max_deviation, d);
+  };
+
+  // 1D Laplacian (banded LU), 21 eigenvalues in [0, 0.05]. Search spaces
+  // much larger than that make the filtered subspace rank deficient.
+  auto laplacian = tridiagonal<T>(n, 2.0, -1.0, 0.0, false);
+  for (I_t m0 : { 25, 40, 120 }) {
+    Solvers::FEAST<T> feast;
+    feast.tolerance = tolerance;
+    check(deviation(feast, laplacian, no_s, n, 0.0, 0.05, m0));
+    if (!feast.converged) ++errors;
+  }
+
+  // Periodic with a phase on the corner elements (dense LU, degenerate
+  // eigenvalues for the real types)
+  {
+    auto a = tridiagonal<T>(n, 2.0, -1.0, 0.0, true);
+    a[0 + (n - 1) * n] = cast<T>(-0.8, 0.6);
+    a[(n - 1) + 0 * n] = cast<T>(-0.8, -0.6);
+    Solvers::FEAST<T> feast;
+    feast.tolerance = tolerance;
+    check(deviation(feast, a, no_s, n, -0.01, 0.05, 40));
+  }
+
+  // Generalized problem with a complex Hermitian H (real part only for the
+  // real types) and the mass matrix of linear elements
+  {
+    auto a = tridiagonal<T>(n, 2.0, -1.0, 0.3, false);
+    auto s = tridiagonal<T>(n, 4.0 / 6, 1.0 / 6, 0.0, false);
+    Solvers::FEAST<T> feast;
+    feast.tolerance = tolerance;
+    check(deviation(feast, a, s, n, 0.02, 0.1, 40));
+  }
+
+  // Shifted solves plugged in: dense LU through LAPACK
+  {
+    typedef typename ComplexType<T>::type Z;
+    Solvers::FEAST<T> feast;
+    feast.tolerance = tolerance;
+    vector<vector<Z>> factors(feast.n_points);
+    vector<vector<int>> pivots(feast.n_points);
+    int n_factorizations = 0;
+    feast.shifted_factorize = [&](I_t k, Z z) {
+      factors[k].assign(n * n, cast<Z>(0.0));
+      pivots[k].resize(n);
+      for (int i = 0; i < n * n; ++i) {
+        factors[k][i] = -cast<Z>(laplacian[i]);
+      }
+      for (int i = 0; i < n; ++i) factors[k][i + i * n] += z;
+      int info = 0;
+      LAPACK::FORTRAN::xGETRF(n, n, factors[k].data(), n, pivots[k].data(),
+                              &info);
+      if (info != 0) throw excMath("xGETRF failed");
+      ++n_factorizations;
+    };
+    feast.shifted_solve = [&](I_t k, char trans, Dense<Z>& X) {
+      int info = 0;
+      LAPACK::FORTRAN::xGETRS(trans, n, X.cols(), factors[k].data(), n,
+                              pivots[k].data(), X._begin(),
+                              X._leading_dimension, &info);
+    };
+    feast.n_streams = 1;
+    check(deviation(feast, laplacian, no_s, n, 0.0, 0.05, 40));
+    if (n_factorizations != feast.n_points) ++errors;
+
+    // Errors of the plugged in solver are passed on
+    feast.shifted_factorize = [](I_t k, Z z) {
+      throw excMath("singular");
+    };
+    try {
+      deviation(feast, laplacian, no_s, n, 0.0, 0.05, 40);
+      ++errors;
+    } catch (excMath&) {
+    }
+  }
+
+  // Non convergence is reported, the last Ritz pairs are returned
+  {
+    Solvers::FEAST<T> feast;
+    feast.max_iterations = 1;
+    feast.tolerance      = 1e-30;
+    auto H = dense2csr(laplacian, n);
+    Dense<typename RealType<T>::type> lambda;
+    Dense<T> X;
+    try {
+      feast.solve(H, 0.0, 0.05, 40, lambda, X);
+      ++errors;
+    } catch (excMath&) {
+    }
+    if (feast.converged || feast.iterations != 1) ++errors;
+  }
+
+  // No eigenvalues in the interval
+  {
+    Solvers::FEAST<T> feast;
+    feast.tolerance = tolerance;
+    auto H = dense2csr(laplacian, n);
+    Dense<typename RealType<T>::type> lambda;
+    Dense<T> X;
+    if (feast.solve(H, 5.0, 6.0, 20, lambda, X) != 0) ++errors;
+    if (!feast.converged) ++errors;
+  }
+
+  // Empty interval and search spaces of the wrong size
+  {
+    Solvers::FEAST<T> feast;
+    auto H = dense2csr(laplacian, n);
+    Dense<typename RealType<T>::type> lambda;
+    Dense<T> X;
+    try {
+      feast.solve(H, 0.05, 0.0, 40, lambda, X);
+      ++errors;
+    } catch (excBadArgument&) {
+    }
+    for (I_t m0 : { 0, n + 1 }) {
+      try {
+        feast.solve(H, 0.0, 0.05, m0, lambda, X);
+        ++errors;
+      } catch (excBadArgument&) {
+      }
+    }
+  }
+
+  if (errors > 0) {
+    printf("%sFEAST: %zu wrong results (FAILED)\n", name, errors);
+  }
+
+  return report(name, "FEAST", max_deviation, 100 * tolerance) &&
+         errors == 0;
+
+}
+
+// Time for the eigenpairs of the 1D Laplacian of size n in [0, e_max] with
+// the built-in (banded) LU and with a dense LU plugged in
+template <typename T>
+void benchmark(const char* name, int n, double e_max, I_t m0) {
+
+  typedef typename ComplexType<T>::type Z;
+
+  auto a = tridiagonal<T>(n, 2.0, -1.0, 0.0, false);
+  auto H = dense2csr(a, n);
+  Dense<typename RealType<T>::type> lambda;
+  Dense<T> X;
+
+  Solvers::FEAST<T> feast;
+  auto start   = chrono::steady_clock::now();
+  auto n_found = feast.solve(H, 0.0, e_max, m0, lambda, X);
+  auto banded  = milliseconds_since(start);
+
+  vector<vector<Z>> factors(feast.n_points);
+  vector<vector<int>> pivots(feast.n_points);
+  feast.shifted_factorize = [&](I_t k, Z z) {
+    factors[k].assign(n * n, cast<Z>(0.0));
+    pivots[k].resize(n);
+    for (int i = 0; i < n * n; ++i) factors[k][i] = -cast<Z>(a[i]);
+    for (int i = 0; i < n; ++i) factors[k][i + i * n] += z;
+    int info = 0;
+    LAPACK::FORTRAN::xGETRF(n, n, factors[k].data(), n, pivots[k].data(),
+                            &info);
+  };
+  feast.shifted_solve = [&](I_t k, char trans, Dense<Z>& X) {
+    int info = 0;
+    LAPACK::FORTRAN::xGETRS(trans, n, X.cols(), factors[k].data(), n,
+                            pivots[k].data(), X._begin(),
+                            X._leading_dimension, &info);
+  };
+  start = chrono::steady_clock::now();
+  feast.solve(H, 0.0, e_max, m0, lambda, X);
+  auto dense = milliseconds_since(start);
+
+  printf("%sFEAST n = %d, %d eigenpairs, m0 = %d: banded LU %8.2f ms, "
+         "dense LU %8.2f ms\n", name, n, n_found, m0, banded, dense);
+
+}
+
+int main(int argc, char* argv[]) {
+
+  auto passed = test<S_t>("S", 1e-4) &&
+                test<D_t>("D", 1e-10) &&
+                test<C_t>("C", 1e-4) &&
+                test<Z_t>("Z", 1e-10);
+
+  benchmark<D_t>("D", 2000, 5e-4, 30);
+  benchmark<Z_t>("Z", 2000, 5e-4, 30);
+
+  return passed ? 0 : 1;
+
+}
@@ -0,0 +1,147 @@
+/** \file             test_utilities_copy_2Darray.cc
+ *
+ *  \brief            Test for LinAlg::Utilities::copy_2Darray in main memory
+ *                    (all combinations of formats with and without
+ *                    transposition, compares with the definition and reports
+ *                    the time of transposed copies compared to a straight
+ *                    copy)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <linalg.h>
+
+#include "test_helpers.h"
+
+using namespace std;
+using namespace LinAlg;
+
+// Copies a rows x cols array with copy_2Darray() and compares with the
+// definition, returns the number of wrong elements
+template <typename T>
+size_t test_copy(bool transpose, Format src_format, Format dst_format,
+                 I_t rows, I_t cols) {
+
+  auto src_ld = ((src_format == Format::ColMajor) ? rows : cols) + 3;
+  auto dst_rows = (transpose) ? cols : rows;
+  auto dst_cols = (transpose) ? rows : cols;
+  auto dst_ld = ((dst_format == Format::ColMajor) ? dst_rows : dst_cols) + 5;
+
+  vector<T> src(src_ld * ((src_format == Format::ColMajor) ? cols : rows));
+  vector<T> dst(dst_ld * ((dst_format == Format::ColMajor) ? dst_cols
+                                                           : dst_rows));
+  for (auto& v : src) v = random_value<T>();
+  auto untouched = random_value<T>();
+  for (auto& v : dst) v = untouched;
+
+  Utilities::copy_2Darray(transpose, src_format, src.data(), src_ld,
+                          Location::host, 0, rows, cols, dst_format,
+                          dst.data(), dst_ld, Location::host, 0);
+
+  auto src_element = [&](I_t row, I_t col) {
+    return (src_format == Format::ColMajor) ? src[col * src_ld + row]
+                                            : src[row * src_ld + col];
+  };
+  auto dst_index = [&](I_t row, I_t col) {
+    return (dst_format == Format::ColMajor) ? col * dst_ld + row
+                                            : row * dst_ld + col;
+  };
+
+  size_t errors = 0;
+  auto reference = vector<T>(dst.size(), untouched);
+  for (I_t row = 0; row < rows; ++row) {
+    for (I_t col = 0; col < cols; ++col) {
+      auto index = (transpose) ? dst_index(col, row) : dst_index(row, col);
+      reference[index] = src_element(row, col);
+    }
+  }
+  for (size_t i = 0; i < dst.size(); ++i) {
+    if (dst[i] != reference[i]) ++errors;
+  }
+
+  return errors;
+
+}
+
+template <typename T>
+bool test(const char* name) {
+
+  size_t errors = 0;
+
+  // Sizes below, at and above the tile size, not multiples of the blocks
+  for (auto rows : { 1, 7, 32, 45, 130 }) {
+    for (auto cols : { 1, 9, 32, 67 }) {
+      for (auto src_format : { Format::ColMajor, Format::RowMajor }) {
+        for (auto dst_format : { Format::ColMajor, Format::RowMajor }) {
+          for (auto transpose : { false, true }) {
+            errors += test_copy<T>(transpose, src_format, dst_format, rows,
+                                   cols);
+          }
+        }
+      }
+    }
+  }
+
+  // Large enough to run multithreaded
+  errors += test_copy<T>(true, Format::ColMajor, Format::ColMajor, 1531, 997);
+  errors += test_copy<T>(false, Format::RowMajor, Format::ColMajor, 997,
+                         1531);
+
+  return report_errors(name, "copy_2Darray", errors);
+
+}
+
+template <typename T>
+void benchmark(const char* name, I_t n) {
+
+  const int repetitions = 10;
+
+  vector<T> src(n * n), dst(n * n);
+  for (auto& v : src) v = random_value<T>();
+
+  auto milliseconds = [&](bool transpose, Format dst_format) {
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < repetitions; ++i) {
+      Utilities::copy_2Darray(transpose, Format::ColMajor, src.data(), n,
+                              Location::host, 0, n, n, dst_format,
+                              dst.data(), n, Location::host, 0);
+    }
+    return milliseconds_since(start, repetitions);
+  };
+
+  auto straight = milliseconds(false, Format::ColMajor);
+  auto transposed = milliseconds(true, Format::ColMajor);
+  auto converted = milliseconds(false, Format::RowMajor);
+
+  printf("%scopy_2Darray %5dx%5d: copy %8.2f ms, transpose %8.2f ms, "
+         "ColMajor->RowMajor %8.2f ms\n", name, n, n, straight, transposed,
+         converted);
+
+}
+
+int main(int argc, char* argv[]) {
+
+  auto passed = test<S_t>("S") &&
+                test<D_t>("D") &&
+                test<C_t>("C") &&
+                test<Z_t>("Z");
+
+  for (I_t n : { 1024, 4096 }) {
+    benchmark<S_t>("S", n);
+    benchmark<D_t>("D", n);
+    benchmark<Z_t>("Z", n);
+  }
+
+  return passed ? 0 : 1;
+
+}
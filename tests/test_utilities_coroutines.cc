@@ -0,0 +1,175 @@
+/** \file             test_utilities_coroutines.cc
+ *
+ *  \brief            Test for LinAlg::Coroutines (results and exceptions
+ *                    through co_await, completion racing destruction, waits
+ *                    nested in executor jobs), reports the cost of spawning
+ *                    and joining a coroutine
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <linalg.h>
+
+#include "test_helpers.h"
+
+using namespace std;
+using namespace LinAlg;
+
+#if __cplusplus >= 202002L && defined(__cpp_impl_coroutine)
+
+// Aborts the test if it doesn't finish in time (a deadlock would hang it)
+void watchdog(int seconds) {
+  thread([seconds]() {
+    this_thread::sleep_for(chrono::seconds(seconds));
+    printf("FAILED: coroutine test deadlocked\n");
+    fflush(stdout);
+    _Exit(1);
+  }).detach();
+}
+
+Coroutines::Coroutine<int> square(Stream& stream, int x) {
+  co_return co_await stream.async([x]() { return x * x; });
+}
+
+Coroutines::Coroutine<int> sum_of_squares(Stream& stream, int n) {
+  int sum = 0;
+  for (int i = 1; i <= n; ++i) sum += co_await square(stream, i);
+  co_return sum;
+}
+
+Coroutines::Coroutine<int> failing(Stream& stream) {
+  co_await stream.async([]() { return 0; });
+  throw runtime_error("failing");
+}
+
+Coroutines::Coroutine<> increment(atomic<int>& counter) {
+  ++counter;
+  co_return;
+}
+
+Coroutines::Coroutine<> wait_for(Coroutines::Coroutine<>& other) {
+  other.get();
+  co_return;
+}
+
+Coroutines::Coroutine<> wait_for_later(atomic<bool>& queued,
+                                       atomic<int>& counter) {
+  while (!queued) this_thread::yield();
+  auto later = increment(counter);
+  later.spawn();
+  later.get();
+  ++counter;
+  co_return;
+}
+
+bool test() {
+
+  size_t errors = 0;
+
+  Stream stream;
+  stream.start_thread();
+
+  // Results and exceptions through co_await
+  {
+    auto sum = sum_of_squares(stream, 10);
+    sum.spawn();
+    if (sum.get() != 385) ++errors;
+    if (sum_of_squares(stream, 4).get() != 30) ++errors;
+    auto throwing = failing(stream);
+    try {
+      throwing.get();
+      ++errors;
+    } catch (runtime_error&) {}
+  }
+
+  // Destroying the coroutine right after it completed on a worker: the
+  // completing thread may still be in the final suspension
+  {
+    atomic<int> counter(0);
+    const int repetitions = 20000;
+    for (int i = 0; i < repetitions; ++i) {
+      auto coroutine = increment(counter);
+      coroutine.spawn();
+    }
+    if (counter != repetitions) ++errors;
+  }
+
+  // A coroutine on a worker waits for one queued behind a job that waits
+  // for the first coroutine. A worker executing queued jobs while waiting
+  // would bury the first coroutine under a wait that needs it to complete.
+  for (int repetition = 0; repetition < 100; ++repetition) {
+    atomic<bool> queued(false);
+    atomic<int>  counter(0);
+    auto first = wait_for_later(queued, counter);
+    first.spawn();
+    auto second = wait_for(first);
+    second.spawn();
+    queued = true;
+    second.get();
+    if (counter != 2) ++errors;
+  }
+
+  return report_errors("", "Coroutines", errors);
+
+}
+
+// Time to spawn a coroutine on the executor and wait for it
+void benchmark() {
+
+  const int repetitions = 100000;
+
+  atomic<int> counter(0);
+
+  auto start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) {
+    auto coroutine = increment(counter);
+    coroutine.spawn();
+    coroutine.get();
+  }
+  auto spawned = milliseconds_since(start, repetitions);
+
+  printf("spawn + get: %8.2f us per coroutine (%d workers)\n",
+         1000 * spawned, Threads::Executor::global().n_workers());
+
+}
+
+int main(int argc, char* argv[]) {
+
+  // One worker unless requested otherwise: every wait on a worker then needs
+  // another thread to make progress
+  setenv("LINALG_EXECUTOR_THREADS", "1", 0);
+
+  watchdog(60);
+
+  auto passed = test();
+
+  benchmark();
+
+  return passed ? 0 : 1;
+
+}
+
+#else
+
+int main(int argc, char* argv[]) {
+
+  printf("Coroutines: skipped (needs C++20 with coroutine support)\n");
+
+  return 0;
+
+}
+
+#endif
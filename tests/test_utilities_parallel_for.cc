@@ -0,0 +1,120 @@
+/** \file             test_utilities_parallel_for.cc
+ *
+ *  \brief            Test for LinAlg::Threads::parallel_for (coverage of the
+ *                    iteration space, nested loops, exceptions, reports the
+ *                    overhead of a loop with an empty body)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <linalg.h>
+
+#include "test_helpers.h"
+
+using namespace std;
+using namespace LinAlg;
+
+// Number of iterations in [0, n) not visited exactly once by a loop with
+// n_threads ranges
+size_t coverage_errors(I_t n, int n_threads) {
+  vector<atomic<int>> visits(n);
+  for (auto& v : visits) v = 0;
+  Threads::parallel_for(n, [&](I_t begin, I_t end) {
+    for (auto i = begin; i < end; ++i) ++visits[i];
+  }, n_threads);
+  size_t errors = 0;
+  for (auto& v : visits) {
+    if (v != 1) ++errors;
+  }
+  return errors;
+}
+
+bool test() {
+
+  size_t errors = 0;
+
+  // More ranges than workers, fewer iterations than ranges, default
+  for (I_t n : { 1, 3, 1000, 100003 }) {
+    for (int n_threads : { 0, 1, 2, 7, 64 }) {
+      errors += coverage_errors(n, n_threads);
+    }
+  }
+
+  // Nested loops: the inner loops run within jobs of the executor
+  {
+    atomic<I_t> sum(0);
+    Threads::parallel_for(64, [&](I_t begin, I_t end) {
+      for (auto i = begin; i < end; ++i) {
+        Threads::parallel_for(100, [&](I_t inner_begin, I_t inner_end) {
+          sum += inner_end - inner_begin;
+        }, 8);
+      }
+    }, 16);
+    if (sum != 6400) ++errors;
+  }
+
+  // Exceptions are rethrown after all ranges finished
+  for (int repetition = 0; repetition < 100; ++repetition) {
+    atomic<int> finished(0);
+    try {
+      Threads::parallel_for(16, [&](I_t begin, I_t end) {
+        if (begin == 5) throw runtime_error("range 5");
+        ++finished;
+      }, 16);
+      ++errors;
+    } catch (runtime_error&) {
+      if (finished != 15) ++errors;
+    }
+  }
+
+  return report_errors("", "parallel_for", errors);
+
+}
+
+// Time for a loop with an empty body, and for creating and joining a
+// thread per range instead
+void benchmark(int n_threads) {
+
+  const int repetitions = 10000;
+
+  auto start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) {
+    Threads::parallel_for(1000, [](I_t begin, I_t end) {}, n_threads);
+  }
+  auto executor = milliseconds_since(start, repetitions);
+
+  start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions / 10; ++i) {
+    vector<thread> threads;
+    for (int t = 1; t < n_threads; ++t) threads.emplace_back([]() {});
+    for (auto& thread : threads) thread.join();
+  }
+  auto threads = milliseconds_since(start, repetitions / 10);
+
+  printf("parallel_for %d ranges: executor %8.2f us, threads %8.2f us per "
+         "loop\n", n_threads, 1000 * executor, 1000 * threads);
+
+}
+
+int main(int argc, char* argv[]) {
+
+  auto passed = test();
+
+  benchmark(2);
+  benchmark(Threads::Executor::global().n_workers());
+
+  return passed ? 0 : 1;
+
+}
@@ -0,0 +1,139 @@
+/** \file             test_utilities_stream_blocking.cc
+ *
+ *  \brief            Test for tasks waiting on streams from within executor
+ *                    jobs (nested waits, waits on the waiting stream, full
+ *                    queues), reports the cost of a blocking wait in a task
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include <linalg.h>
+
+#include "test_helpers.h"
+
+using namespace std;
+using namespace LinAlg;
+
+// Aborts the test if it doesn't finish in time (a deadlock would hang it)
+void watchdog(int seconds) {
+  thread([seconds]() {
+    this_thread::sleep_for(chrono::seconds(seconds));
+    printf("FAILED: stream blocking test deadlocked\n");
+    fflush(stdout);
+    _Exit(1);
+  }).detach();
+}
+
+bool test() {
+
+  size_t errors = 0;
+
+  // A task waits for a task of another stream while the job queued in front
+  // of that stream's runner waits for the first task. A worker executing
+  // the queued job while waiting would bury the first task under a wait
+  // that needs it to complete.
+  for (int repetition = 0; repetition < 100; ++repetition) {
+    Stream a, b, c;
+    a.start_thread();
+    b.start_thread();
+    c.start_thread();
+    atomic<bool> c_queued(false);
+    atomic<int>  result(0);
+    auto first = a.add([&]() {
+      while (!c_queued) this_thread::yield();
+      b.sync(b.add([&]() { ++result; }));
+      ++result;
+    });
+    c.add([&]() {
+      Event(a, first).sync();
+      ++result;
+    });
+    c_queued = true;
+    c.sync();
+    if (result != 3) ++errors;
+  }
+
+  // Each task adds a task to the next stream and waits for it
+  {
+    const int depth = 32;
+    vector<Stream> streams(depth);
+    for (auto& stream : streams) stream.start_thread();
+    atomic<int> reached(0);
+    function<void(int)> descend = [&](int level) {
+      ++reached;
+      if (level + 1 == depth) return;
+      streams[level + 1].sync(streams[level + 1].add([&, level]() {
+        descend(level + 1);
+      }));
+    };
+    streams[0].sync(streams[0].add([&]() { descend(0); }));
+    if (reached != depth) ++errors;
+  }
+
+  // A task adds more tasks to a running stream than its queue holds
+  {
+    Stream producer, consumer;
+    producer.start_thread();
+    consumer.start_thread();
+    const int n_tasks = 3 * int(consumer.queue.capacity());
+    atomic<int> executed(0);
+    producer.sync(producer.add([&]() {
+      for (int i = 0; i < n_tasks; ++i) consumer.add([&]() { ++executed; });
+    }));
+    consumer.sync();
+    if (executed != n_tasks) ++errors;
+  }
+
+  return report_errors("", "Stream::sync() in tasks", errors);
+
+}
+
+// Time for a task to wait for a task of another stream, blocking a worker
+// on the way
+void benchmark() {
+
+  const int repetitions = 10000;
+
+  Stream outer, inner;
+  outer.start_thread();
+  inner.start_thread();
+
+  auto start = chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; ++i) {
+    outer.add([&]() { inner.sync(inner.add([]() {})); });
+  }
+  outer.sync();
+  auto nested = milliseconds_since(start, repetitions);
+
+  printf("nested sync: %8.2f us per task (%d workers)\n", 1000 * nested,
+         Threads::Executor::global().n_workers());
+
+}
+
+int main(int argc, char* argv[]) {
+
+  // One worker unless requested otherwise: every wait in a task then needs
+  // another thread to make progress
+  setenv("LINALG_EXECUTOR_THREADS", "1", 0);
+
+  watchdog(60);
+
+  auto passed = test();
+
+  benchmark();
+
+  return passed ? 0 : 1;
+
+}
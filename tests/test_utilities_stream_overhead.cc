@@ -0,0 +1,122 @@
+/** \file             test_utilities_stream_overhead.cc
+ *
+ *  \brief            Microbenchmark for the per-task overhead of
+ *                    LinAlg::Stream
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include <linalg.h>
+
+using namespace std;
+using namespace LinAlg;
+
+typedef chrono::steady_clock clock_type;
+
+double nanoseconds_per_task(clock_type::time_point start, size_t n_tasks) {
+  auto elapsed = clock_type::now() - start;
+  return chrono::duration<double, nano>(elapsed).count() / n_tasks;
+}
+
+/* Prints the overhead of empty tasks in six scenarios:
+ *
+ *   throughput:  one thread adds many tasks, then synchronizes once
+ *   batched:     like throughput but tasks are added with add_batch() in 
+ *                batches of 64
+ *   coalesced:   like batched but the runner executes up to 64 tasks per 
+ *                executor job (Stream::coalesce)
+ *   round trip:  add a task and synchronize with it, one at a time (for 
+ *                each Threads::SyncPolicy)
+ *   producers:   several threads add to the same stream concurrently
+ *   captures:    like throughput but each task captures three Dense<D_t> 
+ *                (as the tasks of xGEMM_async() do)
+ */
+int main(int argc, char* argv[]) {
+
+  size_t n_tasks     = (argc > 1) ? atol(argv[1]) : 1000000;
+  int    n_producers = (argc > 2) ? atoi(argv[2]) : 4;
+
+  auto empty_task = []() {};
+
+  Stream stream;
+  stream.start_thread();
+
+  // Warm up the executor
+  stream.sync(stream.add(empty_task));
+
+  auto start = clock_type::now();
+  for (size_t i = 0; i < n_tasks; ++i) stream.add(empty_task);
+  stream.sync();
+  printf("throughput:  %8.1f ns/task\n", nanoseconds_per_task(start, n_tasks));
+
+  const size_t batch_size = 64;
+  for (int coalesce : {1, int(batch_size)}) {
+    stream.coalesce = coalesce;
+    start = clock_type::now();
+    for (size_t i = 0; i < n_tasks / batch_size; ++i) {
+      vector<Threads::Task> batch;
+      batch.reserve(batch_size);
+      for (size_t j = 0; j < batch_size; ++j) batch.emplace_back(empty_task);
+      stream.add_batch(std::move(batch));
+    }
+    stream.sync();
+    printf("%s %8.1f ns/task\n",
+           (coalesce == 1) ? "batched:    " : "coalesced:  ",
+           nanoseconds_per_task(start, (n_tasks / batch_size) * batch_size));
+  }
+  stream.coalesce = 1;
+
+  // Round trips for each synchronization policy
+  struct { const char* name; Threads::SyncPolicy policy; } policies[] = {
+    { "park",     Threads::SyncPolicy::park()     },
+    { "spin",     Threads::SyncPolicy::spin()     },
+    { "adaptive", Threads::SyncPolicy::adaptive() }
+  };
+  auto n_round_trips = n_tasks / 10;
+  for (auto& policy : policies) {
+    stream.sync_policy = policy.policy;
+    start = clock_type::now();
+    for (size_t i = 0; i < n_round_trips; ++i) {
+      stream.sync(stream.add(empty_task));
+    }
+    printf("round trip:  %8.1f ns/task (%s)\n",
+           nanoseconds_per_task(start, n_round_trips), policy.name);
+  }
+  stream.sync_policy = Threads::SyncPolicy::adaptive();
+
+  vector<thread> producers;
+  start = clock_type::now();
+  for (int p = 0; p < n_producers; ++p) {
+    producers.emplace_back([&]() {
+      for (size_t i = 0; i < n_tasks / n_producers; ++i) {
+        stream.add(empty_task);
+      }
+    });
+  }
+  for (auto& producer : producers) producer.join();
+  stream.sync();
+  printf("producers:   %8.1f ns/task (%d threads)\n",
+         nanoseconds_per_task(start, (n_tasks / n_producers) * n_producers),
+         n_producers);
+
+  Dense<D_t> A(16, 16), B(16, 16), C(16, 16);
+  start = clock_type::now();
+  for (size_t i = 0; i < n_tasks; ++i) {
+    stream.add([A, B, C]() mutable {});
+  }
+  stream.sync();
+  printf("captures:    %8.1f ns/task\n", nanoseconds_per_task(start, n_tasks));
+
+  return 0;
+
+}
@@ -0,0 +1,148 @@
+/** \file             test_utilities_stream_queue.cc
+ *
+ *  \brief            Test for the queue of LinAlg::Stream (allocation on
+ *                    first use, growth and concurrent sync() for streams not
+ *                    attached to the executor), reports the cost of adding
+ *                    to a stream that isn't started
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include <linalg.h>
+
+#include "test_helpers.h"
+
+using namespace std;
+using namespace LinAlg;
+
+bool test() {
+
+  size_t errors = 0;
+
+  // Streams only allocate their queue once they are started or used and
+  // only resolve their executor once they are started
+  {
+    Stream idle, started, used, synchronous(Streams::Synchronous);
+    started.start_thread();
+    used.add([]() {});
+    synchronous.start_thread();
+    if (!idle.queue.slots.empty()) ++errors;
+    if (started.queue.slots.empty()) ++errors;
+    if (used.queue.slots.empty()) ++errors;
+    if (!idle.is_done()) ++errors;
+    idle.sync();
+    if (idle.executor != nullptr || used.executor != nullptr) ++errors;
+    if (synchronous.executor != nullptr) ++errors;
+    if (started.executor == nullptr) ++errors;
+  }
+
+  // More tasks than the queue holds, added before the stream is started:
+  // the queue grows, nothing runs before start_thread()
+  {
+    Stream stream;
+    const int n_tasks = 5 * LINALG_STREAM_QUEUE_SIZE + 3;
+    vector<int> order;
+    for (int i = 0; i < n_tasks; ++i) {
+      stream.add([&order, i]() { order.push_back(i); });
+    }
+    vector<Threads::Task> batch;
+    for (int i = 0; i < 2 * LINALG_STREAM_QUEUE_SIZE; ++i) {
+      batch.emplace_back([&order, n_tasks, i]() {
+        order.push_back(n_tasks + i);
+      });
+    }
+    auto last = stream.add_batch(std::move(batch)).last;
+    if (!order.empty()) ++errors;
+    stream.start_thread();
+    stream.sync(last);
+    if (order.size() != size_t(n_tasks + 2 * LINALG_STREAM_QUEUE_SIZE)) {
+      ++errors;
+    }
+    for (size_t i = 0; i < order.size(); ++i) {
+      if (order[i] != int(i)) ++errors;
+    }
+  }
+
+  // Several threads synchronize with a stream that isn't started: the tasks
+  // run in order and never concurrently
+  for (int repetition = 0; repetition < 20; ++repetition) {
+    Stream stream;
+    atomic<int> running(0);
+    atomic<int> overlaps(0);
+    int next = 0;
+    int out_of_order = 0;
+    vector<I_t> tickets;
+    for (int i = 0; i < 2000; ++i) {
+      tickets.push_back(stream.add([&, i]() {
+        if (running++ != 0) ++overlaps;
+        if (next++ != i) ++out_of_order;
+        --running;
+      }));
+    }
+    vector<thread> consumers;
+    for (int t = 0; t < 4; ++t) {
+      consumers.emplace_back([&, t]() {
+        for (size_t i = t; i < tickets.size(); i += 97) stream.sync(tickets[i]);
+        stream.sync();
+      });
+    }
+    for (auto& consumer : consumers) consumer.join();
+    if (overlaps != 0 || out_of_order != 0 || next != 2000) ++errors;
+  }
+
+  // Tasks of a stream that isn't started synchronizing with the stream
+  {
+    Stream stream;
+    int executed = 0;
+    I_t first = stream.add([&]() { ++executed; });
+    stream.add([&]() { stream.sync(first); ++executed; });
+    auto inner = stream.add([&]() { ++executed; });
+    stream.add([&]() { stream.sync(inner); ++executed; });
+    stream.sync();
+    if (executed != 4) ++errors;
+  }
+
+  return report_errors("", "Stream queue", errors);
+
+}
+
+// Time per task to add to and work off a stream that isn't started
+void benchmark() {
+
+  const int n_tasks = 1000000;
+
+  Stream stream;
+
+  auto start = chrono::steady_clock::now();
+  for (int i = 0; i < n_tasks; ++i) stream.add([]() {});
+  auto adding = milliseconds_since(start, n_tasks);
+
+  start = chrono::steady_clock::now();
+  stream.sync();
+  auto syncing = milliseconds_since(start, n_tasks);
+
+  printf("stream not started: add %8.1f ns, sync %8.1f ns per task\n",
+         1e6 * adding, 1e6 * syncing);
+
+}
+
+int main(int argc, char* argv[]) {
+
+  auto passed = test();
+
+  benchmark();
+
+  return passed ? 0 : 1;
+
+}
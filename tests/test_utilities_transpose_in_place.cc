@@ -0,0 +1,142 @@
+/** \file             test_utilities_transpose_in_place.cc
+ *
+ *  \brief            Test for Dense<T>::transpose_in_place() (square, square
+ *                    submatrices, rectangular ColMajor and RowMajor matrices,
+ *                    compares with the definition and reports the time
+ *                    compared to an out-of-place transposition)
+ *
+ *  \date             Created:  Oct 18, 2026
+ *  \date             Modified: $Date$
+ *
+ *  \authors          mauro <mcalderara@iis.ee.ethz.ch>
+ *
+ *  \version          $Revision$
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <linalg.h>
+
+#include "test_helpers.h"
+
+using namespace std;
+using namespace LinAlg;
+
+// Transposes the m x n column major array with leading dimension ld (a
+// RowMajor n x m matrix if row_major) in place and compares with the
+// definition, returns the number of wrong elements
+template <typename T>
+size_t test_transpose(I_t m, I_t n, I_t ld, bool row_major) {
+
+  vector<T> array(ld * n);
+  for (auto& v : array) v = random_value<T>();
+  auto original = array;
+
+  Dense<T> A(array.data(), ld, m, n);
+  if (row_major) {
+    // RowMajor n x m matrix with the same memory
+    A._format = Format::RowMajor;
+    A._rows = n;
+    A._cols = m;
+  }
+  auto rows = A.rows(), cols = A.cols();
+
+  A.transpose_in_place();
+
+  size_t errors = 0;
+  if (!A._transposed || A.rows() != rows || A.cols() != cols) ++errors;
+
+  auto new_ld = (m == n) ? ld : n;
+  if (A._leading_dimension != new_ld) ++errors;
+  for (I_t j = 0; j < n; ++j) {
+    for (I_t i = 0; i < m; ++i) {
+      if (array[i * new_ld + j] != original[j * ld + i]) ++errors;
+    }
+  }
+
+  // Transposing back restores the original array
+  A.transpose_in_place();
+  if (A._transposed) ++errors;
+  for (I_t j = 0; j < n; ++j) {
+    for (I_t i = 0; i < m; ++i) {
+      if (array[j * ld + i] != original[j * ld + i]) ++errors;
+    }
+  }
+
+  return errors;
+
+}
+
+template <typename T>
+bool test(const char* name) {
+
+  size_t errors = 0;
+
+  for (auto n : { 1, 5, 32, 33, 100 }) {
+    errors += test_transpose<T>(n, n, n, false);
+    errors += test_transpose<T>(n, n, n + 7, false);
+  }
+  for (auto m : { 1, 2, 17, 64, 129 }) {
+    for (auto n : { 3, 31, 64, 250 }) {
+      if (m == n) continue;
+      errors += test_transpose<T>(m, n, m, false);
+      errors += test_transpose<T>(m, n, m, true);
+    }
+  }
+
+  // Large enough to run multithreaded
+  errors += test_transpose<T>(1200, 1200, 1203, false);
+
+  // Matrices sharing their memory can't be transposed in place
+  Dense<T> B(4, 3), B_clone(B);
+  try {
+    B.transpose_in_place();
+    ++errors;
+  } catch (excBadArgument&) {
+  }
+
+  return report_errors(name, "transpose_in_place", errors);
+
+}
+
+template <typename T>
+void benchmark(const char* name, I_t m, I_t n) {
+
+  vector<T> array(m * n), copy(m * n);
+  for (auto& v : array) v = random_value<T>();
+
+  Dense<T> A(array.data(), m, m, n);
+
+  auto start = chrono::steady_clock::now();
+  A.transpose_in_place();
+  auto in_place = milliseconds_since(start);
+
+  start = chrono::steady_clock::now();
+  Utilities::copy_2Darray(true, Format::ColMajor, array.data(), n,
+                          Location::host, 0, n, m, Format::ColMajor,
+                          copy.data(), m, Location::host, 0);
+  auto out_of_place = milliseconds_since(start);
+
+  printf("%stranspose_in_place %5dx%5d: %8.2f ms, out-of-place copy "
+         "%8.2f ms\n", name, m, n, in_place, out_of_place);
+
+}
+
+int main(int argc, char* argv[]) {
+
+  auto passed = test<S_t>("S") &&
+                test<D_t>("D") &&
+                test<C_t>("C") &&
+                test<Z_t>("Z");
+
+  benchmark<D_t>("D", 4096, 4096);
+  benchmark<D_t>("D", 4096, 2048);
+  benchmark<Z_t>("Z", 2048, 2048);
+  benchmark<Z_t>("Z", 2048, 1024);
+
+  return passed ? 0 : 1;
+
+}